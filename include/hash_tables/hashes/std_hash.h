@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <functional>
+#include <string>
+#include <string_view>
 
 namespace hash_tables::hashes {
 
@@ -54,4 +56,43 @@ private:
     std::hash<key_type> hash_{};
 };
 
+/*!
+ * \brief Class of hash function in C++ STL for strings.
+ *
+ * This class accepts any type convertible to std::basic_string_view
+ * (heterogeneous lookup), because std::hash gives the same hash numbers for
+ * strings and views of them.
+ *
+ * \tparam Char Type of characters.
+ * \tparam Traits Type of traits of characters.
+ * \tparam Allocator Type of allocators.
+ */
+template <typename Char, typename Traits, typename Allocator>
+class std_hash<std::basic_string<Char, Traits, Allocator>> {
+public:
+    //! Type of keys.
+    using key_type = std::basic_string<Char, Traits, Allocator>;
+
+    //! Type of hash numbers.
+    using hash_number_type = std::size_t;
+
+    //! Type to mark this hash function supports heterogeneous lookup.
+    using is_transparent = void;
+
+    /*!
+     * \brief Calculate a hash number.
+     *
+     * \param[in] key Key.
+     * \return Hash number.
+     */
+    [[nodiscard]] auto operator()(std::basic_string_view<Char, Traits> key) const
+        -> hash_number_type {
+        return hash_(key);
+    }
+
+private:
+    //! Actual hash function.
+    std::hash<std::basic_string_view<Char, Traits>> hash_{};
+};
+
 }  // namespace hash_tables::hashes
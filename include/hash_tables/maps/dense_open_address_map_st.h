@@ -0,0 +1,1203 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of dense_open_address_map_st class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>  // IWYU pragma: keep
+#include <utility>
+#include <vector>
+
+#include "hash_tables/exceptions.h"
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/round_up_to_power_of_two.h"
+
+namespace hash_tables::maps {
+
+/*!
+ * \brief Class to save key-value relations in a dense array in the order of
+ * insertion with a separate index using open addressing.
+ *
+ * Values are stored contiguously in a vector in the order of insertion, so
+ * iteration reads only values without empty or erased nodes. Deleting a
+ * single value moves the last value to its position, so the order of
+ * insertion is kept only until such deletion. Keys are
+ * searched using an index of positions of values with linear probing. Each
+ * slot of the index is a 16-bit integer when the number of slots is at most
+ * 65536, otherwise a 32-bit integer.
+ *
+ * \tparam KeyType Type of keys.
+ * \tparam MappedType Type of mapped values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ *
+ * \thread_safety Safe if only functions without modifications of data are
+ * called.
+ */
+template <typename KeyType, typename MappedType,
+    typename Hash = hashes::default_hash<KeyType>,
+    typename KeyEqual = std::equal_to<KeyType>,
+    typename Allocator = std::allocator<std::pair<KeyType, MappedType>>>
+class dense_open_address_map_st {
+public:
+    //! Type of keys.
+    using key_type = KeyType;
+
+    //! Type of mapped values.
+    using mapped_type = MappedType;
+
+    //! Type of values.
+    using value_type = std::pair<key_type, mapped_type>;
+
+    //! Type of the hash function.
+    using hash_type = Hash;
+
+    //! Type of the function to check whether keys are equal.
+    using key_equal_type = KeyEqual;
+
+    //! Type of allocators.
+    using allocator_type = Allocator;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+private:
+    //! Type of the vector of values.
+    using values_type = std::vector<value_type, allocator_type>;
+
+public:
+    //! Type of iterators.
+    //!
+    //! \warning Keys must not be changed through iterators.
+    using iterator = typename values_type::iterator;
+
+    //! Type of constant iterators.
+    using const_iterator = typename values_type::const_iterator;
+
+    //! Default number of slots in the index.
+    static constexpr size_type default_num_slots = 32;
+
+    //! Maximum number of slots in the index using 16-bit integers.
+    static constexpr size_type max_num_short_index_slots =
+        static_cast<size_type>(std::numeric_limits<std::uint16_t>::max()) +
+        1U;
+
+    /*!
+     * \brief Constructor.
+     */
+    dense_open_address_map_st()
+        : dense_open_address_map_st(default_num_slots) {}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] min_num_slots Minimum number of slots in the index.
+     * \param[in] hash Hash function.
+     * \param[in] key_equal Function to check whether keys are equal.
+     * \param[in] allocator Allocator.
+     */
+    explicit dense_open_address_map_st(size_type min_num_slots,
+        hash_type hash = hash_type(),
+        key_equal_type key_equal = key_equal_type(),
+        allocator_type allocator = allocator_type())
+        : values_(allocator),
+          hashes_(hashes_allocator_type(allocator)),
+          short_index_(short_index_allocator_type(allocator)),
+          long_index_(long_index_allocator_type(allocator)),
+          hash_(std::move(hash)),
+          key_equal_(std::move(key_equal)) {
+        rebuild_index(utility::round_up_to_power_of_two(
+            std::max<size_type>(min_num_slots, 2U)));
+    }
+
+    /*!
+     * \brief Copy constructor.
+     */
+    dense_open_address_map_st(const dense_open_address_map_st&) = default;
+
+    /*!
+     * \brief Move constructor.
+     */
+    dense_open_address_map_st(dense_open_address_map_st&&)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_constructible_v<hash_type> &&
+            std::is_nothrow_move_constructible_v<key_equal_type>)
+#endif
+        = default;
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * \return This.
+     */
+    auto operator=(const dense_open_address_map_st&)
+        -> dense_open_address_map_st&
+#ifndef HASH_TABLES_DOCUMENTATION
+        = default
+#endif
+        ;
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \return This.
+     */
+    auto operator=(dense_open_address_map_st&&)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_assignable_v<values_type> &&
+            std::is_nothrow_move_assignable_v<hash_type> &&
+            std::is_nothrow_move_assignable_v<key_equal_type>)
+#endif
+            -> dense_open_address_map_st&
+#ifndef HASH_TABLES_DOCUMENTATION
+        = default
+#endif
+        ;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~dense_open_address_map_st() noexcept = default;
+
+    /*!
+     * \name Create or update values.
+     */
+    ///@{
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(const value_type& value) -> bool {
+        const size_type hash_number = hash_(value.first);
+        if (find_slot(value.first, hash_number) != no_slot) {
+            return false;
+        }
+        emplace_new(hash_number, value);
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(value_type&& value) -> bool {
+        const size_type hash_number = hash_(value.first);
+        if (find_slot(value.first, hash_number) != no_slot) {
+            return false;
+        }
+        emplace_new(hash_number, std::move(value));
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace(const key_type& key, Args&&... args) -> bool {
+        return try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace(key_type&& key, Args&&... args) -> bool {
+        return try_emplace(std::move(key), std::forward<Args>(args)...).second;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Reference to the inserted or existing mapped value, and whether
+     * the value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args)
+        -> std::pair<mapped_type&, bool> {
+        const size_type hash_number = hash_(key);
+        const size_type slot = find_slot(key, hash_number);
+        if (slot != no_slot) {
+            return {values_[entry_at(slot)].second, false};
+        }
+        return {emplace_new(hash_number, std::piecewise_construct,
+                    std::forward_as_tuple(key),
+                    std::forward_as_tuple(std::forward<Args>(args)...))
+                    .second,
+            true};
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * The key is moved only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Reference to the inserted or existing mapped value, and whether
+     * the value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(key_type&& key, Args&&... args)
+        -> std::pair<mapped_type&, bool> {
+        const size_type hash_number = hash_(key);
+        const size_type slot = find_slot(key, hash_number);
+        if (slot != no_slot) {
+            return {values_[entry_at(slot)].second, false};
+        }
+        return {emplace_new(hash_number, std::piecewise_construct,
+                    std::forward_as_tuple(std::move(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...))
+                    .second,
+            true};
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor if not exist,
+     * or assign to an existing value.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is assigned to an existing key.
+     */
+    template <typename... Args>
+    auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
+        const size_type hash_number = hash_(key);
+        const size_type slot = find_slot(key, hash_number);
+        if (slot != no_slot) {
+            // NOLINTNEXTLINE(google-readability-casting): false positive
+            values_[entry_at(slot)].second =
+                mapped_type(std::forward<Args>(args)...);
+            return false;
+        }
+        emplace_new(hash_number, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return true;
+    }
+
+    /*!
+     * \brief Assign to an existing value.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is assigned.
+     * \retval false Value is not assigned because the key not found.
+     */
+    template <typename... Args>
+    auto assign(const key_type& key, Args&&... args) -> bool {
+        auto* value = try_get(key);
+        if (value == nullptr) {
+            return false;
+        }
+        // NOLINTNEXTLINE(google-readability-casting): false positive
+        *value = mapped_type(std::forward<Args>(args)...);
+        return true;
+    }
+
+    ///@}
+
+    /*!
+     * \name Read values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    [[nodiscard]] auto at(const key_type& key) -> mapped_type& {
+        auto* value = try_get(key);
+        if (value == nullptr) {
+            throw key_not_found();
+        }
+        return *value;
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    [[nodiscard]] auto at(const key_type& key) const -> const mapped_type& {
+        const auto* value = try_get(key);
+        if (value == nullptr) {
+            throw key_not_found();
+        }
+        return *value;
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Mapped value.
+     */
+    template <typename... Args>
+    auto get_or_create(const key_type& key, Args&&... args) -> mapped_type& {
+        return try_emplace(key, std::forward<Args>(args)...).first;
+    }
+
+    /*!
+     * \brief Get a value constructing it using default constructor if not
+     * found.
+     *
+     * \param[in] key Key of the value.
+     * \return Mapped value.
+     */
+    auto operator[](const key_type& key) -> mapped_type& {
+        return get_or_create(key);
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    auto operator[](const key_type& key) const -> const mapped_type& {
+        return at(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    auto try_get(const key_type& key) -> mapped_type* {
+        return try_get_impl(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto try_get(const KeyLike& key) -> mapped_type* {
+        return try_get_impl(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) const
+        -> const mapped_type* {
+        return try_get_impl(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const
+        -> const mapped_type* {
+        return try_get_impl(key);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has(const key_type& key) const -> bool {
+        return find_slot(key, hash_(key)) != no_slot;
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return find_slot(key, hash_(key)) != no_slot;
+    }
+
+    /*!
+     * \brief Call a function with all values in the order of insertion.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) {
+        for (auto& value : values_) {
+            std::invoke(function, static_cast<const key_type&>(value.first),
+                static_cast<mapped_type&>(value.second));
+        }
+    }
+
+    /*!
+     * \brief Call a function with all values in the order of insertion.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) const {
+        for (const auto& value : values_) {
+            std::invoke(function, static_cast<const key_type&>(value.first),
+                static_cast<const mapped_type&>(value.second));
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Iterate over values.
+     *
+     * Values are visited in the order of insertion.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() noexcept -> iterator { return values_.begin(); }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return values_.begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return values_.cbegin();
+    }
+
+    /*!
+     * \brief Get an iterator to the past-the-end value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() noexcept -> iterator { return values_.end(); }
+
+    /*!
+     * \brief Get an iterator to the past-the-end value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return values_.end();
+    }
+
+    /*!
+     * \brief Get an iterator to the past-the-end value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return values_.cend();
+    }
+
+    ///@}
+
+    /*!
+     * \name Delete values.
+     */
+    ///@{
+
+    /*!
+     * \brief Delete all values.
+     */
+    void clear() noexcept {
+        values_.clear();
+        hashes_.clear();
+        clear_index();
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * The last value is moved to the position of the deleted value, so this
+     * function doesn't keep the order of insertion. Use erase_if function to
+     * keep the order.
+     *
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase(const key_type& key) -> bool { return erase_impl(key); }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * The last value is moved to the position of the deleted value, so this
+     * function doesn't keep the order of insertion. Use erase_if function to
+     * keep the order.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        return erase_impl(key);
+    }
+
+    /*!
+     * \brief Delete values which satisfy a condition.
+     *
+     * Remaining values are kept in the order of insertion.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check the condition.
+     * \return Number of removed values.
+     */
+    template <typename Function>
+    auto erase_if(Function&& function) -> size_type {
+        const size_type old_size = values_.size();
+        size_type num_kept = 0;
+        size_type i = 0;
+        try {
+            for (; i < old_size; ++i) {
+                if (!std::invoke(function,
+                        static_cast<const key_type&>(values_[i].first),
+                        static_cast<const mapped_type&>(values_[i].second))) {
+                    keep_at(i, num_kept);
+                    ++num_kept;
+                }
+            }
+        } catch (...) {
+            for (; i < old_size; ++i) {
+                keep_at(i, num_kept);
+                ++num_kept;
+            }
+            truncate_and_reindex(num_kept);
+            throw;
+        }
+        truncate_and_reindex(num_kept);
+        return old_size - num_kept;
+    }
+
+    ///@}
+
+    /*!
+     * \name Handle size.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the number of values.
+     *
+     * \return Number of values.
+     */
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return values_.size();
+    }
+
+    /*!
+     * \brief Check whether this object is empty.
+     *
+     * \retval true This object is empty.
+     * \retval false This object is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return values_.empty();
+    }
+
+    /*!
+     * \brief Get the maximum number of values.
+     *
+     * \return Maximum number of values.
+     */
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return std::min<size_type>(values_.max_size(),
+            static_cast<size_type>(std::numeric_limits<std::uint32_t>::max()) -
+                1U);
+    }
+
+    /*!
+     * \brief Reserve enough place for values.
+     *
+     * \param[in] size Number of values.
+     */
+    void reserve(size_type size) {
+        values_.reserve(size);
+        hashes_.reserve(size);
+        const size_type num_slots = required_num_slots(size);
+        if (num_slots > num_slots_) {
+            rebuild_index(num_slots);
+        }
+    }
+
+    /*!
+     * \brief Decrease the memory for values and the number of slots in the
+     * index to the minimum for the current values.
+     */
+    void shrink_to_fit() {
+        values_.shrink_to_fit();
+        hashes_.shrink_to_fit();
+        const size_type num_slots = std::max(
+            required_num_slots(values_.size()), min_num_slots_for_shrink);
+        if (num_slots < num_slots_) {
+            rebuild_index(num_slots);
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Handle internal data.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the hash function.
+     *
+     * \return Hash function.
+     */
+    [[nodiscard]] auto hash() const noexcept -> const hash_type& {
+        return hash_;
+    }
+
+    /*!
+     * \brief Get the function to check whether keys are equal.
+     *
+     * \return Function to check whether keys are equal.
+     */
+    [[nodiscard]] auto key_equal() const noexcept -> const key_equal_type& {
+        return key_equal_;
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto allocator() const -> allocator_type {
+        return values_.get_allocator();
+    }
+
+    /*!
+     * \brief Get the number of slots in the index.
+     *
+     * \return Number of slots.
+     */
+    [[nodiscard]] auto num_slots() const noexcept -> size_type {
+        return num_slots_;
+    }
+
+    /*!
+     * \brief Check whether the index uses 16-bit integers.
+     *
+     * \retval true The index uses 16-bit integers.
+     * \retval false The index uses 32-bit integers.
+     */
+    [[nodiscard]] auto uses_short_index() const noexcept -> bool {
+        return num_slots_ <= max_num_short_index_slots;
+    }
+
+    /*!
+     * \brief Change the number of slots in the index.
+     *
+     * \param[in] min_num_slots Minimum number of slots.
+     */
+    void rehash(size_type min_num_slots) {
+        rebuild_index(std::max(
+            utility::round_up_to_power_of_two(
+                std::max<size_type>(min_num_slots, 2U)),
+            required_num_slots(values_.size())));
+    }
+
+    /*!
+     * \brief Get the load factor (number of values / number of slots).
+     *
+     * \return Load factor.
+     */
+    auto load_factor() -> float {
+        return static_cast<float>(values_.size()) /
+            static_cast<float>(num_slots_);
+    }
+
+    /*!
+     * \brief Get the maximum load factor (number of values / number of slots).
+     *
+     * \return Maximum load factor.
+     */
+    auto max_load_factor() -> float { return max_load_factor_; }
+
+    /*!
+     * \brief Set the maximum load factor (number of values / number of slots).
+     *
+     * \param[in] value Maximum load factor.
+     */
+    void max_load_factor(float value) {
+        if (value <= 0.0F || 1.0F <= value) {
+            throw std::invalid_argument("Invalid maximum load factor.");
+        }
+        max_load_factor_ = value;
+    }
+
+    ///@}
+
+private:
+    //! Type of allocators of hash numbers.
+    using hashes_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<size_type>;
+
+    //! Type of the vector of hash numbers.
+    using hashes_type = std::vector<size_type, hashes_allocator_type>;
+
+    //! Type of allocators of the index using 16-bit integers.
+    using short_index_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<std::uint16_t>;
+
+    //! Type of the index using 16-bit integers.
+    using short_index_type =
+        std::vector<std::uint16_t, short_index_allocator_type>;
+
+    //! Type of allocators of the index using 32-bit integers.
+    using long_index_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<std::uint32_t>;
+
+    //! Type of the index using 32-bit integers.
+    using long_index_type =
+        std::vector<std::uint32_t, long_index_allocator_type>;
+
+    //! Value of slots without values.
+    template <typename IndexValue>
+    static constexpr IndexValue empty_slot =
+        std::numeric_limits<IndexValue>::max();
+
+    //! Default maximum load factor.
+    static constexpr float default_max_load_factor = 0.5F;
+
+    //! Slot returned when a key is not found.
+    static constexpr size_type no_slot = std::numeric_limits<size_type>::max();
+
+    //! Minimum number of slots after shrink_to_fit function.
+    static constexpr size_type min_num_slots_for_shrink = 2;
+
+    /*!
+     * \brief Call a function with the index currently used.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     * \return Return value of the function.
+     */
+    template <typename Function>
+    auto visit_index(Function&& function) const -> decltype(auto) {
+        if (uses_short_index()) {
+            return std::invoke(function, short_index_);
+        }
+        return std::invoke(function, long_index_);
+    }
+
+    /*!
+     * \brief Call a function with the index currently used.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     * \return Return value of the function.
+     */
+    template <typename Function>
+    auto visit_index(Function&& function) -> decltype(auto) {
+        if (uses_short_index()) {
+            return std::invoke(function, short_index_);
+        }
+        return std::invoke(function, long_index_);
+    }
+
+    /*!
+     * \brief Get the position of the value in a slot.
+     *
+     * \param[in] slot Slot.
+     * \return Position of the value.
+     */
+    [[nodiscard]] auto entry_at(size_type slot) const noexcept -> size_type {
+        return visit_index([slot](const auto& index) {
+            return static_cast<size_type>(index[slot]);
+        });
+    }
+
+    /*!
+     * \brief Find the slot of a key.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Slot if found, otherwise no_slot.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_slot(
+        const KeyLike& key, size_type hash_number) const -> size_type {
+        return visit_index([this, &key, hash_number](const auto& index) {
+            using index_value_type =
+                typename std::decay_t<decltype(index)>::value_type;
+            const size_type mask = num_slots_ - 1U;
+            for (size_type slot = hash_number & mask;;
+                 slot = (slot + 1U) & mask) {
+                const index_value_type entry = index[slot];
+                if (entry == empty_slot<index_value_type>) {
+                    return no_slot;
+                }
+                if (hashes_[entry] == hash_number &&
+                    key_equal_(values_[entry].first, key)) {
+                    return slot;
+                }
+            }
+        });
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    auto try_get_impl(const KeyLike& key) -> mapped_type* {
+        const size_type slot = find_slot(key, hash_(key));
+        if (slot == no_slot) {
+            return nullptr;
+        }
+        return &values_[entry_at(slot)].second;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto try_get_impl(const KeyLike& key) const
+        -> const mapped_type* {
+        const size_type slot = find_slot(key, hash_(key));
+        if (slot == no_slot) {
+            return nullptr;
+        }
+        return &values_[entry_at(slot)].second;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * The last value is moved to the position of the deleted value. The index
+     * is changed only after the value is moved, so an exception in the move
+     * leaves the index consistent with the values.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike>
+    auto erase_impl(const KeyLike& key) -> bool {
+        const size_type slot = find_slot(key, hash_(key));
+        if (slot == no_slot) {
+            return false;
+        }
+        const size_type entry = entry_at(slot);
+        const size_type last = values_.size() - 1U;
+        if (entry != last) {
+            values_[entry] = std::move(values_[last]);
+        }
+        remove_slot(slot);
+        if (entry != last) {
+            move_in_index(last, entry);
+            hashes_[entry] = hashes_[last];
+        }
+        values_.pop_back();
+        hashes_.pop_back();
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value of a new key.
+     *
+     * \tparam Args Type of arguments of the constructor of the value.
+     * \param[in] hash_number Hash number of the key.
+     * \param[in] args Arguments of the constructor of the value.
+     * \return Inserted value.
+     */
+    template <typename... Args>
+    auto emplace_new(size_type hash_number, Args&&... args) -> value_type& {
+        if (values_.size() >= max_size()) {
+            throw std::length_error("Too many values.");
+        }
+        const size_type num_slots = required_num_slots(values_.size() + 1U);
+        if (num_slots > num_slots_) {
+            rebuild_index(num_slots);
+        }
+        hashes_.push_back(hash_number);
+        try {
+            values_.emplace_back(std::forward<Args>(args)...);
+        } catch (...) {
+            hashes_.pop_back();
+            throw;
+        }
+        place_in_index(values_.size() - 1U);
+        return values_.back();
+    }
+
+    /*!
+     * \brief Place a value in the index.
+     *
+     * \param[in] entry Position of the value.
+     */
+    void place_in_index(size_type entry) noexcept {
+        visit_index([this, entry](auto& index) {
+            using index_value_type =
+                typename std::decay_t<decltype(index)>::value_type;
+            const size_type mask = num_slots_ - 1U;
+            size_type slot = hashes_[entry] & mask;
+            while (index[slot] != empty_slot<index_value_type>) {
+                slot = (slot + 1U) & mask;
+            }
+            index[slot] = static_cast<index_value_type>(entry);
+        });
+    }
+
+    /*!
+     * \brief Change the position of a value in the index.
+     *
+     * \param[in] from Current position of the value.
+     * \param[in] to New position of the value.
+     */
+    void move_in_index(size_type from, size_type to) noexcept {
+        visit_index([this, from, to](auto& index) {
+            using index_value_type =
+                typename std::decay_t<decltype(index)>::value_type;
+            const size_type mask = num_slots_ - 1U;
+            size_type slot = hashes_[from] & mask;
+            while (index[slot] != static_cast<index_value_type>(from)) {
+                slot = (slot + 1U) & mask;
+            }
+            index[slot] = static_cast<index_value_type>(to);
+        });
+    }
+
+    /*!
+     * \brief Remove a slot from the index.
+     *
+     * Following slots are shifted backward so that searches need no marks
+     * of deleted slots.
+     *
+     * \param[in] slot Slot.
+     */
+    void remove_slot(size_type slot) noexcept {
+        visit_index([this, slot](auto& index) {
+            using index_value_type =
+                typename std::decay_t<decltype(index)>::value_type;
+            const size_type mask = num_slots_ - 1U;
+            size_type hole = slot;
+            for (size_type next = (hole + 1U) & mask;
+                 index[next] != empty_slot<index_value_type>;
+                 next = (next + 1U) & mask) {
+                const size_type home = hashes_[index[next]] & mask;
+                // Values whose home slots lie in (hole, next] must stay.
+                if (((next - home) & mask) < ((next - hole) & mask)) {
+                    continue;
+                }
+                index[hole] = index[next];
+                hole = next;
+            }
+            index[hole] = empty_slot<index_value_type>;
+        });
+    }
+
+    /*!
+     * \brief Fill the index with empty slots.
+     */
+    void clear_index() noexcept {
+        visit_index([](auto& index) {
+            using index_value_type =
+                typename std::decay_t<decltype(index)>::value_type;
+            std::fill(index.begin(), index.end(),
+                empty_slot<index_value_type>);
+        });
+    }
+
+    /*!
+     * \brief Rebuild the index with a number of slots.
+     *
+     * \param[in] num_slots Number of slots. (Must be a power of two.)
+     */
+    void rebuild_index(size_type num_slots) {
+        short_index_type short_index(short_index_.get_allocator());
+        long_index_type long_index(long_index_.get_allocator());
+        if (num_slots <= max_num_short_index_slots) {
+            short_index.assign(num_slots, empty_slot<std::uint16_t>);
+        } else {
+            long_index.assign(num_slots, empty_slot<std::uint32_t>);
+        }
+        short_index_ = std::move(short_index);
+        long_index_ = std::move(long_index);
+        num_slots_ = num_slots;
+        for (size_type i = 0; i < values_.size(); ++i) {
+            place_in_index(i);
+        }
+    }
+
+    /*!
+     * \brief Calculate the number of slots required for a number of values.
+     *
+     * \param[in] num_values Number of values.
+     * \return Number of slots.
+     */
+    [[nodiscard]] auto required_num_slots(size_type num_values) const
+        -> size_type {
+        size_type num_slots = 2U;
+        while (static_cast<float>(num_values) >
+                static_cast<float>(num_slots) * max_load_factor_ ||
+            num_values >= num_slots) {
+            num_slots *= 2U;
+        }
+        return num_slots;
+    }
+
+    /*!
+     * \brief Move a value kept in erase_if function to its new position.
+     *
+     * \param[in] from Current position.
+     * \param[in] to New position.
+     */
+    void keep_at(size_type from, size_type to) {
+        if (from != to) {
+            values_[to] = std::move(values_[from]);
+            hashes_[to] = hashes_[from];
+        }
+    }
+
+    /*!
+     * \brief Remove values after a number of values and rebuild the index
+     * without changing the number of slots.
+     *
+     * \param[in] num_values Number of remaining values.
+     */
+    void truncate_and_reindex(size_type num_values) {
+        const auto offset = static_cast<std::ptrdiff_t>(num_values);
+        values_.erase(values_.begin() + offset, values_.end());
+        hashes_.erase(hashes_.begin() + offset, hashes_.end());
+        clear_index();
+        for (size_type i = 0; i < values_.size(); ++i) {
+            place_in_index(i);
+        }
+    }
+
+    //! Values in the order of insertion.
+    values_type values_;
+
+    //! Hash numbers of keys of values.
+    hashes_type hashes_;
+
+    //! Index using 16-bit integers. (Empty when not used.)
+    short_index_type short_index_;
+
+    //! Index using 32-bit integers. (Empty when not used.)
+    long_index_type long_index_;
+
+    //! Number of slots in the index.
+    size_type num_slots_{0};
+
+    //! Hash function.
+    hash_type hash_;
+
+    //! Function to check whether keys are equal.
+    key_equal_type key_equal_;
+
+    //! Maximum load factor.
+    float max_load_factor_{default_max_load_factor};
+};
+
+}  // namespace hash_tables::maps
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of lazy_value class.
+ */
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace hash_tables::maps::internal {
+
+/*!
+ * \brief Class of values constructed lazily using factory functions.
+ *
+ * Objects of this class are implicitly converted to values by calling the
+ * factory function. Passing an object of this class as an argument of a
+ * constructor in piecewise construction calls the factory function only when
+ * the value is actually constructed.
+ *
+ * \tparam Function Type of the factory function.
+ *
+ * \note Types with constructors accepting any types (for example,
+ * `std::any`) are constructed from objects of this class without calling
+ * factory functions, so don't use this class for such types.
+ */
+template <typename Function>
+class lazy_value {
+public:
+    //! Type of values.
+    using value_type = std::invoke_result_t<Function&&>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] function Factory function.
+     */
+    explicit lazy_value(Function&& function) noexcept
+        : function_(&function) {}
+
+    /*!
+     * \brief Construct the value.
+     *
+     * \return Value.
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+    operator value_type() const {
+        return std::invoke(std::forward<Function>(*function_));
+    }
+
+private:
+    //! Factory function.
+    std::remove_reference_t<Function>* function_;
+};
+
+}  // namespace hash_tables::maps::internal
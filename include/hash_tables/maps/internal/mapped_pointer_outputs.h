@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of mapped_pointer_outputs class.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace hash_tables::maps::internal {
+
+/*!
+ * \brief Class to write pointers of mapped values to a sequence of outputs
+ * given pointers of pairs.
+ *
+ * \tparam Outputs Type of the sequence of outputs.
+ */
+template <typename Outputs>
+class mapped_pointer_outputs {
+public:
+    /*!
+     * \brief Class of references to an output.
+     */
+    class reference {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] outputs Sequence of outputs.
+         * \param[in] index Index of the output.
+         */
+        reference(Outputs& outputs, std::size_t index) noexcept
+            : outputs_(&outputs), index_(index) {}
+
+        /*!
+         * \brief Assign a pointer of a pair.
+         *
+         * \tparam Pair Type of the pair.
+         * \param[in] pair Pointer of the pair. (Can be nullptr.)
+         * \return This.
+         */
+        template <typename Pair>
+        auto operator=(Pair* pair) -> reference& {
+            if (pair == nullptr) {
+                (*outputs_)[index_] = nullptr;
+            } else {
+                (*outputs_)[index_] = &pair->second;
+            }
+            return *this;
+        }
+
+    private:
+        //! Sequence of outputs.
+        Outputs* outputs_;
+
+        //! Index of the output.
+        std::size_t index_;
+    };
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] outputs Sequence of outputs.
+     */
+    explicit mapped_pointer_outputs(Outputs& outputs) noexcept
+        : outputs_(&outputs) {}
+
+    /*!
+     * \brief Access an output.
+     *
+     * \param[in] index Index of the output.
+     * \return Reference to the output.
+     */
+    [[nodiscard]] auto operator[](std::size_t index) const noexcept
+        -> reference {
+        return reference(*outputs_, index);
+    }
+
+private:
+    //! Sequence of outputs.
+    Outputs* outputs_;
+};
+
+}  // namespace hash_tables::maps::internal
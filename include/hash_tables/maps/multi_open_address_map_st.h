@@ -28,7 +28,11 @@
 
 #include "hash_tables/extract_key_functions/extract_first_from_pair.h"
 #include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/internal/lazy_value.h"
+#include "hash_tables/maps/internal/mapped_pointer_outputs.h"
 #include "hash_tables/tables/multi_open_address_table_st.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables/utility/is_transparent.h"
 
 namespace hash_tables::maps {
 
@@ -41,6 +45,9 @@ namespace hash_tables::maps {
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy of internal hash tables.
+ * (tables::policies::separate_values_policy keeps mapped values out of the
+ * probed nodes.)
  *
  * \thread_safety Safe if only functions without modifications of data are
  * called.
@@ -48,7 +55,8 @@ namespace hash_tables::maps {
 template <typename KeyType, typename MappedType,
     typename Hash = hashes::default_hash<KeyType>,
     typename KeyEqual = std::equal_to<KeyType>,
-    typename Allocator = std::allocator<std::pair<KeyType, MappedType>>>
+    typename Allocator = std::allocator<std::pair<KeyType, MappedType>>,
+    typename Policy = tables::policies::default_open_address_policy>
 class multi_open_address_map_st {
 public:
     //! Type of keys.
@@ -69,6 +77,9 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of internal hash tables.
+    using policy_type = Policy;
+
     //! Type of sizes.
     using size_type = std::size_t;
 
@@ -78,7 +89,20 @@ public:
 
     //! Type of the internal hash table.
     using table_type = tables::multi_open_address_table_st<value_type, key_type,
-        extract_key_type, hash_type, key_equal_type, allocator_type>;
+        extract_key_type, hash_type, key_equal_type, allocator_type,
+        tables::internal::multi_open_address_table_st_default_min_num_tables,
+        policy_type>;
+
+    //! Type of iterators.
+    //!
+    //! \warning Keys must not be changed through iterators.
+    using iterator = typename table_type::iterator;
+
+    //! Type of constant iterators.
+    using const_iterator = typename table_type::const_iterator;
+
+    //! Type of handles of values extracted from containers.
+    using node_handle_type = typename table_type::node_handle_type;
 
     /*!
      * \brief Constructor.
@@ -88,15 +112,18 @@ public:
      * \param[in] hash Hash function.
      * \param[in] key_equal Function to check whether keys are equal.
      * \param[in] allocator Allocator.
+     * \param[in] min_num_tables Minimum number of internal tables. (Rounded
+     * up to a power of two. Numbers less than 2 are replaced with 2.)
      */
     explicit multi_open_address_map_st(
         size_type min_internal_num_nodes =
             table_type::default_num_internal_nodes,
         hash_type hash = hash_type(),
         key_equal_type key_equal = key_equal_type(),
-        allocator_type allocator = allocator_type())
+        allocator_type allocator = allocator_type(),
+        size_type min_num_tables = table_type::default_min_num_tables)
         : table_(min_internal_num_nodes, extract_key_type(), hash, key_equal,
-              allocator) {}
+              allocator, min_num_tables) {}
 
     /*!
      * \brief Copy constructor.
@@ -105,6 +132,8 @@ public:
 
     /*!
      * \brief Move constructor.
+     *
+     * The object moved from can only be destroyed or assigned.
      */
     multi_open_address_map_st(multi_open_address_map_st&&)
 #ifndef HASH_TABLES_DOCUMENTATION
@@ -127,6 +156,8 @@ public:
     /*!
      * \brief Move assignment operator.
      *
+     * The object moved from can only be destroyed or assigned.
+     *
      * \return This.
      */
     auto operator=(multi_open_address_map_st&&)
@@ -160,6 +191,21 @@ public:
         return table_.insert(value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(value, hash_number);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -171,6 +217,33 @@ public:
         return table_.insert(std::move(value));
     }
 
+    /*!
+     * \brief Insert a value extracted from a map.
+     *
+     * \param[in,out] node Handle of the value. (Empty after this function if
+     * the value is inserted.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key or an empty
+     * handle.
+     */
+    auto insert(node_handle_type&& node) -> bool {
+        return table_.insert(std::move(node));
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(std::move(value), hash_number);
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -187,6 +260,27 @@ public:
             std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the hash
+     * number of the key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        return table_.emplace_with_hash(
+            key, hash_number, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -204,6 +298,72 @@ public:
             std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * The key is searched before any preparation for insertion, and the
+     * mapped value is constructed only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Reference to the inserted or existing mapped value, and whether
+     * the value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args)
+        -> std::pair<mapped_type&, bool> {
+        const auto [value, inserted] =
+            table_.try_emplace(key, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        return {value.second, inserted};
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * The key is searched before any preparation for insertion, and the key
+     * is moved only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Reference to the inserted or existing mapped value, and whether
+     * the value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(key_type&& key, Args&&... args)
+        -> std::pair<mapped_type&, bool> {
+        // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved): false positive
+        const auto [value, inserted] = table_.try_emplace(key,
+            std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {value.second, inserted};
+    }
+
+    /*!
+     * \brief Insert a value constructed using a factory function only if the
+     * key doesn't exist.
+     *
+     * The factory function is called only when the key doesn't exist, and
+     * the mapped value is constructed in place from its result.
+     *
+     * \tparam Function Type of the factory function.
+     * \param[in] key Key of the value.
+     * \param[in] function Factory function of the mapped value.
+     * \return Reference to the inserted or existing mapped value, and whether
+     * the value is inserted.
+     */
+    template <typename Function>
+    auto try_emplace_with_factory(const key_type& key, Function&& function)
+        -> std::pair<mapped_type&, bool> {
+        return try_emplace(key,
+            internal::lazy_value<Function>(std::forward<Function>(function)));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor if not exist,
      * or assign to an existing value.
@@ -260,6 +420,71 @@ public:
         return true;
     }
 
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the mapped
+     * value.
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        return table_.update(key, [&function](value_type& value) {
+            std::invoke(std::forward<Function>(function), value.second);
+        });
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The key is searched only once.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the mapped value.
+     * \param[in] function Function called with the reference to the existing
+     * mapped value.
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        const auto [value, inserted] =
+            table_.try_emplace(key, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(internal::lazy_value<Factory>(
+                    std::forward<Factory>(factory))));
+        if (!inserted) {
+            std::invoke(std::forward<Function>(function), value.second);
+        }
+        return inserted;
+    }
+
+    /*!
+     * \brief Move pairs from another map.
+     *
+     * Pairs with keys not in this map are moved to this map without
+     * calculating hash numbers again, and the other pairs remain in the other
+     * map.
+     *
+     * \param[in,out] other Map to move pairs from.
+     */
+    void merge(multi_open_address_map_st& other) { table_.merge(other.table_); }
+
+    /*!
+     * \brief Move pairs from another map.
+     *
+     * \param[in,out] other Map to move pairs from.
+     * \sa merge(multi_open_address_map_st&)
+     */
+    void merge(multi_open_address_map_st&& other) { merge(other); }
+
     ///@}
 
     /*!
@@ -277,6 +502,21 @@ public:
         return table_.at(key).second;
     }
 
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) -> mapped_type& {
+        return table_.at(key).second;
+    }
+
     /*!
      * \brief Get a value.
      *
@@ -287,6 +527,21 @@ public:
         return table_.at(key).second;
     }
 
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> const mapped_type& {
+        return table_.at(key).second;
+    }
+
     /*!
      * \brief Get a value constructing it if not found.
      *
@@ -304,6 +559,28 @@ public:
             .second;
     }
 
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Mapped value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    auto get_or_create(const KeyLike& key, Args&&... args) -> mapped_type& {
+        return table_
+            .get_or_create(key, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...))
+            .second;
+    }
+
     /*!
      * \brief Get a value constructing using a factory function if not found.
      *
@@ -316,10 +593,10 @@ public:
     auto get_or_create_with_factory(const key_type& key, Function&& function)
         -> mapped_type& {
         return table_
-            .get_or_create_with_factory(key,
-                [&key, &function] {
-                    return value_type(key, std::invoke(function));
-                })
+            .get_or_create(key, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(internal::lazy_value<Function>(
+                    std::forward<Function>(function))))
             .second;
     }
 
@@ -358,6 +635,43 @@ public:
         return &value->second;
     }
 
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    auto try_get_with_hash(
+        const key_type& key, size_type hash_number) -> mapped_type* {
+        auto* value = table_.try_get_with_hash(key, hash_number);
+        if (value == nullptr) {
+            return nullptr;
+        }
+        return &value->second;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto try_get(const KeyLike& key) -> mapped_type* {
+        auto* value = table_.try_get(key);
+        if (value == nullptr) {
+            return nullptr;
+        }
+        return &value->second;
+    }
+
     /*!
      * \brief Get a value if found.
      *
@@ -373,6 +687,45 @@ public:
         return &value->second;
     }
 
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) const
+        -> const mapped_type* {
+        const auto* value = table_.try_get_with_hash(key, hash_number);
+        if (value == nullptr) {
+            return nullptr;
+        }
+        return &value->second;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const
+        -> const mapped_type* {
+        const auto* value = table_.try_get(key);
+        if (value == nullptr) {
+            return nullptr;
+        }
+        return &value->second;
+    }
+
     /*!
      * \brief Check whether a key exists.
      *
@@ -384,6 +737,100 @@ public:
         return table_.has(key);
     }
 
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return table_.has_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return table_.has(key);
+    }
+
+    /*!
+     * \brief Get mapped values of multiple keys if found.
+     *
+     * Nodes of keys are prefetched in chunks before searching the keys.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of mapped values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the mapped values if found, otherwise
+     * nullptr. (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) {
+        table_.find_batch(keys,
+            internal::mapped_pointer_outputs<std::remove_reference_t<Outputs>>(
+                outputs));
+    }
+
+    /*!
+     * \brief Get mapped values of multiple keys if found.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of mapped values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the mapped values if found, otherwise
+     * nullptr. (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) const {
+        table_.find_batch(keys,
+            internal::mapped_pointer_outputs<std::remove_reference_t<Outputs>>(
+                outputs));
+    }
+
+    /*!
+     * \brief Check whether multiple keys exist.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from bool values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Whether the keys exist. (Written in the same order
+     * as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void has_batch(const Keys& keys, Outputs&& outputs) const {
+        table_.has_batch(keys, std::forward<Outputs>(outputs));
+    }
+
     /*!
      * \brief Call a function with all values.
      *
@@ -414,6 +861,109 @@ public:
 
     ///@}
 
+    /*!
+     * \name Iterate over values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() noexcept -> iterator { return table_.begin(); }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return table_.begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return table_.cbegin();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() noexcept -> iterator { return table_.end(); }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return table_.end();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return table_.cend();
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * Start with cursor 0 and pass the returned cursor to the next call until
+     * 0 is returned, so that all values can be visited in small steps.
+     * Values are visited exactly once if the map is not modified between
+     * calls. Otherwise, some values may be skipped or visited more than once.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items, Function&& function)
+        -> size_type {
+        return table_.scan(
+            cursor, max_items, [&function](value_type& value) {
+                std::invoke(function, static_cast<const key_type&>(value.first),
+                    static_cast<mapped_type&>(value.second));
+            });
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     * \sa scan(size_type, size_type, Function&&)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items,
+        Function&& function) const -> size_type {
+        return table_.scan(
+            cursor, max_items, [&function](const value_type& value) {
+                std::invoke(function, static_cast<const key_type&>(value.first),
+                    static_cast<const mapped_type&>(value.second));
+            });
+    }
+
+    ///@}
+
     /*!
      * \name Delete values.
      */
@@ -433,6 +983,44 @@ public:
      */
     auto erase(const key_type& key) -> bool { return table_.erase(key); }
 
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    [[nodiscard]] auto extract(const key_type& key) -> node_handle_type {
+        return table_.extract(key);
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        return table_.erase_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool { return table_.erase(key); }
+
     /*!
      * \brief Delete values which satisfy a condition.
      *
@@ -557,6 +1145,12 @@ public:
      */
     void reserve_approx(size_type size) { table_.reserve_approx(size); }
 
+    /*!
+     * \brief Decrease the number of nodes to the minimum number for the
+     * current values.
+     */
+    void shrink_to_fit() { table_.shrink_to_fit(); }
+
     ///@}
 
     /*!
@@ -591,6 +1185,15 @@ public:
         return table_.allocator();
     }
 
+    /*!
+     * \brief Get the number of internal tables.
+     *
+     * \return Number of internal tables.
+     */
+    [[nodiscard]] auto num_tables() const noexcept -> size_type {
+        return table_.num_tables();
+    }
+
     /*!
      * \brief Get the number of nodes.
      *
@@ -607,6 +1210,18 @@ public:
      */
     void max_load_factor(float value) { table_.max_load_factor(value); }
 
+    /*!
+     * \brief Set the minimum load factor (number of values / number of nodes).
+     *
+     * When the load factor becomes smaller than this value by deletion of
+     * values, the number of nodes is decreased. Zero (default) disables this
+     * behavior.
+     *
+     * \param[in] value Minimum load factor. (Must be smaller than the half of
+     * the maximum load factor.)
+     */
+    void min_load_factor(float value) { table_.min_load_factor(value); }
+
     ///@}
 
 private:
@@ -28,8 +28,11 @@
 
 #include "hash_tables/extract_key_functions/extract_first_from_pair.h"
 #include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/internal/lazy_value.h"
 #include "hash_tables/maps/internal/mapped_value_getter.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables/tables/separate_shared_chain_table_mt.h"
+#include "hash_tables/utility/is_transparent.h"
 
 namespace hash_tables::maps {
 
@@ -42,13 +45,15 @@ namespace hash_tables::maps {
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
+ * \tparam LockPolicy Type of the policy of locks of buckets.
  *
  * \thread_safety Safe even for the same object.
  */
 template <typename KeyType, typename MappedType,
     typename Hash = hashes::default_hash<KeyType>,
     typename KeyEqual = std::equal_to<KeyType>,
-    typename Allocator = std::allocator<std::pair<KeyType, MappedType>>>
+    typename Allocator = std::allocator<std::pair<KeyType, MappedType>>,
+    typename LockPolicy = tables::policies::mutex_lock_policy>
 class separate_shared_chain_map_mt {
 public:
     //! Type of keys.
@@ -69,6 +74,9 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of locks.
+    using lock_policy_type = LockPolicy;
+
     //! Type of sizes.
     using size_type = std::size_t;
 
@@ -78,7 +86,8 @@ public:
 
     //! Type of the internal hash table.
     using table_type = tables::separate_shared_chain_table_mt<value_type,
-        key_type, extract_key_type, hash_type, key_equal_type, allocator_type>;
+        key_type, extract_key_type, hash_type, key_equal_type, allocator_type,
+        lock_policy_type>;
 
     /*!
      * \brief Constructor.
@@ -126,6 +135,21 @@ public:
         return table_.insert(value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(value, hash_number);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -137,6 +161,20 @@ public:
         return table_.insert(std::move(value));
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(std::move(value), hash_number);
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -153,6 +191,27 @@ public:
             std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the hash
+     * number of the key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        return table_.emplace_with_hash(
+            key, hash_number, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -170,6 +229,67 @@ public:
             std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * The key is searched before any preparation for insertion, and the
+     * mapped value is constructed only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args) -> bool {
+        return table_.emplace(key, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * The key is searched before any preparation for insertion, and the key
+     * is moved only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto try_emplace(key_type&& key, Args&&... args) -> bool {
+        // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved): false positive
+        return table_.emplace(key, std::piecewise_construct,
+            std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /*!
+     * \brief Insert a value constructed using a factory function only if the
+     * key doesn't exist.
+     *
+     * The factory function is called only when the key doesn't exist, and
+     * the mapped value is constructed in place from its result.
+     *
+     * \tparam Function Type of the factory function.
+     * \param[in] key Key of the value.
+     * \param[in] function Factory function of the mapped value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename Function>
+    auto try_emplace_with_factory(const key_type& key, Function&& function)
+        -> bool {
+        return try_emplace(key,
+            internal::lazy_value<Function>(std::forward<Function>(function)));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor if not exist,
      * or assign to an existing value.
@@ -224,6 +344,56 @@ public:
             std::forward_as_tuple(std::forward<Args>(args)...));
     }
 
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the mapped
+     * value.
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        return table_.update(key, [&function](value_type& value) {
+            std::invoke(std::forward<Function>(function), value.second);
+        });
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the mapped value.
+     * \param[in] function Function called with the reference to the existing
+     * mapped value.
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        return table_.upsert(
+            key,
+            [&key, &factory] {
+                return value_type(
+                    key, std::invoke(std::forward<Factory>(factory)));
+            },
+            [&function](value_type& value) {
+                std::invoke(std::forward<Function>(function), value.second);
+            });
+    }
+
     ///@}
 
     /*!
@@ -243,6 +413,23 @@ public:
         return value.release();
     }
 
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> mapped_type {
+        internal::mapped_value_getter<mapped_type> value;
+        table_.get_to(value, key);
+        return value.release();
+    }
+
     /*!
      * \brief Get a value constructing it if not found.
      *
@@ -261,6 +448,29 @@ public:
         return value.release();
     }
 
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor of the mapped value.
+     * \param[in] key Key of the value.
+     * \param[in] args Arguments of the constructor of tha mapped value.
+     * \return Mapped value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> mapped_type {
+        internal::mapped_value_getter<mapped_type> value;
+        table_.get_or_create_to(value, key, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return value.release();
+    }
+
     /*!
      * \brief Get a value constructing using a factory function if not found.
      *
@@ -273,9 +483,10 @@ public:
     [[nodiscard]] auto get_or_create_with_factory(
         const key_type& key, Function&& function) -> mapped_type {
         internal::mapped_value_getter<mapped_type> value;
-        table_.get_or_create_with_factory_to(value, key, [&key, &function] {
-            return value_type(key, std::invoke(function));
-        });
+        table_.get_or_create_to(value, key, std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(internal::lazy_value<Function>(
+                std::forward<Function>(function))));
         return value.release();
     }
 
@@ -304,6 +515,45 @@ public:
         return std::nullopt;
     }
 
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Value if found, otherwise null.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) const
+        -> std::optional<mapped_type> {
+        internal::mapped_value_getter<mapped_type> value;
+        if (table_.try_get_to_with_hash(value, key, hash_number)) {
+            return value.release();
+        }
+        return std::nullopt;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value if found, otherwise null.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const
+        -> std::optional<mapped_type> {
+        internal::mapped_value_getter<mapped_type> value;
+        if (table_.try_get_to(value, key)) {
+            return value.release();
+        }
+        return std::nullopt;
+    }
+
     /*!
      * \brief Check whether a key exists.
      *
@@ -315,6 +565,37 @@ public:
         return table_.has(key);
     }
 
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return table_.has_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return table_.has(key);
+    }
+
     /*!
      * \brief Call a function with all values.
      *
@@ -364,6 +645,34 @@ public:
      */
     auto erase(const key_type& key) -> bool { return table_.erase(key); }
 
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        return table_.erase_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool { return table_.erase(key); }
+
     /*!
      * \brief Delete values which satisfy a condition.
      *
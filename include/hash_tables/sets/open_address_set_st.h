@@ -26,7 +26,10 @@
 
 #include "hash_tables/extract_key_functions/identity.h"
 #include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
+#include "hash_tables/tables/small_open_address_table_st.h"
+#include "hash_tables/utility/is_transparent.h"
 
 namespace hash_tables::sets {
 
@@ -37,10 +40,15 @@ namespace hash_tables::sets {
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy of the internal hash table.
+ * (tables::policies::small_table_policy selects
+ * tables::small_open_address_table_st to store a small number of values
+ * without allocation of memory.)
  */
 template <typename KeyType, typename Hash = hashes::default_hash<KeyType>,
     typename KeyEqual = std::equal_to<KeyType>,
-    typename Allocator = std::allocator<KeyType>>
+    typename Allocator = std::allocator<KeyType>,
+    typename Policy = tables::policies::default_open_address_policy>
 class open_address_set_st {
 public:
     //! Type of keys.
@@ -58,6 +66,9 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of the internal hash table.
+    using policy_type = Policy;
+
     //! Type of sizes.
     using size_type = std::size_t;
 
@@ -65,8 +76,19 @@ public:
     using extract_key_type = extract_key_functions::identity<value_type>;
 
     //! Type of the internal hash table.
-    using table_type = tables::open_address_table_st<value_type, key_type,
-        extract_key_type, hash_type, key_equal_type, allocator_type>;
+    using table_type =
+        tables::internal::open_address_table_for_policy_t<value_type,
+            key_type, extract_key_type, hash_type, key_equal_type,
+            allocator_type, policy_type>;
+
+    //! Type of iterators. (Values cannot be changed through iterators.)
+    using iterator = typename table_type::const_iterator;
+
+    //! Type of constant iterators.
+    using const_iterator = typename table_type::const_iterator;
+
+    //! Type of handles of values extracted from containers.
+    using node_handle_type = typename table_type::node_handle_type;
 
     /*!
      * \brief Constructor.
@@ -149,6 +171,21 @@ public:
         return table_.insert(value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(value, hash_number);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -160,6 +197,33 @@ public:
         return table_.insert(std::move(value));
     }
 
+    /*!
+     * \brief Insert a value extracted from a set.
+     *
+     * \param[in,out] node Handle of the value. (Empty after this function if
+     * the value is inserted.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key or an empty
+     * handle.
+     */
+    auto insert(node_handle_type&& node) -> bool {
+        return table_.insert(std::move(node));
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return table_.insert_with_hash(std::move(value), hash_number);
+    }
+
     ///@}
 
     /*!
@@ -178,6 +242,37 @@ public:
         return table_.has(key);
     }
 
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return table_.has_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return table_.has(key);
+    }
+
     /*!
      * \brief Call a function with all values.
      *
@@ -191,6 +286,70 @@ public:
 
     ///@}
 
+    /*!
+     * \name Iterate over values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return table_.begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return table_.cbegin();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return table_.end();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return table_.cend();
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * Start with cursor 0 and pass the returned cursor to the next call until
+     * 0 is returned, so that all values can be visited in small steps.
+     * Values are visited exactly once if the set is not modified between
+     * calls. Otherwise, some values may be skipped or visited more than once.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items,
+        Function&& function) const -> size_type {
+        return table_.scan(cursor, max_items, function);
+    }
+
+    ///@}
+
     /*!
      * \name Delete values.
      */
@@ -210,6 +369,44 @@ public:
      */
     auto erase(const key_type& key) -> bool { return table_.erase(key); }
 
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    [[nodiscard]] auto extract(const key_type& key) -> node_handle_type {
+        return table_.extract(key);
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        return table_.erase_with_hash(key, hash_number);
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool { return table_.erase(key); }
+
     /*!
      * \brief Delete values which satisfy a condition.
      *
@@ -284,6 +481,16 @@ public:
         other.for_all([this](const value_type& value) { this->insert(value); });
     }
 
+    /*!
+     * \brief Merge another set moving its values.
+     *
+     * Values not in this set are moved to this set without calculating hash
+     * numbers again, and the other values remain in the other set.
+     *
+     * \param[in,out] other Set to merge.
+     */
+    void merge(open_address_set_st&& other) { table_.merge(other.table_); }
+
     /*!
      * \brief Merge another set.
      *
@@ -400,6 +607,12 @@ public:
      */
     void reserve(size_type size) { table_.reserve(size); }
 
+    /*!
+     * \brief Decrease the number of nodes to the minimum number for the
+     * current values.
+     */
+    void shrink_to_fit() { table_.shrink_to_fit(); }
+
     ///@}
 
     /*!
@@ -450,6 +663,12 @@ public:
      */
     void rehash(size_type min_num_node) { table_.rehash(min_num_node); }
 
+    /*!
+     * \brief Remove marks of erased values (tombstones) rebuilding nodes
+     * without changing the number of nodes.
+     */
+    void compact() { table_.compact(); }
+
     /*!
      * \brief Get the load factor (number of values / number of nodes).
      *
@@ -471,6 +690,61 @@ public:
      */
     void max_load_factor(float value) { table_.max_load_factor(value); }
 
+    /*!
+     * \brief Get the minimum load factor (number of values / number of nodes).
+     *
+     * \return Minimum load factor.
+     */
+    auto min_load_factor() -> float { return table_.min_load_factor(); }
+
+    /*!
+     * \brief Set the minimum load factor (number of values / number of nodes).
+     *
+     * When the load factor becomes smaller than this value by deletion of
+     * values, the number of nodes is decreased. Zero (default) disables this
+     * behavior.
+     *
+     * \param[in] value Minimum load factor. (Must be smaller than the half of
+     * the maximum load factor.)
+     */
+    void min_load_factor(float value) { table_.min_load_factor(value); }
+
+    /*!
+     * \brief Get the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing.
+     *
+     * \return Number of nodes. (Zero if incremental rehashing is disabled.)
+     */
+    [[nodiscard]] auto incremental_rehash_step() const noexcept -> size_type {
+        return table_.incremental_rehash_step();
+    }
+
+    /*!
+     * \brief Set the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing.
+     *
+     * When this value is positive, values are moved to new nodes gradually in
+     * insertions and deletions instead of at once when the number of nodes is
+     * increased, so that the time of each insertion is bounded. Zero (default)
+     * disables incremental rehashing.
+     *
+     * \param[in] value Number of nodes.
+     * \sa tables::open_address_table_st::incremental_rehash_step(size_type)
+     */
+    void incremental_rehash_step(size_type value) {
+        table_.incremental_rehash_step(value);
+    }
+
+    /*!
+     * \brief Check whether incremental rehashing is in progress.
+     *
+     * \retval true Some values are left in old nodes.
+     * \retval false No value is left in old nodes.
+     */
+    [[nodiscard]] auto is_rehashing() const noexcept -> bool {
+        return table_.is_rehashing();
+    }
+
     ///@}
 
 private:
@@ -0,0 +1,1415 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of group_probing_table_st class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>  // IWYU pragma: keep
+#include <utility>
+#include <vector>
+
+#include "hash_tables/exceptions.h"
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/internal/control_byte_group.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/move_if_nothrow_move_constructible.h"
+#include "hash_tables/utility/multiply_high.h"
+#include "hash_tables/utility/round_up_to_power_of_two.h"
+#include "hash_tables/utility/value_storage.h"
+
+namespace hash_tables::tables {
+
+/*!
+ * \brief Class of hash tables using open addressing with probing of groups of
+ * nodes.
+ *
+ * This class keeps a separate array of control bytes, each holding the state
+ * of a node and a 7-bit fragment of the hash number of its key. Nodes are
+ * probed 16 nodes at a time comparing control bytes (using SSE2 instructions
+ * if available), so values are accessed only when fragments of hash numbers
+ * match. Hash numbers are mixed before they are split into fragments and
+ * group indices, so that hash functions with weak bits (for example, identity
+ * functions of integers) don't put many keys in a group.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ *
+ * \thread_safety Safe if only functions without modifications of data are
+ * called.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash = hashes::default_hash<KeyType>,
+    typename KeyEqual = std::equal_to<KeyType>,
+    typename Allocator = std::allocator<ValueType>>
+class group_probing_table_st {
+public:
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of keys.
+    using key_type = KeyType;
+
+    //! Type of the function to extract keys from values.
+    using extract_key_type = ExtractKey;
+
+    //! Type of the hash function.
+    using hash_type = Hash;
+
+    //! Type of the function to check whether keys are equal.
+    using key_equal_type = KeyEqual;
+
+    //! Type of allocators.
+    using allocator_type = Allocator;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    //! Default number of nodes.
+    static constexpr size_type default_num_nodes = 32;
+
+    //! Number of nodes in a group.
+    static constexpr size_type group_size = internal::control_byte_group_size;
+
+    /*!
+     * \brief Constructor.
+     */
+    group_probing_table_st() : group_probing_table_st(default_num_nodes) {}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] min_num_nodes Minimum number of nodes.
+     * \param[in] extract_key Function to extract keys from values.
+     * \param[in] hash Hash function.
+     * \param[in] key_equal Function to check whether keys are equal.
+     * \param[in] allocator Allocator.
+     */
+    explicit group_probing_table_st(size_type min_num_nodes,
+        extract_key_type extract_key = extract_key_type(),
+        hash_type hash = hash_type(),
+        key_equal_type key_equal = key_equal_type(),
+        allocator_type allocator = allocator_type())
+        : control_bytes_(determine_num_node_from_min_num_node(min_num_nodes),
+              internal::control_byte_empty,
+              control_byte_allocator_type(allocator)),
+          storages_(control_bytes_.size(), storage_allocator_type(allocator)),
+          extract_key_(std::move(extract_key)),
+          hash_(std::move(hash)),
+          key_equal_(std::move(key_equal)),
+          group_ind_mask_(control_bytes_.size() / group_size - 1U) {}
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \param[in] other Another object to copy from.
+     */
+    group_probing_table_st(const group_probing_table_st& other)
+        : control_bytes_(other.control_bytes_.size(),
+              internal::control_byte_empty,
+              other.control_bytes_.get_allocator()),
+          storages_(other.storages_.size(), other.storages_.get_allocator()),
+          extract_key_(other.extract_key_),
+          hash_(other.hash_),
+          key_equal_(other.key_equal_),
+          max_load_factor_(other.max_load_factor_),
+          group_ind_mask_(other.group_ind_mask_) {
+        try {
+            for (size_type i = 0; i < control_bytes_.size(); ++i) {
+                if (is_filled(other.control_bytes_[i])) {
+                    storages_[i].emplace(other.storages_[i].get());
+                    ++size_;
+                }
+                control_bytes_[i] = other.control_bytes_[i];
+            }
+        } catch (...) {
+            destroy_values();
+            throw;
+        }
+        num_erased_ = other.num_erased_;
+    }
+
+    /*!
+     * \brief Move constructor.
+     *
+     * \param[in] other Another object to move from.
+     */
+    group_probing_table_st(group_probing_table_st&& other)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_constructible_v<extract_key_type> &&  //
+            std::is_nothrow_move_constructible_v<hash_type> &&              //
+            std::is_nothrow_move_constructible_v<key_equal_type> &&         //
+            std::is_nothrow_move_constructible_v<control_bytes_type> &&     //
+            std::is_nothrow_move_constructible_v<storages_type>)
+#endif
+        : control_bytes_(std::move(other.control_bytes_)),
+          storages_(std::move(other.storages_)),
+          size_(other.size_),
+          num_erased_(other.num_erased_),
+          extract_key_(std::move(other.extract_key_)),
+          hash_(std::move(other.hash_)),
+          key_equal_(std::move(other.key_equal_)),
+          max_load_factor_(other.max_load_factor_),
+          group_ind_mask_(other.group_ind_mask_) {
+        other.control_bytes_.clear();
+        other.storages_.clear();
+        other.size_ = 0;
+        other.num_erased_ = 0;
+    }
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * \param[in] other Another object to copy from.
+     * \return This.
+     */
+    auto operator=(const group_probing_table_st& other)
+        -> group_probing_table_st& {
+        if (this != &other) {
+            *this = group_probing_table_st(other);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param[in] other Another object to move from.
+     * \return This.
+     */
+    auto operator=(group_probing_table_st&& other)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_assignable_v<extract_key_type> &&  //
+            std::is_nothrow_move_assignable_v<hash_type> &&              //
+            std::is_nothrow_move_assignable_v<key_equal_type> &&         //
+            std::is_nothrow_move_assignable_v<control_bytes_type> &&     //
+            std::is_nothrow_move_assignable_v<storages_type>)
+#endif
+            -> group_probing_table_st& {
+        if (this != &other) {
+            destroy_values();
+            control_bytes_ = std::move(other.control_bytes_);
+            storages_ = std::move(other.storages_);
+            size_ = other.size_;
+            num_erased_ = other.num_erased_;
+            extract_key_ = std::move(other.extract_key_);
+            hash_ = std::move(other.hash_);
+            key_equal_ = std::move(other.key_equal_);
+            max_load_factor_ = other.max_load_factor_;
+            group_ind_mask_ = other.group_ind_mask_;
+            other.control_bytes_.clear();
+            other.storages_.clear();
+            other.size_ = 0;
+            other.num_erased_ = 0;
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Destructor.
+     */
+    ~group_probing_table_st() noexcept { destroy_values(); }
+
+    /*!
+     * \name Create or update values.
+     */
+    ///@{
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(const value_type& value) -> bool {
+        return emplace(extract_key_(value), value);
+    }
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(value_type&& value) -> bool {
+        return emplace(extract_key_(value), std::move(value));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace(const key_type& key, Args&&... args) -> bool {
+        return emplace_with_hash(key, hash_(key), std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(const value_type& value, size_type hash_number)
+        -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the
+     * hash number of its key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        prepare_for_insertion();
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (found) {
+            return false;
+        }
+        construct_at(node_ind, hash_number, std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor if not exist,
+     * or assign to an existing value.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is assigned to an existing value.
+     */
+    template <typename... Args>
+    auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
+        prepare_for_insertion();
+        const size_type hash_number = hash_(key);
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (found) {
+            storages_[node_ind].get() =
+                value_type(std::forward<Args>(args)...);
+            return false;
+        }
+        construct_at(node_ind, hash_number, std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Assign a value to an existing key from the arguments of its
+     * constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is assigned.
+     * \retval false Value is not assigned due to non-existing key.
+     */
+    template <typename... Args>
+    auto assign(const key_type& key, Args&&... args) -> bool {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return false;
+        }
+        storages_[*node_ind].get() = value_type(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return false;
+        }
+        std::invoke(std::forward<Function>(function),
+            storages_[*node_ind].get());
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The key is searched only once.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        prepare_for_insertion();
+        const size_type hash_number = hash_(key);
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (found) {
+            std::invoke(
+                std::forward<Function>(function), storages_[node_ind].get());
+            return false;
+        }
+        construct_at(node_ind, hash_number,
+            std::invoke(std::forward<Factory>(factory)));
+        return true;
+    }
+
+    ///@}
+
+    /*!
+     * \name Read values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     */
+    [[nodiscard]] auto at(const key_type& key) -> value_type& {
+        return storages_[require_node_ind_for(key)].get();
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) -> value_type& {
+        return storages_[require_node_ind_for(key)].get();
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     */
+    [[nodiscard]] auto at(const key_type& key) const -> const value_type& {
+        return storages_[require_node_ind_for(key)].get();
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> const value_type& {
+        return storages_[require_node_ind_for(key)].get();
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename... Args>
+    [[nodiscard]] auto get_or_create(const key_type& key, Args&&... args)
+        -> value_type& {
+        prepare_for_insertion();
+        const size_type hash_number = hash_(key);
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (!found) {
+            construct_at(node_ind, hash_number, std::forward<Args>(args)...);
+        }
+        return storages_[node_ind].get();
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type& {
+        prepare_for_insertion();
+        const size_type hash_number = hash_(key);
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (!found) {
+            construct_at(node_ind, hash_number, std::forward<Args>(args)...);
+        }
+        return storages_[node_ind].get();
+    }
+
+    /*!
+     * \brief Get a value constructing using a factory function it if not found.
+     *
+     * \tparam Function Type of the factory function.
+     * \param[in] key Key.
+     * \param[in] function Factory function.
+     * \return Value.
+     */
+    template <typename Function>
+    [[nodiscard]] auto get_or_create_with_factory(
+        const key_type& key, Function&& function) -> value_type& {
+        prepare_for_insertion();
+        const size_type hash_number = hash_(key);
+        const auto [node_ind, found] = prepare_place_for(key, hash_number);
+        if (!found) {
+            construct_at(node_ind, hash_number,
+                std::invoke(std::forward<Function>(function)));
+        }
+        return storages_[node_ind].get();
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) -> value_type* {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) -> value_type* {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) const -> const value_type* {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const -> const value_type* {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has(const key_type& key) const -> bool {
+        return static_cast<bool>(find_node_ind_for(key));
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return static_cast<bool>(find_node_ind_for(key));
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) -> value_type* {
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(const key_type& key,
+        size_type hash_number) const -> const value_type* {
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (!node_ind) {
+            return nullptr;
+        }
+        return storages_[*node_ind].get_pointer();
+    }
+
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return static_cast<bool>(find_node_ind_for(key, hash_number));
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) {
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                std::invoke(
+                    function, static_cast<value_type&>(storages_[i].get()));
+            }
+        }
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) const {
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                std::invoke(function,
+                    static_cast<const value_type&>(storages_[i].get()));
+            }
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Delete values.
+     */
+    ///@{
+
+    /*!
+     * \brief Delete all values.
+     */
+    void clear() noexcept {
+        destroy_values();
+        std::fill(control_bytes_.begin(), control_bytes_.end(),
+            internal::control_byte_empty);
+        size_ = 0;
+        num_erased_ = 0;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase(const key_type& key) -> bool {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return false;
+        }
+        erase_at(*node_ind);
+        return true;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            return false;
+        }
+        erase_at(*node_ind);
+        return true;
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (!node_ind) {
+            return false;
+        }
+        erase_at(*node_ind);
+        return true;
+    }
+
+    /*!
+     * \brief Delete values which satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check the condition.
+     * \return Number of removed values.
+     */
+    template <typename Function>
+    auto erase_if(Function&& function) -> size_type {
+        size_type removed = 0;
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                if (std::invoke(function,
+                        static_cast<const value_type&>(storages_[i].get()))) {
+                    erase_at(i);
+                    ++removed;
+                }
+            }
+        }
+        return removed;
+    }
+
+    ///@}
+
+    /*!
+     * \name Check conditions for elements.
+     */
+    ///@{
+
+    /*!
+     * \brief Check whether all elements satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true All elements satisfied the condition.
+     * \retval false Some elements didn't satisfy the condition.
+     */
+    template <typename Function>
+    auto check_all_satisfy(Function&& function) const -> bool {
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                if (!std::invoke(function,
+                        static_cast<const value_type&>(storages_[i].get()))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * \brief Check whether at least one element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true At least one element satisfied the condition.
+     * \retval false No element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_any_satisfy(Function&& function) const -> bool {
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                if (std::invoke(function,
+                        static_cast<const value_type&>(storages_[i].get()))) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Check whether no element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true No element satisfied the condition.
+     * \retval false At least one element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_none_satisfy(Function&& function) const -> bool {
+        return !check_any_satisfy(std::forward<Function>(function));
+    }
+
+    ///@}
+
+    /*!
+     * \name Handle size.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the number of values.
+     *
+     * \return Number of values.
+     */
+    [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+    /*!
+     * \brief Check whether this object is empty.
+     *
+     * \retval true This object is empty.
+     * \retval false This object is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+    /*!
+     * \brief Get the maximum number of values.
+     *
+     * \return Maximum number of values.
+     */
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return storages_.max_size();
+    }
+
+    /*!
+     * \brief Reserve enough place for values.
+     *
+     * \param[in] size Number of values.
+     */
+    void reserve(size_type size) {
+        rehash(static_cast<size_type>(
+            std::ceil(static_cast<float>(size) / max_load_factor_)));
+    }
+
+    ///@}
+
+    /*!
+     * \name Access to internal information.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the function to extract keys from values.
+     *
+     * \return Function to extract keys from values.
+     */
+    [[nodiscard]] auto extract_key() const noexcept -> const extract_key_type& {
+        return extract_key_;
+    }
+
+    /*!
+     * \brief Get the hash function.
+     *
+     * \return Hash function.
+     */
+    [[nodiscard]] auto hash() const noexcept -> const hash_type& {
+        return hash_;
+    }
+
+    /*!
+     * \brief Get the function to check whether keys are equal.
+     *
+     * \return Function to check whether keys are equal.
+     */
+    [[nodiscard]] auto key_equal() const noexcept -> const key_equal_type& {
+        return key_equal_;
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto allocator() const -> allocator_type {
+        return allocator_type(storages_.get_allocator());
+    }
+
+    /*!
+     * \brief Get the number of nodes.
+     *
+     * \return Number of nodes.
+     */
+    [[nodiscard]] auto num_nodes() const noexcept -> size_type {
+        return control_bytes_.size();
+    }
+
+    /*!
+     * \brief Change the number of nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     */
+    void rehash(size_type min_num_node) {
+        if (min_num_node < control_bytes_.size()) {
+            return;
+        }
+        rehash_to(min_num_node);
+    }
+
+    /*!
+     * \brief Get the load factor (number of values / number of nodes).
+     *
+     * \return Load factor.
+     */
+    auto load_factor() -> float {
+        return static_cast<float>(size_) /
+            static_cast<float>(control_bytes_.size());
+    }
+
+    /*!
+     * \brief Get the maximum load factor (number of values / number of nodes).
+     *
+     * \return Maximum load factor.
+     */
+    auto max_load_factor() -> float { return max_load_factor_; }
+
+    /*!
+     * \brief Set the maximum load factor (number of values / number of nodes).
+     *
+     * \param[in] value Maximum load factor.
+     */
+    void max_load_factor(float value) {
+        if (value <= 0.0F || 1.0F <= value) {
+            throw std::invalid_argument("Invalid maximum load factor.");
+        }
+        max_load_factor_ = value;
+    }
+
+    ///@}
+
+private:
+    //! Type of storages of values.
+    using storage_type = utility::value_storage<value_type>;
+
+    //! Type of allocators for storages of values.
+    using storage_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<storage_type>;
+
+    //! Type of allocators for control bytes.
+    using control_byte_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<internal::control_byte>;
+
+    //! Type of the vector of control bytes.
+    using control_bytes_type =
+        std::vector<internal::control_byte, control_byte_allocator_type>;
+
+    //! Type of the vector of storages of values.
+    using storages_type = std::vector<storage_type, storage_allocator_type>;
+
+    //! Number of bits of fragments of hash numbers in control bytes.
+    static constexpr unsigned int fragment_bits = 7U;
+
+    //! Bit mask to get fragments of hash numbers in control bytes.
+    static constexpr size_type fragment_mask = (1U << fragment_bits) - 1U;
+
+    /*!
+     * \brief Determine the number of nodes from the minimum number of nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     * \return Number of nodes to use.
+     */
+    [[nodiscard]] static auto determine_num_node_from_min_num_node(
+        size_type min_num_node) -> size_type {
+        const size_type min_num_groups =
+            (min_num_node + group_size - 1U) / group_size;
+        size_type required_num_nodes =
+            utility::round_up_to_power_of_two(min_num_groups) * group_size;
+        if (required_num_nodes < default_num_nodes) {
+            required_num_nodes = default_num_nodes;
+        }
+        return required_num_nodes;
+    }
+
+    /*!
+     * \brief Check whether a control byte is of a filled node.
+     *
+     * \param[in] byte Control byte.
+     * \retval true The node is filled.
+     * \retval false The node is not filled.
+     */
+    [[nodiscard]] static auto is_filled(internal::control_byte byte) noexcept
+        -> bool {
+        return byte >= 0;
+    }
+
+    /*!
+     * \brief Mix bits of a hash number.
+     *
+     * This function folds the full product of the hash number and 2^N /
+     * golden ratio, so that every bit of the result depends on all bits of
+     * the hash number.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Mixed hash number.
+     */
+    [[nodiscard]] static auto mix_hash_number(size_type hash_number) noexcept
+        -> size_type {
+        constexpr size_type multiplier =
+            policies::internal::fibonacci_multiplier();
+        return (hash_number * multiplier) ^
+            utility::multiply_high(hash_number, multiplier);
+    }
+
+    /*!
+     * \brief Calculate the fragment of a hash number saved in control bytes.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Fragment.
+     */
+    [[nodiscard]] static auto fragment_of(size_type hash_number) noexcept
+        -> internal::control_byte {
+        return static_cast<internal::control_byte>(
+            mix_hash_number(hash_number) & fragment_mask);
+    }
+
+    /*!
+     * \brief Calculate the index of the group determined by a hash number.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Group index.
+     */
+    [[nodiscard]] auto desired_group_ind(size_type hash_number) const noexcept
+        -> size_type {
+        return (mix_hash_number(hash_number) >> fragment_bits) &
+            group_ind_mask_;
+    }
+
+    /*!
+     * \brief Load a group of control bytes.
+     *
+     * \param[in] group_ind Group index.
+     * \return Group.
+     */
+    [[nodiscard]] auto group_at(size_type group_ind) const noexcept
+        -> internal::control_byte_group {
+        return internal::control_byte_group(
+            control_bytes_.data() + group_ind * group_size);
+    }
+
+    /*!
+     * \name Internal functions to create or update values.
+     */
+    ///@{
+
+    /*!
+     * \brief Prepare the nodes for insertion of a value.
+     *
+     * This function increases the number of nodes or removes erased nodes when
+     * there are too many used nodes.
+     */
+    void prepare_for_insertion() {
+        const auto max_num_used_nodes = static_cast<size_type>(
+            static_cast<float>(control_bytes_.size()) * max_load_factor_);
+        if (size_ + num_erased_ + 1U <= max_num_used_nodes) {
+            return;
+        }
+        if (size_ + 1U <= max_num_used_nodes) {
+            // Same number of nodes, but without erased nodes.
+            rehash_to(control_bytes_.size());
+            return;
+        }
+        reserve(size_ + 1U);
+    }
+
+    /*!
+     * \brief Find the place to insert or assign a value.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key of the value.
+     * \param[in] hash_number Hash number of the key.
+     * \return Node index and whether the key was found.
+     */
+    template <typename KeyLike>
+    auto prepare_place_for(const KeyLike& key, size_type hash_number)
+        -> std::tuple<size_type, bool> {
+        const internal::control_byte fragment = fragment_of(hash_number);
+        size_type group_ind = desired_group_ind(hash_number);
+        std::optional<size_type> empty_place;
+        for (size_type step = 0; step <= group_ind_mask_;) {
+            const auto group = group_at(group_ind);
+            const size_type first_node_ind = group_ind * group_size;
+            for (auto mask = group.match(fragment); mask != 0U;
+                 mask &= mask - 1U) {
+                const size_type node_ind =
+                    first_node_ind + internal::lowest_bit_index(mask);
+                if (key_equal_(
+                        extract_key_(storages_[node_ind].get()), key)) {
+                    return {node_ind, true};
+                }
+            }
+            if (!empty_place) {
+                const auto empty_mask = group.match_empty_or_erased();
+                if (empty_mask != 0U) {
+                    empty_place.emplace(first_node_ind +
+                        internal::lowest_bit_index(empty_mask));
+                }
+            }
+            if (group.match_empty() != 0U) {
+                break;
+            }
+            ++step;
+            group_ind = (group_ind + step) & group_ind_mask_;
+        }
+        assert(empty_place);
+        // NOLINTNEXTLINE(bugprone-unchecked-optional-access): checked above.
+        return {*empty_place, false};
+    }
+
+    /*!
+     * \brief Construct a value in a node.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] node_ind Node index.
+     * \param[in] hash_number Hash number of the key of the value.
+     * \param[in] args Arguments of the constructor.
+     */
+    template <typename... Args>
+    void construct_at(
+        size_type node_ind, size_type hash_number, Args&&... args) {
+        storages_[node_ind].emplace(std::forward<Args>(args)...);
+        if (control_bytes_[node_ind] == internal::control_byte_erased) {
+            --num_erased_;
+        }
+        control_bytes_[node_ind] = fragment_of(hash_number);
+        ++size_;
+    }
+
+    /*!
+     * \brief Change the number of nodes, removing erased nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     */
+    void rehash_to(size_type min_num_node) {
+        group_probing_table_st new_table{
+            min_num_node, extract_key_, hash_, key_equal_, allocator()};
+        new_table.max_load_factor_ = max_load_factor_;
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                new_table.insert_without_rehash(
+                    utility::move_if_nothrow_move_constructible(
+                        storages_[i].get()));
+            }
+        }
+        *this = std::move(new_table);
+    }
+
+    /*!
+     * \brief Insert a value which doesn't exist in this table without changing
+     * the number of nodes.
+     *
+     * \tparam Value Type of the value.
+     * \param[in] value Value.
+     */
+    template <typename Value>
+    void insert_without_rehash(Value&& value) {
+        const size_type hash_number = hash_(extract_key_(value));
+        size_type group_ind = desired_group_ind(hash_number);
+        for (size_type step = 0;; ++step) {
+            const auto empty_mask =
+                group_at(group_ind).match_empty_or_erased();
+            if (empty_mask != 0U) {
+                const size_type node_ind = group_ind * group_size +
+                    internal::lowest_bit_index(empty_mask);
+                storages_[node_ind].emplace(std::forward<Value>(value));
+                control_bytes_[node_ind] = fragment_of(hash_number);
+                ++size_;
+                return;
+            }
+            group_ind = (group_ind + step + 1U) & group_ind_mask_;
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Internal functions to read values.
+     */
+    ///@{
+
+    /*!
+     * \brief Find a node index.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Node index. (Null if not found.)
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_node_ind_for(const KeyLike& key) const
+        -> std::optional<size_type> {
+        return find_node_ind_for(key, hash_(key));
+    }
+
+    /*!
+     * \brief Find a node index using the hash number of the key.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Node index. (Null if not found.)
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_node_ind_for(
+        const KeyLike& key, size_type hash_number) const
+        -> std::optional<size_type> {
+        const internal::control_byte fragment = fragment_of(hash_number);
+        size_type group_ind = desired_group_ind(hash_number);
+        for (size_type step = 0; step <= group_ind_mask_;) {
+            const auto group = group_at(group_ind);
+            const size_type first_node_ind = group_ind * group_size;
+            for (auto mask = group.match(fragment); mask != 0U;
+                 mask &= mask - 1U) {
+                const size_type node_ind =
+                    first_node_ind + internal::lowest_bit_index(mask);
+                if (key_equal_(
+                        extract_key_(storages_[node_ind].get()), key)) {
+                    return node_ind;
+                }
+            }
+            if (group.match_empty() != 0U) {
+                return std::nullopt;
+            }
+            ++step;
+            group_ind = (group_ind + step) & group_ind_mask_;
+        }
+        return std::nullopt;
+    }
+
+    /*!
+     * \brief Find a node index.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Node index.
+     * \throw std::out_of_range If not found.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto require_node_ind_for(const KeyLike& key) const
+        -> size_type {
+        const auto node_ind = find_node_ind_for(key);
+        if (!node_ind) {
+            throw key_not_found();
+        }
+        return *node_ind;
+    }
+
+    ///@}
+
+    /*!
+     * \name Internal functions to delete values.
+     */
+    ///@{
+
+    /*!
+     * \brief Delete a value in a node.
+     *
+     * \param[in] node_ind Node index.
+     */
+    void erase_at(size_type node_ind) noexcept {
+        storages_[node_ind].clear();
+        --size_;
+        // When the group has an empty node, no search has passed through the
+        // group, so the node can be empty instead of erased.
+        const size_type group_ind = node_ind / group_size;
+        if (group_at(group_ind).match_empty() != 0U) {
+            control_bytes_[node_ind] = internal::control_byte_empty;
+        } else {
+            control_bytes_[node_ind] = internal::control_byte_erased;
+            ++num_erased_;
+        }
+    }
+
+    /*!
+     * \brief Destroy all values without changing control bytes.
+     */
+    void destroy_values() noexcept {
+        for (size_type i = 0; i < control_bytes_.size(); ++i) {
+            if (is_filled(control_bytes_[i])) {
+                storages_[i].clear();
+            }
+        }
+    }
+
+    ///@}
+
+    //! Control bytes.
+    control_bytes_type control_bytes_;
+
+    //! Storages of values.
+    storages_type storages_;
+
+    //! Number of values.
+    size_type size_{0};
+
+    //! Number of erased nodes.
+    size_type num_erased_{0};
+
+    //! Function to extract keys from values.
+    extract_key_type extract_key_;
+
+    //! Hash function.
+    hash_type hash_;
+
+    //! Function to check whether keys are equal.
+    key_equal_type key_equal_;
+
+    //! Default maximum load factor.
+    static constexpr float default_max_load_factor = 0.875F;
+
+    //! Maximum load factor.
+    float max_load_factor_{default_max_load_factor};
+
+    //! Bit mask to get group index determined by hash number.
+    size_type group_ind_mask_{};
+};
+
+}  // namespace hash_tables::tables
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of classes of groups of control bytes.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(HASH_TABLES_DISABLE_SIMD) &&           \
+    (defined(__SSE2__) || defined(_M_X64) ||        \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && \
+    !defined(HASH_TABLES_DOCUMENTATION)
+#include <emmintrin.h>
+#define HASH_TABLES_USE_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "hash_tables/utility/count_right_zero_bits.h"
+
+namespace hash_tables::tables::internal {
+
+/*!
+ * \brief Type of control bytes.
+ *
+ * A control byte holds the state of a node. A filled node has the 7-bit
+ * fragment of the hash number of its key (0 to 127), and nodes without values
+ * have negative numbers.
+ */
+using control_byte = std::int8_t;
+
+//! Control byte of nodes which have never been filled.
+inline constexpr control_byte control_byte_empty = -128;
+
+//! Control byte of nodes which were once filled, but empty now.
+inline constexpr control_byte control_byte_erased = -2;
+
+//! Number of control bytes in a group.
+inline constexpr std::size_t control_byte_group_size = 16;
+
+//! Type of bit masks of positions in a group.
+using control_byte_mask = std::uint32_t;
+
+/*!
+ * \brief Get the index of the lowest set bit in a mask.
+ *
+ * \param[in] mask Mask. (Must not be zero.)
+ * \return Index.
+ */
+[[nodiscard]] inline auto lowest_bit_index(control_byte_mask mask) noexcept
+    -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+    unsigned long index = 0;  // NOLINT(google-runtime-int)
+    _BitScanForward(&index, mask);
+    return static_cast<std::size_t>(index);
+#else
+    return static_cast<std::size_t>(utility::count_right_zero_bits(mask));
+#endif
+}
+
+/*!
+ * \brief Class of groups of control bytes implemented without SIMD
+ * instructions.
+ */
+class scalar_control_byte_group {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] bytes Pointer to the first control byte in the group.
+     */
+    explicit scalar_control_byte_group(const control_byte* bytes) noexcept {
+        std::memcpy(bytes_, bytes, control_byte_group_size);
+    }
+
+    /*!
+     * \brief Get positions of control bytes equal to a fragment of a hash
+     * number.
+     *
+     * \param[in] fragment Fragment of a hash number.
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match(control_byte fragment) const noexcept
+        -> control_byte_mask {
+        control_byte_mask mask = 0U;
+        for (std::size_t i = 0; i < control_byte_group_size; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (bytes_[i] == fragment) {
+                mask |= static_cast<control_byte_mask>(1U) << i;
+            }
+        }
+        return mask;
+    }
+
+    /*!
+     * \brief Get positions of empty nodes.
+     *
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match_empty() const noexcept -> control_byte_mask {
+        return match(control_byte_empty);
+    }
+
+    /*!
+     * \brief Get positions of nodes without values.
+     *
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match_empty_or_erased() const noexcept
+        -> control_byte_mask {
+        control_byte_mask mask = 0U;
+        for (std::size_t i = 0; i < control_byte_group_size; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (bytes_[i] < 0) {
+                mask |= static_cast<control_byte_mask>(1U) << i;
+            }
+        }
+        return mask;
+    }
+
+private:
+    //! Control bytes.
+    control_byte bytes_[control_byte_group_size]{};  // NOLINT
+};
+
+#if defined(HASH_TABLES_USE_SSE2) || defined(HASH_TABLES_DOCUMENTATION)
+
+/*!
+ * \brief Class of groups of control bytes implemented with SSE2 instructions.
+ */
+class sse2_control_byte_group {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] bytes Pointer to the first control byte in the group.
+     */
+    explicit sse2_control_byte_group(const control_byte* bytes) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        : bytes_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))) {}
+
+    /*!
+     * \brief Get positions of control bytes equal to a fragment of a hash
+     * number.
+     *
+     * \param[in] fragment Fragment of a hash number.
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match(control_byte fragment) const noexcept
+        -> control_byte_mask {
+        return static_cast<control_byte_mask>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_set1_epi8(fragment), bytes_)));
+    }
+
+    /*!
+     * \brief Get positions of empty nodes.
+     *
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match_empty() const noexcept -> control_byte_mask {
+        return match(control_byte_empty);
+    }
+
+    /*!
+     * \brief Get positions of nodes without values.
+     *
+     * \return Bit mask of positions.
+     */
+    [[nodiscard]] auto match_empty_or_erased() const noexcept
+        -> control_byte_mask {
+        // Most significant bits are set only in negative control bytes.
+        return static_cast<control_byte_mask>(_mm_movemask_epi8(bytes_));
+    }
+
+private:
+    //! Control bytes.
+    __m128i bytes_;
+};
+
+/*!
+ * \brief Type of groups of control bytes used in hash tables.
+ */
+using control_byte_group = sse2_control_byte_group;
+
+#else
+
+/*!
+ * \brief Type of groups of control bytes used in hash tables.
+ */
+using control_byte_group = scalar_control_byte_group;
+
+#endif
+
+}  // namespace hash_tables::tables::internal
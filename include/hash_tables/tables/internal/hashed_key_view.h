@@ -87,13 +87,18 @@ public:
     //! Type of hash numbers.
     using hash_number_type = std::size_t;
 
+    //! Mark this class as transparent to allow views of other types of keys.
+    using is_transparent = void;
+
     /*!
      * \brief Calculate a hash number.
      *
+     * \tparam KeyLike Type of the key in the view.
      * \param[in] key Key.
      * \return Hash number.
      */
-    [[nodiscard]] auto operator()(const key_type& key) const {
+    template <typename KeyLike>
+    [[nodiscard]] auto operator()(const hashed_key_view<KeyLike>& key) const {
         return key.hash_number();
     }
 };
@@ -119,16 +124,22 @@ public:
     explicit hashed_key_view_equal(const ActualKeyEqual& key_equal)
         : key_equal_(key_equal) {}
 
+    //! Mark this class as transparent to allow views of other types of keys.
+    using is_transparent = void;
+
     /*!
      * \brief Compare two keys.
      *
+     * \tparam LeftKey Type of the left-hand-side key in the view.
+     * \tparam RightKey Type of the right-hand-side key in the view.
      * \param[in] left Left-hand-side key.
      * \param[in] right Right-hand-side key.
      * \retval true Two keys are equal.
      * \retval false Two keys are not equal.
      */
-    [[nodiscard]] auto operator()(
-        const key_type& left, const key_type& right) const {
+    template <typename LeftKey, typename RightKey>
+    [[nodiscard]] auto operator()(const hashed_key_view<LeftKey>& left,
+        const hashed_key_view<RightKey>& right) const {
         return left.hash_number() == right.hash_number() &&
             key_equal_(left.key(), right.key());
     }
@@ -0,0 +1,326 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of retaining_allocator class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace hash_tables::tables::internal {
+
+/*!
+ * \brief Class of pools of memory retained until destruction.
+ *
+ * Memory deallocated through retaining_allocator is kept in this pool and
+ * reused for later allocations of the same type and the same size instead of
+ * being released, so that threads reading the memory without locks never
+ * access released memory.
+ *
+ * \tparam Allocator Type of the allocator to allocate memory.
+ *
+ * \thread_safety Not safe. (Concurrent tables use pools only while they have
+ * exclusive locks of internal tables.)
+ */
+template <typename Allocator>
+class retained_memory_pool {
+public:
+    //! Type of the allocator.
+    using allocator_type = Allocator;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] allocator Allocator.
+     */
+    explicit retained_memory_pool(const allocator_type& allocator)
+        : allocator_(allocator) {}
+
+    retained_memory_pool(const retained_memory_pool&) = delete;
+    retained_memory_pool(retained_memory_pool&&) = delete;
+    auto operator=(const retained_memory_pool&) = delete;
+    auto operator=(retained_memory_pool&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * This releases all the memory retained in this pool.
+     */
+    ~retained_memory_pool() noexcept {
+        while (first_block_ != nullptr) {
+            void* block = first_block_;
+            const block_header header = read_header(block);
+            first_block_ = header.next;
+            header.release(allocator_, block, header.size);
+        }
+    }
+
+    /*!
+     * \brief Allocate memory.
+     *
+     * \tparam T Type of objects.
+     * \param[in] size Number of objects.
+     * \return Pointer to the allocated memory.
+     */
+    template <typename T>
+    [[nodiscard]] auto allocate(size_type size) -> T* {
+        const size_type actual_size = actual_size_of<T>(size);
+        void* previous_block = nullptr;
+        void* block = first_block_;
+        while (block != nullptr) {
+            const block_header header = read_header(block);
+            if (header.release == &release<T> && header.size == actual_size) {
+                if (previous_block == nullptr) {
+                    first_block_ = header.next;
+                } else {
+                    block_header previous_header = read_header(previous_block);
+                    previous_header.next = header.next;
+                    write_header(previous_block, previous_header);
+                }
+                return static_cast<T*>(block);
+            }
+            previous_block = block;
+            block = header.next;
+        }
+        rebind_allocator_type<T> allocator(allocator_);
+        return std::allocator_traits<rebind_allocator_type<T>>::allocate(
+            allocator, actual_size);
+    }
+
+    /*!
+     * \brief Deallocate memory keeping it in this pool.
+     *
+     * \tparam T Type of objects.
+     * \param[in] ptr Pointer to the memory.
+     * \param[in] size Number of objects.
+     */
+    template <typename T>
+    void deallocate(T* ptr, size_type size) noexcept {
+        write_header(static_cast<void*>(ptr),
+            block_header{first_block_, actual_size_of<T>(size), &release<T>});
+        first_block_ = static_cast<void*>(ptr);
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto allocator() const noexcept -> const allocator_type& {
+        return allocator_;
+    }
+
+private:
+    //! Type of allocators of objects.
+    template <typename T>
+    using rebind_allocator_type =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<
+            T>;
+
+    //! Type of functions to release memory.
+    using release_function_type = void (*)(
+        allocator_type&, void*, size_type) noexcept;
+
+    /*!
+     * \brief Struct of headers written at the beginning of retained memory.
+     */
+    struct block_header {
+        //! Next retained memory.
+        void* next;
+
+        //! Number of objects in the memory.
+        size_type size;
+
+        //! Function to release the memory.
+        release_function_type release;
+    };
+
+    /*!
+     * \brief Calculate the number of objects actually allocated.
+     *
+     * Memory is allocated so that it can hold a header when retained.
+     *
+     * \tparam T Type of objects.
+     * \param[in] size Number of objects requested.
+     * \return Number of objects actually allocated.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr auto actual_size_of(size_type size) noexcept
+        -> size_type {
+        constexpr size_type min_size =
+            (sizeof(block_header) + sizeof(T) - 1U) / sizeof(T);
+        return std::max(size, min_size);
+    }
+
+    /*!
+     * \brief Release memory.
+     *
+     * \tparam T Type of objects.
+     * \param[in] allocator Allocator.
+     * \param[in] ptr Pointer to the memory.
+     * \param[in] size Number of objects actually allocated.
+     */
+    template <typename T>
+    static void release(
+        allocator_type& allocator, void* ptr, size_type size) noexcept {
+        rebind_allocator_type<T> rebind_allocator(allocator);
+        std::allocator_traits<rebind_allocator_type<T>>::deallocate(
+            rebind_allocator, static_cast<T*>(ptr), size);
+    }
+
+    /*!
+     * \brief Read the header of retained memory.
+     *
+     * \param[in] block Retained memory.
+     * \return Header.
+     */
+    [[nodiscard]] static auto read_header(const void* block) noexcept
+        -> block_header {
+        block_header header{};
+        std::memcpy(&header, block, sizeof(header));
+        return header;
+    }
+
+    /*!
+     * \brief Write the header of retained memory.
+     *
+     * \param[in] block Retained memory.
+     * \param[in] header Header.
+     */
+    static void write_header(void* block, const block_header& header) noexcept {
+        std::memcpy(block, &header, sizeof(header));
+    }
+
+    //! Allocator.
+    allocator_type allocator_;
+
+    //! First retained memory. (Null if no memory is retained.)
+    void* first_block_{nullptr};
+};
+
+/*!
+ * \brief Class of allocators keeping deallocated memory in
+ * retained_memory_pool for reuse.
+ *
+ * \tparam T Type of objects.
+ * \tparam Allocator Type of the allocator used in the pool.
+ */
+template <typename T, typename Allocator>
+class retaining_allocator {
+public:
+    //! Type of objects.
+    using value_type = T;
+
+    //! Type of pools.
+    using pool_type = retained_memory_pool<Allocator>;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    //! Propagate this allocator in copy assignment of containers.
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    //! Propagate this allocator in move assignment of containers.
+    using propagate_on_container_move_assignment = std::true_type;
+
+    //! Propagate this allocator in swap of containers.
+    using propagate_on_container_swap = std::true_type;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] pool Pool of memory.
+     */
+    explicit retaining_allocator(pool_type& pool) noexcept : pool_(&pool) {}
+
+    /*!
+     * \brief Constructor to convert from an allocator of another type.
+     *
+     * \tparam U Type of objects in the allocator.
+     * \param[in] other Allocator.
+     */
+    template <typename U>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions): required by allocators
+    retaining_allocator(const retaining_allocator<U, Allocator>& other) noexcept
+        : pool_(&other.pool()) {}
+
+    /*!
+     * \brief Allocate memory.
+     *
+     * \param[in] size Number of objects.
+     * \return Pointer to the allocated memory.
+     */
+    [[nodiscard]] auto allocate(size_type size) -> T* {
+        return pool_->template allocate<T>(size);
+    }
+
+    /*!
+     * \brief Deallocate memory.
+     *
+     * \param[in] ptr Pointer to the memory.
+     * \param[in] size Number of objects.
+     */
+    void deallocate(T* ptr, size_type size) noexcept {
+        pool_->deallocate(ptr, size);
+    }
+
+    /*!
+     * \brief Get the pool.
+     *
+     * \return Pool.
+     */
+    [[nodiscard]] auto pool() const noexcept -> pool_type& { return *pool_; }
+
+    /*!
+     * \brief Compare with another allocator.
+     *
+     * \tparam U Type of objects in the other allocator.
+     * \param[in] right Right-hand-side allocator.
+     * \return Whether the allocators use the same pool.
+     */
+    template <typename U>
+    [[nodiscard]] auto operator==(
+        const retaining_allocator<U, Allocator>& right) const noexcept -> bool {
+        return pool_ == &right.pool();
+    }
+
+    /*!
+     * \brief Compare with another allocator.
+     *
+     * \tparam U Type of objects in the other allocator.
+     * \param[in] right Right-hand-side allocator.
+     * \return Whether the allocators use different pools.
+     */
+    template <typename U>
+    [[nodiscard]] auto operator!=(
+        const retaining_allocator<U, Allocator>& right) const noexcept -> bool {
+        return !operator==(right);
+    }
+
+private:
+    //! Pool.
+    pool_type* pool_;
+};
+
+}  // namespace hash_tables::tables::internal
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of policies of locks in concurrent hash tables.
+ */
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+
+#include "hash_tables/utility/adaptive_mutex.h"
+#include "hash_tables/utility/sequence_mutex.h"
+#include "hash_tables/utility/shared_spin_mutex.h"
+#include "hash_tables/utility/spin_mutex.h"
+
+namespace hash_tables::tables::policies {
+
+/*!
+ * \brief Policy to lock internal tables using std::mutex for both reading
+ * and writing.
+ */
+struct mutex_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = std::mutex;
+
+    //! Type of locks to read values.
+    using shared_lock_type = std::unique_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = false;
+};
+
+/*!
+ * \brief Policy to lock internal tables using std::shared_mutex so that
+ * threads reading values don't wait for each other.
+ */
+struct shared_mutex_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = std::shared_mutex;
+
+    //! Type of locks to read values.
+    using shared_lock_type = std::shared_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = false;
+};
+
+/*!
+ * \brief Policy to lock internal tables using utility::spin_mutex for both
+ * reading and writing.
+ *
+ * Waiting threads keep using processors, so this policy is suitable only when
+ * threads are fewer than processors.
+ */
+struct spin_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = utility::spin_mutex;
+
+    //! Type of locks to read values.
+    using shared_lock_type = std::unique_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = false;
+};
+
+/*!
+ * \brief Policy to lock internal tables using utility::adaptive_mutex for
+ * both reading and writing.
+ *
+ * Waiting threads spin for a while and then sleep, so that this policy works
+ * well both for short critical sections and when threads are more than
+ * processors.
+ */
+struct adaptive_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = utility::adaptive_mutex;
+
+    //! Type of locks to read values.
+    using shared_lock_type = std::unique_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = false;
+};
+
+/*!
+ * \brief Policy to lock internal tables using utility::shared_spin_mutex so
+ * that threads reading values don't wait for each other.
+ *
+ * Waiting threads keep using processors, so this policy is suitable only when
+ * threads are fewer than processors.
+ */
+struct shared_spin_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = utility::shared_spin_mutex;
+
+    //! Type of locks to read values.
+    using shared_lock_type = std::shared_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = false;
+};
+
+/*!
+ * \brief Policy to read values without locks using utility::sequence_mutex
+ * (sequence locks).
+ *
+ * Threads reading values copy them without writing to memory shared with
+ * other threads, and retry when other threads modified the internal table
+ * meanwhile. After max_optimistic_read_trials failures, values are read
+ * with shared locks, which exclude only threads modifying values.
+ *
+ * This policy can be used only for values which are trivially copy
+ * constructible and trivially destructible. Memory of nodes released in
+ * rehashing is kept for reuse until destruction of tables, so that threads
+ * reading values never access released memory.
+ */
+struct optimistic_read_lock_policy {
+    //! Type of mutexes.
+    using mutex_type = utility::sequence_mutex;
+
+    //! Type of locks to read values when optimistic reads failed.
+    using shared_lock_type = std::shared_lock<mutex_type>;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = std::unique_lock<mutex_type>;
+
+    //! Whether to read values without locks.
+    static constexpr bool optimistic_read = true;
+
+    //! Maximum number of trials to read values without locks.
+    static constexpr std::size_t max_optimistic_read_trials = 8;
+};
+
+//! Default policy of locks.
+using default_lock_policy = shared_mutex_lock_policy;
+
+}  // namespace hash_tables::tables::policies
@@ -20,21 +20,29 @@
 #pragma once
 
 #include <algorithm>
-#include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <optional>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "hash_tables/exceptions.h"
 #include "hash_tables/hashes/default_hash.h"
 #include "hash_tables/tables/internal/hashed_key_view.h"
+#include "hash_tables/tables/internal/retaining_allocator.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
 #include "hash_tables/utility/cache_line.h"
 #include "hash_tables/utility/count_right_zero_bits.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/is_trivially_relocatable.h"
+#include "hash_tables/utility/pause_cpu.h"
 #include "hash_tables/utility/round_up_to_power_of_two.h"
 #include "hash_tables/utility/value_storage.h"
 
@@ -60,7 +68,11 @@ constexpr std::size_t multi_open_address_table_mt_default_min_num_tables = 16;
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
- * \tparam MinNumTables Minimum number of internal tables.
+ * \tparam MinNumTables Lower bound of the default minimum number of internal
+ * tables. (See default_min_num_tables function.)
+ * \tparam LockPolicy Type of the policy of locks of internal tables.
+ * (Functions reading values use shared locks of this policy, so threads
+ * reading values don't wait for each other in the default policy.)
  *
  * \thread_safety Safe even for the same object.
  */
@@ -69,7 +81,8 @@ template <typename ValueType, typename KeyType, typename ExtractKey,
     typename KeyEqual = std::equal_to<KeyType>,
     typename Allocator = std::allocator<ValueType>,
     std::size_t MinNumTables =
-        internal::multi_open_address_table_mt_default_min_num_tables>
+        internal::multi_open_address_table_mt_default_min_num_tables,
+    typename LockPolicy = policies::default_lock_policy>
 class multi_open_address_table_mt {
 public:
     //! Type of values.
@@ -90,12 +103,50 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of locks.
+    using lock_policy_type = LockPolicy;
+
+    // Optimistic reads copy nodes with plain loads while other threads may
+    // write them. This is a data race in the C++ memory model (and reported
+    // by ThreadSanitizer), but copies are used only after validation of the
+    // sequence shows no writes, so torn copies of values which can be copied
+    // by copying bytes are always discarded, as in usual sequence locks.
+    static_assert(!lock_policy_type::optimistic_read ||
+            utility::is_bytewise_copyable_v<value_type>,
+        "Optimistic reads require values which can be copied by copying "
+        "bytes.");
+
     //! Type of sizes.
     using size_type = std::size_t;
 
     //! Default number of nodes in internal tables.
     static constexpr size_type default_num_internal_nodes = 32U;
 
+    //! Default number of internal tables per thread supported by hardware.
+    static constexpr size_type default_num_tables_per_thread = 4U;
+
+    /*!
+     * \brief Get the default minimum number of internal tables.
+     *
+     * This is default_num_tables_per_thread times the number of threads
+     * supported by hardware, so that threads rarely wait for the same lock,
+     * and at least MinNumTables. For example, this is 512 on a machine with
+     * 96 hardware threads (after rounding up to a power of two in
+     * constructors).
+     *
+     * \return Default minimum number of internal tables.
+     *
+     * \note Every internal table allocates its nodes and a lock on
+     * construction, so the memory used by an empty table grows in
+     * proportion to the number of hardware threads with this default. Give
+     * a smaller number to constructors for many small tables.
+     */
+    [[nodiscard]] static auto default_min_num_tables() noexcept -> size_type {
+        const size_type num_threads = std::thread::hardware_concurrency();
+        return std::max<size_type>(
+            MinNumTables, num_threads * default_num_tables_per_thread);
+    }
+
     /*!
      * \brief Constructor.
      *
@@ -105,19 +156,30 @@ public:
      * \param[in] hash Hash function.
      * \param[in] key_equal Function to check whether keys are equal.
      * \param[in] allocator Allocator.
+     * \param[in] min_num_tables Minimum number of internal tables. (Rounded
+     * up to a power of two. Numbers less than 2 are replaced with 2. See
+     * default_min_num_tables function for the default.)
      */
     explicit multi_open_address_table_mt(
         size_type min_internal_num_nodes = default_num_internal_nodes,
         extract_key_type extract_key = extract_key_type(),
         hash_type hash = hash_type(),
         key_equal_type key_equal = key_equal_type(),
-        allocator_type allocator = allocator_type())
-        : extract_key_(extract_key), hash_(hash), key_equal_(key_equal) {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
+        allocator_type allocator = allocator_type(),
+        size_type min_num_tables = default_min_num_tables())
+        : internal_tables_(utility::round_up_to_power_of_two(
+              std::max<size_type>(min_num_tables, 2U))),
+          internal_table_index_mask_(internal_tables_.size() - 1U),
+          internal_table_hash_shift_(
+              utility::count_right_zero_bits(internal_tables_.size())),
+          extract_key_(extract_key),
+          hash_(hash),
+          key_equal_(key_equal) {
+        for (size_type i = 0; i < internal_tables_.size(); ++i) {
             internal_tables_[i].emplace(min_internal_num_nodes,
                 internal_extract_key_type(extract_key_), internal_hash_type(),
                 internal_key_equal_type(key_equal_),
-                internal_allocator_type(allocator));
+                internal_base_allocator_type(allocator));
         }
     }
 
@@ -130,8 +192,8 @@ public:
      * \brief Destructor.
      */
     ~multi_open_address_table_mt() noexcept {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
-            internal_tables_[i].clear();
+        for (auto& internal_table : internal_tables_) {
+            internal_table.clear();
         }
     }
 
@@ -151,6 +213,21 @@ public:
         return emplace(extract_key_(value), value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -162,6 +239,21 @@ public:
         return emplace(extract_key_(value), std::move(value));
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -182,6 +274,55 @@ public:
                 std::forward_as_tuple(internal_key.hash_number()));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the hash
+     * number of the key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return exclusive_table(internal_table_index)
+            ->emplace(internal_key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Args>(args)...),
+                std::forward_as_tuple(internal_key.hash_number()));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * Unlike emplace function, the key is searched before any preparation for
+     * insertion. Arguments are used only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return exclusive_table(internal_table_index)
+            ->try_emplace(internal_key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Args>(args)...),
+                std::forward_as_tuple(internal_key.hash_number()))
+            .second;
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor if not exist,
      * or assign to an existing value.
@@ -224,6 +365,65 @@ public:
                 std::forward_as_tuple(internal_key.hash_number()));
     }
 
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return exclusive_table(internal_table_index)
+            ->update(internal_key, [&function](internal_value_type& value) {
+                std::invoke(std::forward<Function>(function), value.first);
+            });
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return exclusive_table(internal_table_index)
+            ->upsert(
+                internal_key,
+                [internal_hash_number = internal_key.hash_number(), &factory] {
+                    return std::make_pair(
+                        std::invoke(std::forward<Factory>(factory)),
+                        internal_hash_number);
+                },
+                [&function](internal_value_type& value) {
+                    std::invoke(
+                        std::forward<Function>(function), value.first);
+                });
+    }
+
     ///@}
 
     /*!
@@ -240,7 +440,36 @@ public:
     [[nodiscard]] auto at(const key_type& key) const -> value_type {
         const auto [internal_table_index, internal_key] =
             prepare_for_search(key);
-        return shared_table(internal_table_index)->at(internal_key).first;
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) -> value_type {
+                if (value == nullptr) {
+                    throw key_not_found();
+                }
+                return *value;
+            });
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> value_type {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) -> value_type {
+                if (value == nullptr) {
+                    throw key_not_found();
+                }
+                return *value;
+            });
     }
 
     /*!
@@ -254,7 +483,38 @@ public:
     void get_to(ValueOutput& value, const key_type& key) const {
         const auto [internal_table_index, internal_key] =
             prepare_for_search(key);
-        value = shared_table(internal_table_index)->at(internal_key).first;
+        read_value(internal_table_index, internal_key,
+            [&value](const value_type* found) {
+                if (found == nullptr) {
+                    throw key_not_found();
+                }
+                value = *found;
+            });
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[out] value Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput>
+    void get_to(ValueOutput& value, const KeyLike& key) const {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        read_value(internal_table_index, internal_key,
+            [&value](const value_type* found) {
+                if (found == nullptr) {
+                    throw key_not_found();
+                }
+                value = *found;
+            });
     }
 
     /*!
@@ -277,6 +537,31 @@ public:
             .first;
     }
 
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return exclusive_table(internal_table_index)
+            ->get_or_create(internal_key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Args>(args)...),
+                std::forward_as_tuple(internal_key.hash_number()))
+            .first;
+    }
+
     /*!
      * \brief Get a value constructing it if not found.
      *
@@ -298,6 +583,32 @@ public:
                     .first;
     }
 
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \tparam Args Type of arguments of the constructor.
+     * \param[out] value Value.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput, typename... Args>
+    void get_or_create_to(
+        ValueOutput& value, const KeyLike& key, Args&&... args) {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        value = exclusive_table(internal_table_index)
+                    ->get_or_create(internal_key, std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<Args>(args)...),
+                        std::forward_as_tuple(internal_key.hash_number()))
+                    .first;
+    }
+
     /*!
      * \brief Get a value constructing using a factory function it if not found.
      *
@@ -356,12 +667,60 @@ public:
         -> std::optional<value_type> {
         const auto [internal_table_index, internal_key] =
             prepare_for_search(key);
-        const internal_value_type* ptr =
-            shared_table(internal_table_index)->try_get(internal_key);
-        if (ptr == nullptr) {
-            return std::nullopt;
-        }
-        return ptr->first;
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) -> std::optional<value_type> {
+                if (value == nullptr) {
+                    return std::nullopt;
+                }
+                return *value;
+            });
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) const
+        -> std::optional<value_type> {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) -> std::optional<value_type> {
+                if (value == nullptr) {
+                    return std::nullopt;
+                }
+                return *value;
+            });
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const
+        -> std::optional<value_type> {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) -> std::optional<value_type> {
+                if (value == nullptr) {
+                    return std::nullopt;
+                }
+                return *value;
+            });
     }
 
     /*!
@@ -377,13 +736,69 @@ public:
     auto try_get_to(ValueOutput& value, const key_type& key) const -> bool {
         const auto [internal_table_index, internal_key] =
             prepare_for_search(key);
-        const internal_value_type* ptr =
-            shared_table(internal_table_index)->try_get(internal_key);
-        if (ptr == nullptr) {
-            return false;
-        }
-        value = ptr->first;
-        return true;
+        return read_value(internal_table_index, internal_key,
+            [&value](const value_type* found) {
+                if (found == nullptr) {
+                    return false;
+                }
+                value = *found;
+                return true;
+            });
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[out] value Value.
+     * \retval true Value was found and assigned to value.
+     * \retval false Value was not found.
+     */
+    template <typename ValueOutput>
+    auto try_get_to_with_hash(ValueOutput& value,
+        const key_type& key, size_type hash_number) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return read_value(internal_table_index, internal_key,
+            [&value](const value_type* found) {
+                if (found == nullptr) {
+                    return false;
+                }
+                value = *found;
+                return true;
+            });
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[out] value Value.
+     * \retval true Value was found and assigned to value.
+     * \retval false Value was not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput>
+    auto try_get_to(ValueOutput& value, const KeyLike& key) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return read_value(internal_table_index, internal_key,
+            [&value](const value_type* found) {
+                if (found == nullptr) {
+                    return false;
+                }
+                value = *found;
+                return true;
+            });
     }
 
     /*!
@@ -396,7 +811,45 @@ public:
     [[nodiscard]] auto has(const key_type& key) const -> bool {
         const auto [internal_table_index, internal_key] =
             prepare_for_search(key);
-        return shared_table(internal_table_index)->has(internal_key);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) { return value != nullptr; });
+    }
+
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) { return value != nullptr; });
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return read_value(internal_table_index, internal_key,
+            [](const value_type* value) { return value != nullptr; });
     }
 
     /*!
@@ -407,10 +860,11 @@ public:
      */
     template <typename Function>
     void for_all(Function&& function) {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
-            shared_table(i)->for_all([&function](internal_value_type& value) {
-                std::invoke(function, value.first);
-            });
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
+            exclusive_table(i)->for_all(
+                [&function](internal_value_type& value) {
+                    std::invoke(function, value.first);
+                });
         }
     }
 
@@ -422,7 +876,7 @@ public:
      */
     template <typename Function>
     void for_all(Function&& function) const {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             shared_table(i)->for_all(
                 [&function](const internal_value_type& value) {
                     std::invoke(function, value.first);
@@ -441,7 +895,7 @@ public:
      * \brief Delete all values.
      */
     void clear() noexcept {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             exclusive_table(i)->clear();
         }
     }
@@ -459,6 +913,40 @@ public:
         return exclusive_table(internal_table_index)->erase(internal_key);
     }
 
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return exclusive_table(internal_table_index)->erase(internal_key);
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return exclusive_table(internal_table_index)->erase(internal_key);
+    }
+
     /*!
      * \brief Delete values which satisfy a condition.
      *
@@ -469,7 +957,7 @@ public:
     template <typename Function>
     auto erase_if(Function&& function) -> size_type {
         size_type res = 0U;
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             res += exclusive_table(i)->erase_if(
                 [&function](const internal_value_type& value) {
                     return std::invoke(function, value.first);
@@ -495,7 +983,7 @@ public:
      */
     template <typename Function>
     auto check_all_satisfy(Function&& function) const -> bool {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             if (!shared_table(i)->check_all_satisfy(
                     [&function](const internal_value_type& value) {
                         return std::invoke(function, value.first);
@@ -516,7 +1004,7 @@ public:
      */
     template <typename Function>
     auto check_any_satisfy(Function&& function) const -> bool {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             if (shared_table(i)->check_any_satisfy(
                     [&function](const internal_value_type& value) {
                         return std::invoke(function, value.first);
@@ -537,7 +1025,7 @@ public:
      */
     template <typename Function>
     auto check_none_satisfy(Function&& function) const -> bool {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             if (!shared_table(i)->check_none_satisfy(
                     [&function](const internal_value_type& value) {
                         return std::invoke(function, value.first);
@@ -558,12 +1046,39 @@ public:
     /*!
      * \brief Get the number of values.
      *
+     * This function reads counters of values in internal tables without
+     * locks, so the result may not reflect modifications executed
+     * concurrently in other threads. Use exact_size function for the exact
+     * number.
+     *
      * \return Number of values.
      */
     [[nodiscard]] auto size() const noexcept -> size_type {
         size_type res = 0U;
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
-            res += shared_table(i)->size();
+        for (const auto& internal_table : internal_tables_) {
+            res += internal_table.get().num_values.load(
+                std::memory_order_relaxed);
+        }
+        return res;
+    }
+
+    /*!
+     * \brief Get the exact number of values at a moment.
+     *
+     * This function locks all internal tables at once, so modifications in
+     * other threads wait for this function.
+     *
+     * \return Number of values.
+     */
+    [[nodiscard]] auto exact_size() const -> size_type {
+        std::vector<typename lock_policy_type::shared_lock_type> locks;
+        locks.reserve(internal_tables_.size());
+        for (auto& internal_table : internal_tables_) {
+            locks.emplace_back(internal_table.get().mutex);
+        }
+        size_type res = 0U;
+        for (const auto& internal_table : internal_tables_) {
+            res += internal_table.get().internal_table.size();
         }
         return res;
     }
@@ -571,10 +1086,21 @@ public:
     /*!
      * \brief Check whether this object is empty.
      *
+     * This function reads counters of values in internal tables without
+     * locks as size function.
+     *
      * \retval true This object is empty.
      * \retval false This object is not empty.
      */
-    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0U; }
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        for (const auto& internal_table : internal_tables_) {
+            if (internal_table.get().num_values.load(
+                    std::memory_order_relaxed) != 0U) {
+                return false;
+            }
+        }
+        return true;
+    }
 
     /*!
      * \brief Get the maximum number of values.
@@ -592,7 +1118,7 @@ public:
      * \param[in] size Number of values.
      */
     void reserve(size_type size) {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             exclusive_table(i)->reserve(size);
         }
     }
@@ -606,9 +1132,10 @@ public:
      * \param[in] size Number of values.
      */
     void reserve_approx(size_type size) {
-        size_type approx_size_for_internal_tables = size / num_internal_tables;
+        size_type approx_size_for_internal_tables =
+            size / internal_tables_.size();
         approx_size_for_internal_tables += approx_size_for_internal_tables / 2U;
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             exclusive_table(i)->reserve(approx_size_for_internal_tables);
         }
     }
@@ -653,8 +1180,23 @@ public:
      * \return Allocator.
      */
     [[nodiscard]] auto allocator() const -> allocator_type {
-        return allocator_type(  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            internal_tables_[0].get().internal_table.get_allocator());
+        const internal_table_data_type& data =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            internal_tables_[0].get();
+        if constexpr (lock_policy_type::optimistic_read) {
+            return allocator_type(data.memory_pool.allocator());
+        } else {
+            return allocator_type(data.internal_table.get_allocator());
+        }
+    }
+
+    /*!
+     * \brief Get the number of internal tables.
+     *
+     * \return Number of internal tables.
+     */
+    [[nodiscard]] auto num_tables() const noexcept -> size_type {
+        return internal_tables_.size();
     }
 
     /*!
@@ -664,7 +1206,7 @@ public:
      */
     [[nodiscard]] auto num_nodes() const noexcept -> size_type {
         size_type res = 0U;
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             res += shared_table(i)->num_nodes();
         }
         return res;
@@ -676,7 +1218,7 @@ public:
      * \param[in] value Maximum load factor.
      */
     void max_load_factor(float value) {
-        for (std::size_t i = 0; i < num_internal_tables; ++i) {
+        for (std::size_t i = 0; i < internal_tables_.size(); ++i) {
             exclusive_table(i)->max_load_factor(value);
         }
     }
@@ -707,10 +1249,40 @@ private:
     using internal_key_equal_type =
         internal::hashed_key_view_equal<key_type, key_equal_type>;
 
-    //! Type of allocators in internal tables.
-    using internal_allocator_type = typename std::allocator_traits<
+    //! Type of allocators given by users rebound for internal tables.
+    using internal_base_allocator_type = typename std::allocator_traits<
         allocator_type>::template rebind_alloc<internal_value_type>;
 
+    /*!
+     * \brief Struct used instead of pools of memory when values are read with
+     * locks.
+     */
+    struct no_memory_pool {
+        /*!
+         * \brief Constructor.
+         */
+        explicit no_memory_pool(
+            const internal_base_allocator_type& /*allocator*/) noexcept {}
+    };
+
+    /*!
+     * \brief Type of pools of memory of internal tables.
+     *
+     * In optimistic reads, memory released in rehashing is kept in pools so
+     * that threads reading values without locks never access released memory.
+     */
+    using memory_pool_type =
+        std::conditional_t<lock_policy_type::optimistic_read,
+            internal::retained_memory_pool<internal_base_allocator_type>,
+            no_memory_pool>;
+
+    //! Type of allocators in internal tables.
+    using internal_allocator_type =
+        std::conditional_t<lock_policy_type::optimistic_read,
+            internal::retaining_allocator<internal_value_type,
+                internal_base_allocator_type>,
+            internal_base_allocator_type>;
+
     //! Type of internal tables.
     using internal_table_type = open_address_table_st<internal_value_type,
         internal_key_type, internal_extract_key_type, internal_hash_type,
@@ -721,11 +1293,23 @@ private:
      */
     struct alignas(utility::cache_line) internal_table_data_type {
     public:
+        //! Pool of memory. (Declared before the table to outlive it.)
+        memory_pool_type memory_pool;
+
         //! Table.
         internal_table_type internal_table;
 
         //! Mutex.
-        std::mutex mutex{};
+        typename lock_policy_type::mutex_type mutex{};
+
+        /*!
+         * \brief Number of values in the table.
+         *
+         * This is updated while the mutex is locked exclusively, and placed in
+         * another cache line so that threads reading this don't disturb
+         * threads using the mutex.
+         */
+        alignas(utility::cache_line) std::atomic<size_type> num_values{0U};
 
         /*!
          * \brief Constructor.
@@ -741,9 +1325,30 @@ private:
             const internal_extract_key_type& extract_key,
             const internal_hash_type& hash,
             const internal_key_equal_type& key_equal,
-            const internal_allocator_type& allocator)
-            : internal_table(min_internal_num_nodes, extract_key, hash,
-                  key_equal, allocator) {}
+            const internal_base_allocator_type& allocator)
+            : memory_pool(allocator),
+              internal_table(min_internal_num_nodes, extract_key, hash,
+                  key_equal,
+                  create_internal_allocator(memory_pool, allocator)) {}
+
+    private:
+        /*!
+         * \brief Create the allocator of the internal table.
+         *
+         * \param[in] pool Pool of memory.
+         * \param[in] allocator Allocator given by users.
+         * \return Allocator of the internal table.
+         */
+        [[nodiscard]] static auto create_internal_allocator(
+            [[maybe_unused]] memory_pool_type& pool,
+            [[maybe_unused]] const internal_base_allocator_type& allocator)
+            -> internal_allocator_type {
+            if constexpr (lock_policy_type::optimistic_read) {
+                return internal_allocator_type(pool);
+            } else {
+                return allocator;
+            }
+        }
     };
 
     /*!
@@ -780,44 +1385,148 @@ private:
         Lock lock_;
     };
 
+    /*!
+     * \brief Class of internal table locked exclusively.
+     *
+     * The counter of values in the internal table is updated when the lock is
+     * released.
+     */
+    class exclusive_internal_table {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] data Data of the internal table.
+         */
+        explicit exclusive_internal_table(internal_table_data_type& data)
+            : data_(&data), lock_(data.mutex) {}
+
+        exclusive_internal_table(const exclusive_internal_table&) = delete;
+        exclusive_internal_table(exclusive_internal_table&&) = delete;
+        auto operator=(const exclusive_internal_table&) = delete;
+        auto operator=(exclusive_internal_table&&) = delete;
+
+        /*!
+         * \brief Destructor.
+         */
+        ~exclusive_internal_table() noexcept {
+            const size_type num_values = data_->internal_table.size();
+            // Skip writing when unchanged not to invalidate the cache line in
+            // threads reading the counter.
+            if (data_->num_values.load(std::memory_order_relaxed) !=
+                num_values) {
+                data_->num_values.store(num_values, std::memory_order_relaxed);
+            }
+        }
+
+        /*!
+         * \brief Access to the table.
+         *
+         * \return Pointer of the table.
+         */
+        auto operator->() const noexcept -> internal_table_type* {
+            return &data_->internal_table;
+        }
+
+    private:
+        //! Data of the internal table.
+        internal_table_data_type* data_;
+
+        //! Lock.
+        typename lock_policy_type::exclusive_lock_type lock_;
+    };
+
     /*!
      * \brief Prepare for search of positions to create, get, or remove values
      * of a key.
      *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Index of internal table and key for the internal table.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto prepare_for_search(const KeyLike& key) const
+        -> std::pair<size_type, internal::hashed_key_view<KeyLike>> {
+        return prepare_for_search_with_hash(key, hash_(key));
+    }
+
+    /*!
+     * \brief Prepare for search of positions to create, get, or remove values
+     * of a key using the hash number of the key.
+     *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
      * \return Index of internal table and key for the internal table.
      */
-    [[nodiscard]] auto prepare_for_search(const key_type& key) const
-        -> std::pair<size_type, internal::hashed_key_view<key_type>> {
-        const size_type hash_number = hash_(key);
+    template <typename KeyLike>
+    [[nodiscard]] auto prepare_for_search_with_hash(
+        const KeyLike& key, size_type hash_number) const
+        -> std::pair<size_type, internal::hashed_key_view<KeyLike>> {
         const size_type internal_table_index =
-            hash_number & internal_table_index_mask;
+            hash_number & internal_table_index_mask_;
         const size_type internal_table_hash_number =
-            hash_number >> internal_table_hash_shift;
+            hash_number >> internal_table_hash_shift_;
         assert(hash_number ==
-            internal_table_hash_number * num_internal_tables +
+            internal_table_hash_number * internal_tables_.size() +
                 internal_table_index);
         return {internal_table_index,
-            internal::hashed_key_view<key_type>(
+            internal::hashed_key_view<KeyLike>(
                 key, internal_table_hash_number)};
     }
 
     /*!
-     * \brief Get shared internal table.
+     * \brief Find a value in an internal table and process it.
+     *
+     * In optimistic reads, the value is copied without locks, and the function
+     * is called with the copy after checking that no thread modified the
+     * internal table. After each failed check, the CPU is paused before the
+     * next trial to avoid busy reads of the sequence. Otherwise, the function
+     * is called while the internal table is locked.
      *
+     * \tparam KeyLike Type of the key.
+     * \tparam Function Type of the function.
      * \param[in] table_index Index of the internal table.
-     * \return Internal table.
+     * \param[in] key Key for the internal table.
+     * \param[in] function Function called with the pointer to the value
+     * (nullptr if not found).
+     * \return Return value of the function.
      */
-    [[nodiscard]] auto shared_table(size_type table_index)
-        -> locked_internal_table<internal_table_type,
-            std::unique_lock<std::mutex>> {
-        assert(table_index < num_internal_tables);
-        internal_table_data_type& data =
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            internal_tables_[table_index].get();
-        return locked_internal_table<internal_table_type,
-            std::unique_lock<std::mutex>>(
-            data.internal_table, std::unique_lock<std::mutex>(data.mutex));
+    template <typename KeyLike, typename Function>
+    auto read_value(size_type table_index,
+        const internal::hashed_key_view<KeyLike>& key,
+        Function&& function) const {
+        if constexpr (lock_policy_type::optimistic_read) {
+            const internal_table_data_type& data =
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                internal_tables_[table_index].get();
+            for (size_type i = 0;
+                 i < lock_policy_type::max_optimistic_read_trials; ++i) {
+                const auto sequence = data.mutex.begin_read();
+                const auto view = data.internal_table.create_read_view();
+                if (!data.mutex.validate_read(sequence)) {
+                    utility::pause_cpu();
+                    continue;
+                }
+                const internal_value_type* found = view.find(key);
+                if (found == nullptr) {
+                    if (data.mutex.validate_read(sequence)) {
+                        const value_type* no_value = nullptr;
+                        return function(no_value);
+                    }
+                    utility::pause_cpu();
+                    continue;
+                }
+                const value_type value = found->first;
+                if (data.mutex.validate_read(sequence)) {
+                    return function(&value);
+                }
+                utility::pause_cpu();
+            }
+        }
+        const auto table = shared_table(table_index);
+        const internal_value_type* found = table->try_get(key);
+        return function(found == nullptr ? nullptr : &found->first);
     }
 
     /*!
@@ -828,14 +1537,14 @@ private:
      */
     [[nodiscard]] auto shared_table(size_type table_index) const
         -> locked_internal_table<const internal_table_type,
-            std::unique_lock<std::mutex>> {
-        assert(table_index < num_internal_tables);
+            typename lock_policy_type::shared_lock_type> {
+        assert(table_index < internal_tables_.size());
         internal_table_data_type& data =
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             internal_tables_[table_index].get();
         return locked_internal_table<const internal_table_type,
-            std::unique_lock<std::mutex>>(
-            data.internal_table, std::unique_lock<std::mutex>(data.mutex));
+            typename lock_policy_type::shared_lock_type>(data.internal_table,
+            typename lock_policy_type::shared_lock_type(data.mutex));
     }
 
     /*!
@@ -845,34 +1554,27 @@ private:
      * \return Internal table.
      */
     [[nodiscard]] auto exclusive_table(size_type table_index)
-        -> locked_internal_table<internal_table_type,
-            std::unique_lock<std::mutex>> {
-        assert(table_index < num_internal_tables);
-        internal_table_data_type& data =
+        -> exclusive_internal_table {
+        assert(table_index < internal_tables_.size());
+        return exclusive_internal_table(
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            internal_tables_[table_index].get();
-        return locked_internal_table<internal_table_type,
-            std::unique_lock<std::mutex>>(
-            data.internal_table, std::unique_lock<std::mutex>(data.mutex));
+            internal_tables_[table_index].get());
     }
 
-    //! Number of internal tables.
-    static constexpr size_type num_internal_tables =
-        utility::round_up_to_power_of_two(
-            std::max<size_type>(MinNumTables, 2U));
+    /*!
+     * \brief Internal tables.
+     *
+     * The number of internal tables is a power of two and is not changed
+     * after construction.
+     */
+    mutable std::vector<utility::value_storage<internal_table_data_type>>
+        internal_tables_;
 
     //! Bit mask to get the index of the internal table.
-    static constexpr size_type internal_table_index_mask =
-        num_internal_tables - 1U;
+    size_type internal_table_index_mask_;
 
     //! Number of bits to shift to calculate hash numbers in internal tables.
-    static constexpr size_type internal_table_hash_shift =
-        utility::count_right_zero_bits(num_internal_tables);
-
-    //! Internal tables.
-    mutable std::array<utility::value_storage<internal_table_data_type>,
-        num_internal_tables>
-        internal_tables_{};
+    size_type internal_table_hash_shift_;
 
     //! Function to extract keys from values.
     extract_key_type extract_key_;
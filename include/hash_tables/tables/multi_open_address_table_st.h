@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -33,8 +34,12 @@
 
 #include "hash_tables/hashes/default_hash.h"
 #include "hash_tables/tables/internal/hashed_key_view.h"
+#include "hash_tables/tables/node_handle.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
 #include "hash_tables/utility/count_right_zero_bits.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/move_if_nothrow_move_constructible.h"
 #include "hash_tables/utility/round_up_to_power_of_two.h"
 #include "hash_tables/utility/value_storage.h"
 
@@ -60,7 +65,12 @@ constexpr std::size_t multi_open_address_table_st_default_min_num_tables = 16;
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
- * \tparam MinNumTables Minimum number of internal tables.
+ * \tparam MinNumTables Default minimum number of internal tables. (Can be
+ * changed in constructors.)
+ * \tparam Policy Type of the policy of internal tables.
+ *
+ * \note Objects moved from have no internal tables, and can only be destroyed
+ * or assigned.
  *
  * \thread_safety Safe if only functions without modifications of data are
  * called.
@@ -70,7 +80,8 @@ template <typename ValueType, typename KeyType, typename ExtractKey,
     typename KeyEqual = std::equal_to<KeyType>,
     typename Allocator = std::allocator<ValueType>,
     std::size_t MinNumTables =
-        internal::multi_open_address_table_st_default_min_num_tables>
+        internal::multi_open_address_table_st_default_min_num_tables,
+    typename Policy = policies::default_open_address_policy>
 class multi_open_address_table_st {
 public:
     //! Type of values.
@@ -91,12 +102,37 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of internal tables.
+    using policy_type = Policy;
+
     //! Type of sizes.
     using size_type = std::size_t;
 
     //! Default number of nodes in internal tables.
     static constexpr size_type default_num_internal_nodes = 32U;
 
+    //! Default minimum number of internal tables.
+    static constexpr size_type default_min_num_tables = MinNumTables;
+
+    /*!
+     * \brief Class of forward iterators of values in tables.
+     *
+     * \tparam IsConst Whether values are accessed as constant values.
+     *
+     * \note Iterators are invalidated by any modification of the table.
+     */
+    template <bool IsConst>
+    class basic_iterator;
+
+    //! Type of iterators.
+    using iterator = basic_iterator<false>;
+
+    //! Type of constant iterators.
+    using const_iterator = basic_iterator<true>;
+
+    //! Type of handles of values extracted from tables.
+    using node_handle_type = node_handle<value_type>;
+
     /*!
      * \brief Constructor.
      *
@@ -106,15 +142,24 @@ public:
      * \param[in] hash Hash function.
      * \param[in] key_equal Function to check whether keys are equal.
      * \param[in] allocator Allocator.
+     * \param[in] min_num_tables Minimum number of internal tables. (Rounded
+     * up to a power of two. Numbers less than 2 are replaced with 2.)
      */
     explicit multi_open_address_table_st(
         size_type min_internal_num_nodes = default_num_internal_nodes,
         extract_key_type extract_key = extract_key_type(),
         hash_type hash = hash_type(),
         key_equal_type key_equal = key_equal_type(),
-        allocator_type allocator = allocator_type())
-        : extract_key_(extract_key), hash_(hash), key_equal_(key_equal) {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
+        allocator_type allocator = allocator_type(),
+        size_type min_num_tables = default_min_num_tables)
+        : internal_tables_(num_tables_for(min_num_tables)),
+          internal_table_index_mask_(internal_tables_.size() - 1U),
+          internal_table_hash_shift_(
+              utility::count_right_zero_bits(internal_tables_.size())),
+          extract_key_(extract_key),
+          hash_(hash),
+          key_equal_(key_equal) {
+        for (size_type i = 0; i < internal_tables_.size(); ++i) {
             internal_tables_[i].emplace(min_internal_num_nodes,
                 internal_extract_key_type(extract_key_), internal_hash_type(),
                 internal_key_equal_type(key_equal_),
@@ -128,10 +173,13 @@ public:
      * \param other Another object to copy from.
      */
     multi_open_address_table_st(const multi_open_address_table_st& other)
-        : extract_key_(other.extract_key_),
+        : internal_tables_(other.internal_tables_.size()),
+          internal_table_index_mask_(other.internal_table_index_mask_),
+          internal_table_hash_shift_(other.internal_table_hash_shift_),
+          extract_key_(other.extract_key_),
           hash_(other.hash_),
           key_equal_(other.key_equal_) {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
+        for (size_type i = 0; i < internal_tables_.size(); ++i) {
             internal_tables_[i].emplace(other.internal_tables_[i].get());
         }
     }
@@ -139,23 +187,24 @@ public:
     /*!
      * \brief Move constructor.
      *
+     * Internal tables are moved without moving values, and the object moved
+     * from can only be destroyed or assigned.
+     *
      * \param other Another object to move from.
      */
     multi_open_address_table_st(multi_open_address_table_st&& other)
 #ifndef HASH_TABLES_DOCUMENTATION
-        noexcept(
-            std::is_nothrow_move_constructible_v<internal_table_type> &&  //
-            std::is_nothrow_move_constructible_v<extract_key_type> &&     //
-            std::is_nothrow_move_constructible_v<hash_type> &&            //
+        noexcept(std::is_nothrow_move_constructible_v<extract_key_type> &&  //
+            std::is_nothrow_move_constructible_v<hash_type> &&              //
             std::is_nothrow_move_constructible_v<key_equal_type>)
 #endif
-        : extract_key_(std::move(other.extract_key_)),
+        : internal_tables_(std::move(other.internal_tables_)),
+          internal_table_index_mask_(other.internal_table_index_mask_),
+          internal_table_hash_shift_(other.internal_table_hash_shift_),
+          extract_key_(std::move(other.extract_key_)),
           hash_(std::move(other.hash_)),
           key_equal_(std::move(other.key_equal_)) {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
-            internal_tables_[i].emplace(
-                std::move(other.internal_tables_[i].get()));
-        }
+        other.internal_tables_.clear();
     }
 
     /*!
@@ -175,35 +224,37 @@ public:
     /*!
      * \brief Move assignment operator.
      *
+     * Internal tables are moved without moving values, and the object moved
+     * from can only be destroyed or assigned.
+     *
      * \param other Another object to move from.
      * \return This.
      */
     auto operator=(multi_open_address_table_st&& other)
 #ifndef HASH_TABLES_DOCUMENTATION
-        noexcept(std::is_nothrow_move_assignable_v<internal_table_type> &&  //
-            std::is_nothrow_move_assignable_v<extract_key_type> &&          //
-            std::is_nothrow_move_assignable_v<hash_type> &&                 //
+        noexcept(std::is_nothrow_move_assignable_v<extract_key_type> &&  //
+            std::is_nothrow_move_assignable_v<hash_type> &&              //
             std::is_nothrow_move_assignable_v<key_equal_type>)
 #endif
             -> multi_open_address_table_st& {
+        if (this == &other) {
+            return *this;
+        }
         extract_key_ = std::move(other.extract_key_);
         hash_ = std::move(other.hash_);
         key_equal_ = std::move(other.key_equal_);
-        for (size_type i = 0; i < num_internal_tables; ++i) {
-            internal_tables_[i].get() =
-                std::move(other.internal_tables_[i].get());
-        }
+        destroy_internal_tables();
+        internal_tables_ = std::move(other.internal_tables_);
+        other.internal_tables_.clear();
+        internal_table_index_mask_ = other.internal_table_index_mask_;
+        internal_table_hash_shift_ = other.internal_table_hash_shift_;
         return *this;
     }
 
     /*!
      * \brief Destructor.
      */
-    ~multi_open_address_table_st() noexcept {
-        for (size_type i = 0; i < num_internal_tables; ++i) {
-            internal_tables_[i].clear();
-        }
-    }
+    ~multi_open_address_table_st() noexcept { destroy_internal_tables(); }
 
     /*!
      * \name Create or update values.
@@ -221,6 +272,21 @@ public:
         return emplace(extract_key_(value), value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -232,6 +298,21 @@ public:
         return emplace(extract_key_(value), std::move(value));
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -252,6 +333,79 @@ public:
             std::forward_as_tuple(internal_key.hash_number()));
     }
 
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the hash
+     * number of the key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return internal_tables_[internal_table_index].get().emplace(
+            internal_key, std::piecewise_construct,
+            std::forward_as_tuple(std::forward<Args>(args)...),
+            std::forward_as_tuple(internal_key.hash_number()));
+    }
+
+    /*!
+     * \brief Insert a value extracted from a table.
+     *
+     * The hash number in the handle is used without calculating it again.
+     *
+     * \param[in,out] node Handle of the value. (Empty after this function if
+     * the value is inserted.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key or an empty
+     * handle.
+     */
+    auto insert(node_handle_type&& node) -> bool {
+        if (node.empty()) {
+            return false;
+        }
+        if (!emplace_with_hash(extract_key_(node.value()), node.hash_number(),
+                std::move(node.value()))) {
+            return false;
+        }
+        node.clear();
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * Arguments are used only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \return Reference to the inserted or existing value, and whether the
+     * value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args)
+        -> std::pair<value_type&, bool> {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        const auto [internal_value, inserted] =
+            internal_tables_[internal_table_index].get().try_emplace(
+                internal_key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Args>(args)...),
+                std::forward_as_tuple(internal_key.hash_number()));
+        return {internal_value.first, inserted};
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor if not exist,
      * or assign to an existing value.
@@ -294,6 +448,118 @@ public:
             std::forward_as_tuple(internal_key.hash_number()));
     }
 
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index].get().update(
+            internal_key, [&function](internal_value_type& value) {
+                std::invoke(std::forward<Function>(function), value.first);
+            });
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The key is searched only once.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index].get().upsert(
+            internal_key,
+            [internal_hash_number = internal_key.hash_number(), &factory] {
+                return std::make_pair(
+                    std::invoke(std::forward<Factory>(factory)),
+                    internal_hash_number);
+            },
+            [&function](internal_value_type& value) {
+                std::invoke(std::forward<Function>(function), value.first);
+            });
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * Values with keys not in this table are moved to this table, and the
+     * other values remain in the other table.
+     *
+     * When hash_type has no state and both tables have the same number of
+     * internal tables, values are moved between internal tables for the same
+     * hash numbers. Otherwise, values are inserted one by one, reusing hash
+     * numbers only when hash_type has no state, because the hash function of
+     * the other table may calculate different hash numbers.
+     *
+     * \param[in,out] other Table to move values from.
+     */
+    void merge(multi_open_address_table_st& other) {
+        if (&other == this) {
+            return;
+        }
+        const size_type num_other_tables = other.internal_tables_.size();
+        if constexpr (std::is_empty_v<hash_type>) {
+            if (internal_tables_.size() == num_other_tables) {
+                for (size_type i = 0; i < num_other_tables; ++i) {
+                    internal_tables_[i].get().merge(
+                        other.internal_tables_[i].get());
+                }
+                return;
+            }
+        }
+        for (size_type i = 0; i < num_other_tables; ++i) {
+            auto& other_table = other.internal_tables_[i].get();
+            other_table.finish_migration();
+            other_table.erase_nodes_if(
+                [this, &other, &other_table, i](size_type node_ind) {
+                    auto& [value, internal_hash_number] =
+                        other_table.nodes_.value(node_ind);
+                    const auto& key = extract_key_(value);
+                    size_type hash_number{};
+                    if constexpr (std::is_empty_v<hash_type>) {
+                        hash_number = (internal_hash_number
+                                          << other.internal_table_hash_shift_) |
+                            i;
+                    } else {
+                        hash_number = hash_(key);
+                    }
+                    return emplace_with_hash(key, hash_number,
+                        utility::move_if_nothrow_move_constructible(value));
+                });
+            other_table.shrink_if_needed();
+        }
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * \param[in,out] other Table to move values from.
+     * \sa merge(multi_open_address_table_st&)
+     */
+    void merge(multi_open_address_table_st&& other) { merge(other); }
+
     ///@}
 
     /*!
@@ -316,6 +582,26 @@ public:
             .first;
     }
 
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) -> value_type& {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index]
+            .get()
+            .at(internal_key)
+            .first;
+    }
+
     /*!
      * \brief Get a value.
      *
@@ -331,6 +617,26 @@ public:
             .first;
     }
 
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> const value_type& {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index]
+            .get()
+            .at(internal_key)
+            .first;
+    }
+
     /*!
      * \brief Get a value constructing it if not found.
      *
@@ -352,6 +658,32 @@ public:
             .first;
     }
 
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type& {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index]
+            .get()
+            .get_or_create(internal_key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Args>(args)...),
+                std::forward_as_tuple(internal_key.hash_number()))
+            .first;
+    }
+
     /*!
      * \brief Get a value constructing using a factory function it if not found.
      *
@@ -393,6 +725,49 @@ public:
         return &(ptr->first);
     }
 
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) -> value_type* {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        internal_value_type* ptr =
+            internal_tables_[internal_table_index].get().try_get(internal_key);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return &(ptr->first);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) -> value_type* {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        internal_value_type* ptr =
+            internal_tables_[internal_table_index].get().try_get(internal_key);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return &(ptr->first);
+    }
+
     /*!
      * \brief Get a value if found.
      *
@@ -410,6 +785,49 @@ public:
         return &(ptr->first);
     }
 
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) const -> const value_type* {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        const internal_value_type* ptr =
+            internal_tables_[internal_table_index].get().try_get(internal_key);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return &(ptr->first);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const -> const value_type* {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        const internal_value_type* ptr =
+            internal_tables_[internal_table_index].get().try_get(internal_key);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        return &(ptr->first);
+    }
+
     /*!
      * \brief Check whether a key exists.
      *
@@ -423,6 +841,122 @@ public:
         return internal_tables_[internal_table_index].get().has(internal_key);
     }
 
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return internal_tables_[internal_table_index].get().has(internal_key);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index].get().has(internal_key);
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * Hash numbers of keys are calculated and the nodes of the keys are
+     * prefetched in chunks before searching the keys, so that latency of
+     * memory access for one key is hidden by processing of other keys.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) {
+        search_in_batch(keys,
+            [this, &outputs](size_type i, size_type internal_table_index,
+                const auto& internal_key) {
+                internal_value_type* ptr =
+                    internal_tables_[internal_table_index].get().try_get(
+                        internal_key);
+                outputs[i] = (ptr == nullptr) ? nullptr : &(ptr->first);
+            });
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) const {
+        search_in_batch(keys,
+            [this, &outputs](size_type i, size_type internal_table_index,
+                const auto& internal_key) {
+                const internal_value_type* ptr =
+                    internal_tables_[internal_table_index].get().try_get(
+                        internal_key);
+                outputs[i] = (ptr == nullptr) ? nullptr : &(ptr->first);
+            });
+    }
+
+    /*!
+     * \brief Check whether multiple keys exist.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from bool values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Whether the keys exist. (Written in the same order
+     * as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void has_batch(const Keys& keys, Outputs&& outputs) const {
+        search_in_batch(keys,
+            [this, &outputs](size_type i, size_type internal_table_index,
+                const auto& internal_key) {
+                outputs[i] =
+                    internal_tables_[internal_table_index].get().has(
+                        internal_key);
+            });
+    }
+
     /*!
      * \brief Call a function with all values.
      *
@@ -457,6 +991,147 @@ public:
 
     ///@}
 
+    /*!
+     * \name Iterate over values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(this, 0);
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(this, 0);
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() noexcept -> iterator { return iterator(); }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * Start with cursor 0 and pass the returned cursor to the next call until
+     * 0 is returned, so that all values can be visited in small steps.
+     * Values are visited exactly once if the table is not modified between
+     * calls. Otherwise, some values may be skipped or visited more than once.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items, Function&& function)
+        -> size_type {
+        assert(max_items > 0U);
+        size_type internal_table_index = cursor & internal_table_index_mask_;
+        size_type internal_cursor = cursor >> internal_table_hash_shift_;
+        while (true) {
+            internal_cursor =
+                internal_tables_[internal_table_index].get().scan(
+                    internal_cursor, max_items,
+                    [&function, &max_items](internal_value_type& value) {
+                        std::invoke(function, value.first);
+                        --max_items;
+                    });
+            if (internal_cursor != 0U) {
+                return (internal_cursor << internal_table_hash_shift_) |
+                    internal_table_index;
+            }
+            ++internal_table_index;
+            if (internal_table_index == internal_tables_.size()) {
+                return 0;
+            }
+            if (max_items == 0U) {
+                return internal_table_index;
+            }
+        }
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     * \sa scan(size_type, size_type, Function&&)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items,
+        Function&& function) const -> size_type {
+        assert(max_items > 0U);
+        size_type internal_table_index = cursor & internal_table_index_mask_;
+        size_type internal_cursor = cursor >> internal_table_hash_shift_;
+        while (true) {
+            internal_cursor =
+                internal_tables_[internal_table_index].get().scan(
+                    internal_cursor, max_items,
+                    [&function, &max_items](const internal_value_type& value) {
+                        std::invoke(function, value.first);
+                        --max_items;
+                    });
+            if (internal_cursor != 0U) {
+                return (internal_cursor << internal_table_hash_shift_) |
+                    internal_table_index;
+            }
+            ++internal_table_index;
+            if (internal_table_index == internal_tables_.size()) {
+                return 0;
+            }
+            if (max_items == 0U) {
+                return internal_table_index;
+            }
+        }
+    }
+
+    ///@}
+
     /*!
      * \name Delete values.
      */
@@ -484,6 +1159,61 @@ public:
         return internal_tables_[internal_table_index].get().erase(internal_key);
     }
 
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search_with_hash(key, hash_number);
+        return internal_tables_[internal_table_index].get().erase(internal_key);
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    [[nodiscard]] auto extract(const key_type& key) -> node_handle_type {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        auto internal_node =
+            internal_tables_[internal_table_index].get().extract(internal_key);
+        node_handle_type node;
+        if (internal_node) {
+            const size_type hash_number =
+                (internal_node.hash_number() << internal_table_hash_shift_) |
+                internal_table_index;
+            node.emplace(hash_number, std::move(internal_node.value().first));
+        }
+        return node;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        const auto [internal_table_index, internal_key] =
+            prepare_for_search(key);
+        return internal_tables_[internal_table_index].get().erase(internal_key);
+    }
+
     /*!
      * \brief Delete values which satisfy a condition.
      *
@@ -638,6 +1368,16 @@ public:
         }
     }
 
+    /*!
+     * \brief Decrease the number of nodes to the minimum number for the
+     * current values.
+     */
+    void shrink_to_fit() {
+        for (auto& internal_table : internal_tables_) {
+            internal_table.get().shrink_to_fit();
+        }
+    }
+
     ///@}
 
     /*!
@@ -676,9 +1416,21 @@ public:
      * \brief Get the allocator.
      *
      * \return Allocator.
+     *
+     * \note This function must not be called for objects moved from.
      */
     [[nodiscard]] auto allocator() const -> allocator_type {
-        return allocator_type(internal_tables_.get_allocator());
+        assert(!internal_tables_.empty());
+        return allocator_type(internal_tables_[0].get().allocator());
+    }
+
+    /*!
+     * \brief Get the number of internal tables.
+     *
+     * \return Number of internal tables.
+     */
+    [[nodiscard]] auto num_tables() const noexcept -> size_type {
+        return internal_tables_.size();
     }
 
     /*!
@@ -705,6 +1457,22 @@ public:
         }
     }
 
+    /*!
+     * \brief Set the minimum load factor (number of values / number of nodes).
+     *
+     * When the load factor of an internal table becomes smaller than this
+     * value by deletion of values, the number of nodes in the internal table
+     * is decreased. Zero (default) disables this behavior.
+     *
+     * \param[in] value Minimum load factor. (Must be smaller than the half of
+     * the maximum load factor.)
+     */
+    void min_load_factor(float value) {
+        for (auto& internal_table : internal_tables_) {
+            internal_table.get().min_load_factor(value);
+        }
+    }
+
     ///@}
 
 private:
@@ -738,7 +1506,7 @@ private:
     //! Type of internal tables.
     using internal_table_type = open_address_table_st<internal_value_type,
         internal_key_type, internal_extract_key_type, internal_hash_type,
-        internal_key_equal_type, internal_allocator_type>;
+        internal_key_equal_type, internal_allocator_type, policy_type>;
 
     //! Type of allocators of internal tables.
     using internal_table_allocator_type = typename std::allocator_traits<
@@ -748,40 +1516,115 @@ private:
      * \brief Prepare for search of positions to create, get, or remove values
      * of a key.
      *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
      * \return Index of internal table and key for the internal table.
      */
-    [[nodiscard]] auto prepare_for_search(const key_type& key) const
-        -> std::pair<size_type, internal::hashed_key_view<key_type>> {
-        const size_type hash_number = hash_(key);
+    template <typename KeyLike>
+    [[nodiscard]] auto prepare_for_search(const KeyLike& key) const
+        -> std::pair<size_type, internal::hashed_key_view<KeyLike>> {
+        return prepare_for_search_with_hash(key, hash_(key));
+    }
+
+    /*!
+     * \brief Prepare for search of positions to create, get, or remove values
+     * of a key using the hash number of the key.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Index of internal table and key for the internal table.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto prepare_for_search_with_hash(
+        const KeyLike& key, size_type hash_number) const
+        -> std::pair<size_type, internal::hashed_key_view<KeyLike>> {
         const size_type internal_table_index =
-            hash_number & internal_table_index_mask;
+            hash_number & internal_table_index_mask_;
         const size_type internal_table_hash_number =
-            hash_number >> internal_table_hash_shift;
+            hash_number >> internal_table_hash_shift_;
         assert(hash_number ==
             internal_table_hash_number * internal_tables_.size() +
                 internal_table_index);
         return {internal_table_index,
-            internal::hashed_key_view<key_type>(
+            internal::hashed_key_view<KeyLike>(
                 key, internal_table_hash_number)};
     }
 
-    //! Number of internal tables.
-    static constexpr size_type num_internal_tables =
-        utility::round_up_to_power_of_two(
-            std::max<size_type>(MinNumTables, 2U));
+    /*!
+     * \brief Search multiple keys prefetching nodes in internal tables.
+     *
+     * \tparam Keys Type of the sequence of keys.
+     * \tparam Function Type of the function called with the index of each
+     * key, the index of the internal table, and the key for the internal
+     * table.
+     * \param[in] keys Keys.
+     * \param[in] function Function.
+     */
+    template <typename Keys, typename Function>
+    void search_in_batch(const Keys& keys, Function&& function) const {
+        const size_type num_keys = std::size(keys);
+        std::array<size_type, batch_chunk_size> internal_table_indices{};
+        std::array<size_type, batch_chunk_size> internal_hash_numbers{};
+        for (size_type first = 0; first < num_keys;
+             first += batch_chunk_size) {
+            const size_type chunk_size =
+                std::min<size_type>(batch_chunk_size, num_keys - first);
+            for (size_type i = 0; i < chunk_size; ++i) {
+                const auto [internal_table_index, internal_key] =
+                    prepare_for_search(keys[first + i]);
+                internal_tables_[internal_table_index].get().prefetch(
+                    internal_key);
+                internal_table_indices[i] = internal_table_index;
+                internal_hash_numbers[i] = internal_key.hash_number();
+            }
+            for (size_type i = 0; i < chunk_size; ++i) {
+                const auto& key = keys[first + i];
+                const internal::hashed_key_view<
+                    std::remove_cv_t<std::remove_reference_t<decltype(key)>>>
+                    internal_key(key, internal_hash_numbers[i]);
+                function(first + i, internal_table_indices[i], internal_key);
+            }
+        }
+    }
+
+    //! Number of keys processed at once in batched search.
+    static constexpr size_type batch_chunk_size = 16;
+
+    /*!
+     * \brief Calculate the number of internal tables.
+     *
+     * \param[in] min_num_tables Minimum number of internal tables.
+     * \return Number of internal tables.
+     */
+    [[nodiscard]] static auto num_tables_for(size_type min_num_tables)
+        -> size_type {
+        return utility::round_up_to_power_of_two(
+            std::max<size_type>(min_num_tables, 2U));
+    }
+
+    /*!
+     * \brief Destroy internal tables.
+     */
+    void destroy_internal_tables() noexcept {
+        for (auto& internal_table : internal_tables_) {
+            internal_table.clear();
+        }
+    }
+
+    /*!
+     * \brief Internal tables.
+     *
+     * The number of internal tables is a power of two and is not changed
+     * after construction except for moves.
+     */
+    std::vector<utility::value_storage<internal_table_type>> internal_tables_;
 
     //! Bit mask to get the index of the internal table.
-    static constexpr size_type internal_table_index_mask =
-        num_internal_tables - 1U;
+    size_type internal_table_index_mask_;
 
     //! Number of bits to shift to calculate hash numbers in internal tables.
-    static constexpr size_type internal_table_hash_shift =
-        utility::count_right_zero_bits(num_internal_tables);
-
-    //! Internal tables.
-    std::array<utility::value_storage<internal_table_type>, num_internal_tables>
-        internal_tables_{};
+    size_type internal_table_hash_shift_;
 
     //! Function to extract keys from values.
     extract_key_type extract_key_;
@@ -793,4 +1636,184 @@ private:
     key_equal_type key_equal_;
 };
 
+/*!
+ * \brief Class of forward iterators of values in tables.
+ *
+ * Iterators visit values in internal tables in order.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam MinNumTables Minimum number of internal tables.
+ * \tparam Policy Type of the policy of internal tables.
+ * \tparam IsConst Whether values are accessed as constant values.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash, typename KeyEqual, typename Allocator,
+    std::size_t MinNumTables, typename Policy>
+template <bool IsConst>
+class multi_open_address_table_st<ValueType, KeyType, ExtractKey, Hash,
+    KeyEqual, Allocator, MinNumTables, Policy>::basic_iterator {
+public:
+    //! Type of the category of iterators.
+    using iterator_category = std::forward_iterator_tag;
+
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of differences of iterators.
+    using difference_type = std::ptrdiff_t;
+
+    //! Type of pointers to values.
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+    //! Type of references to values.
+    using reference =
+        std::conditional_t<IsConst, const value_type&, value_type&>;
+
+    /*!
+     * \brief Constructor of the iterator at the end.
+     */
+    basic_iterator() noexcept = default;
+
+    /*!
+     * \brief Constructor to convert a non-constant iterator to a constant
+     * iterator.
+     *
+     * \tparam OtherIsConst Whether the other iterator is constant.
+     * \param[in] obj Iterator.
+     */
+    template <bool OtherIsConst,
+        typename = std::enable_if_t<IsConst && !OtherIsConst>>
+    basic_iterator(  // NOLINT(google-explicit-constructor)
+        const basic_iterator<OtherIsConst>& obj) noexcept
+        : table_(obj.table_),
+          internal_table_index_(obj.internal_table_index_),
+          internal_iterator_(obj.internal_iterator_) {}
+
+    /*!
+     * \brief Get the value.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return internal_iterator_->first;
+    }
+
+    /*!
+     * \brief Get the pointer to the value.
+     *
+     * \return Pointer to the value.
+     */
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return std::addressof(internal_iterator_->first);
+    }
+
+    /*!
+     * \brief Move to the next value.
+     *
+     * \return This iterator.
+     */
+    auto operator++() noexcept -> basic_iterator& {
+        ++internal_iterator_;
+        skip_empty_tables();
+        return *this;
+    }
+
+    /*!
+     * \brief Move to the next value.
+     *
+     * \return Iterator before the move.
+     */
+    auto operator++(int) noexcept -> basic_iterator {
+        basic_iterator copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    /*!
+     * \brief Compare with another iterator.
+     *
+     * \param[in] right Right-hand-side object.
+     * \return Whether the iterators point to the same value.
+     */
+    [[nodiscard]] auto operator==(
+        const basic_iterator& right) const noexcept -> bool {
+        return table_ == right.table_ &&
+            internal_table_index_ == right.internal_table_index_ &&
+            internal_iterator_ == right.internal_iterator_;
+    }
+
+    /*!
+     * \brief Compare with another iterator.
+     *
+     * \param[in] right Right-hand-side object.
+     * \return Whether the iterators point to different values.
+     */
+    [[nodiscard]] auto operator!=(
+        const basic_iterator& right) const noexcept -> bool {
+        return !(*this == right);
+    }
+
+private:
+    friend class multi_open_address_table_st;
+
+    template <bool>
+    friend class basic_iterator;
+
+    //! Type of pointers to tables.
+    using table_pointer = std::conditional_t<IsConst,
+        const multi_open_address_table_st*, multi_open_address_table_st*>;
+
+    //! Type of iterators of internal tables.
+    using internal_iterator =
+        typename internal_table_type::template basic_iterator<IsConst>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * This moves to the first value at or after the beginning of the given
+     * internal table.
+     *
+     * \param[in] table Table.
+     * \param[in] internal_table_index Index of the internal table.
+     */
+    basic_iterator(table_pointer table, size_type internal_table_index) noexcept
+        : table_(table),
+          internal_table_index_(internal_table_index),
+          internal_iterator_(
+              table->internal_tables_[internal_table_index].get().begin()) {
+        skip_empty_tables();
+    }
+
+    /*!
+     * \brief Move to the first value in the current or following internal
+     * tables.
+     */
+    void skip_empty_tables() noexcept {
+        while (internal_iterator_ == internal_iterator()) {
+            ++internal_table_index_;
+            if (internal_table_index_ == table_->internal_tables_.size()) {
+                table_ = nullptr;
+                internal_table_index_ = 0;
+                return;
+            }
+            internal_iterator_ =
+                table_->internal_tables_[internal_table_index_].get().begin();
+        }
+    }
+
+    //! Table. (Null at the end.)
+    table_pointer table_{nullptr};
+
+    //! Index of the current internal table.
+    size_type internal_table_index_{0};
+
+    //! Iterator in the current internal table.
+    internal_iterator internal_iterator_{};
+};
+
 }  // namespace hash_tables::tables
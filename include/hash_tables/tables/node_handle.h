@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of node_handle class.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "hash_tables/utility/is_trivially_relocatable.h"
+#include "hash_tables/utility/value_storage.h"
+
+namespace hash_tables::tables {
+
+/*!
+ * \brief Class of handles of values extracted from tables.
+ *
+ * A handle owns a value removed from a table together with the hash number
+ * of its key, so that the value can be inserted into another table of the
+ * same type without constructing a new value or calculating the hash number
+ * again.
+ *
+ * \tparam ValueType Type of values.
+ */
+template <typename ValueType>
+class node_handle {
+public:
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    /*!
+     * \brief Constructor of an empty handle.
+     */
+    node_handle() noexcept = default;
+
+    node_handle(const node_handle&) = delete;
+    auto operator=(const node_handle&) -> node_handle& = delete;
+
+    /*!
+     * \brief Move constructor.
+     *
+     * \param[in,out] obj Object to move from. (Empty after this function.)
+     */
+    node_handle(node_handle&& obj) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        move_from(obj);
+    }
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param[in,out] obj Object to move from. (Empty after this function.)
+     * \return This.
+     */
+    auto operator=(node_handle&& obj) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) -> node_handle& {
+        if (this != &obj) {
+            clear();
+            move_from(obj);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Destructor.
+     */
+    ~node_handle() noexcept { clear(); }
+
+    /*!
+     * \brief Check whether this handle is empty.
+     *
+     * \return Whether this handle is empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool { return !has_value_; }
+
+    /*!
+     * \brief Check whether this handle has a value.
+     *
+     * \return Whether this handle has a value.
+     */
+    explicit operator bool() const noexcept { return has_value_; }
+
+    /*!
+     * \brief Get the value.
+     *
+     * \return Value.
+     *
+     * \warning Keys must not be changed through this function.
+     */
+    [[nodiscard]] auto value() noexcept -> value_type& {
+        assert(has_value_);
+        return storage_.get();
+    }
+
+    /*!
+     * \brief Get the value.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] auto value() const noexcept -> const value_type& {
+        assert(has_value_);
+        return storage_.get();
+    }
+
+    /*!
+     * \brief Get the hash number of the key of the value.
+     *
+     * \return Hash number.
+     */
+    [[nodiscard]] auto hash_number() const noexcept -> size_type {
+        assert(has_value_);
+        return hash_number_;
+    }
+
+    /*!
+     * \brief Construct a value.
+     *
+     * This function is used by tables to fill empty handles.
+     *
+     * \tparam Args Type of arguments.
+     * \param[in] hash_number Hash number of the key of the value.
+     * \param[in] args Arguments of the constructor of the value.
+     */
+    template <typename... Args>
+    void emplace(size_type hash_number, Args&&... args) {
+        assert(!has_value_);
+        storage_.emplace(std::forward<Args>(args)...);
+        hash_number_ = hash_number;
+        has_value_ = true;
+    }
+
+    /*!
+     * \brief Destroy the value if exists.
+     */
+    void clear() noexcept {
+        if (has_value_) {
+            storage_.clear();
+            has_value_ = false;
+        }
+    }
+
+private:
+    /*!
+     * \brief Move the value from another handle to this empty handle.
+     *
+     * \param[in,out] obj Object to move from.
+     */
+    void move_from(node_handle& obj) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        if (!obj.has_value_) {
+            return;
+        }
+        if constexpr (utility::is_trivially_relocatable_v<value_type>) {
+            storage_.relocate_from(obj.storage_);
+        } else {
+            storage_.emplace(std::move(obj.storage_.get()));
+            obj.storage_.clear();
+        }
+        hash_number_ = obj.hash_number_;
+        has_value_ = true;
+        obj.has_value_ = false;
+    }
+
+    //! Storage of the value.
+    utility::value_storage<value_type> storage_{};
+
+    //! Hash number of the key of the value.
+    size_type hash_number_{0};
+
+    //! Whether this handle has a value.
+    bool has_value_{false};
+};
+
+}  // namespace hash_tables::tables
@@ -0,0 +1,450 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of policies of hash tables using open addressing.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "hash_tables/utility/count_right_zero_bits.h"
+#include "hash_tables/utility/multiply_high.h"
+
+namespace hash_tables::tables::policies {
+
+/*!
+ * \brief Strategy to leave marks of erased values in nodes (tombstones).
+ */
+struct tombstone_strategy {};
+
+/*!
+ * \brief Strategy of Robin Hood hashing with backward-shift deletion.
+ *
+ * Values far from the nodes determined by their hash numbers take the nodes
+ * of values near to their nodes in insertion, and values after an erased value
+ * are shifted back in deletion, so no tombstone is left.
+ *
+ * \note Types of values are required to be nothrow move constructible in this
+ * strategy.
+ */
+struct robin_hood_strategy {};
+
+/*!
+ * \brief Probing to search nodes one by one.
+ */
+struct linear_probing {
+    /*!
+     * \brief Calculate the offset of a node from the node determined by hash
+     * number.
+     *
+     * \param[in] dist Number of nodes searched before.
+     * \return Offset.
+     */
+    [[nodiscard]] static constexpr auto offset(
+        std::size_t dist, std::size_t /*num_nodes*/) noexcept -> std::size_t {
+        return dist;
+    }
+};
+
+/*!
+ * \brief Probing to search nodes with offsets of square numbers (0, 1, 4, 9,
+ * ...).
+ *
+ * Because square numbers don't reach all nodes, nodes are searched one by one
+ * after searching as many nodes as the number of nodes.
+ *
+ * \note This probing cannot be used with robin_hood_strategy.
+ */
+struct quadratic_probing {
+    /*!
+     * \brief Calculate the offset of a node from the node determined by hash
+     * number.
+     *
+     * \param[in] dist Number of nodes searched before.
+     * \param[in] num_nodes Number of nodes.
+     * \return Offset.
+     */
+    [[nodiscard]] static constexpr auto offset(
+        std::size_t dist, std::size_t num_nodes) noexcept -> std::size_t {
+        if (dist < num_nodes) {
+            return dist * dist;
+        }
+        const std::size_t last = num_nodes - 1U;
+        return last * last + (dist - last);
+    }
+};
+
+/*!
+ * \brief Probing to search nodes with offsets of triangular numbers (0, 1, 3,
+ * 6, ...).
+ *
+ * Triangular numbers reach all nodes when the number of nodes is a power of
+ * two. Otherwise, nodes are searched one by one after searching as many nodes
+ * as the number of nodes.
+ *
+ * \note This probing cannot be used with robin_hood_strategy.
+ */
+struct triangular_probing {
+    /*!
+     * \brief Calculate the offset of a node from the node determined by hash
+     * number.
+     *
+     * \param[in] dist Number of nodes searched before.
+     * \param[in] num_nodes Number of nodes.
+     * \return Offset.
+     */
+    [[nodiscard]] static constexpr auto offset(
+        std::size_t dist, std::size_t num_nodes) noexcept -> std::size_t {
+        if (dist < num_nodes) {
+            return dist * (dist + 1U) / 2U;
+        }
+        const std::size_t last = num_nodes - 1U;
+        return last * (last + 1U) / 2U + (dist - last);
+    }
+};
+
+namespace internal {
+
+/*!
+ * \brief Get the multiplier of Fibonacci hashing (2^N / golden ratio).
+ *
+ * \return Multiplier.
+ */
+[[nodiscard]] constexpr auto fibonacci_multiplier() noexcept -> std::size_t {
+    if constexpr (std::numeric_limits<std::size_t>::digits == 64) {  // NOLINT
+        return static_cast<std::size_t>(0x9E3779B97F4A7C15U);
+    } else {
+        return static_cast<std::size_t>(0x9E3779B9U);
+    }
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Slot mapping using lower bits of hash numbers.
+ *
+ * The number of nodes is a power of two.
+ */
+class mask_slot_mapping {
+public:
+    //! Whether the number of nodes must be a power of two.
+    static constexpr bool requires_power_of_two = true;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_nodes Number of nodes.
+     */
+    explicit mask_slot_mapping(std::size_t num_nodes) noexcept
+        : mask_(num_nodes - 1U) {}
+
+    /*!
+     * \brief Calculate the node index determined by a hash number.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Node index.
+     */
+    [[nodiscard]] auto node_ind_of(std::size_t hash_number) const noexcept
+        -> std::size_t {
+        return hash_number & mask_;
+    }
+
+    /*!
+     * \brief Calculate the node index after a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto add(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        return (node_ind + offset) & mask_;
+    }
+
+    /*!
+     * \brief Calculate the node index before a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto subtract(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        return (node_ind - offset) & mask_;
+    }
+
+private:
+    //! Bit mask.
+    std::size_t mask_;
+};
+
+/*!
+ * \brief Slot mapping using upper bits of hash numbers multiplied by 2^N /
+ * golden ratio (Fibonacci hashing).
+ *
+ * The number of nodes is a power of two. This mapping uses all bits of hash
+ * numbers, so that hash functions with weak lower bits (for example,
+ * identity functions of integers) don't make clusters of values.
+ */
+class fibonacci_slot_mapping {
+public:
+    //! Whether the number of nodes must be a power of two.
+    static constexpr bool requires_power_of_two = true;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_nodes Number of nodes. (Must be two or more.)
+     */
+    explicit fibonacci_slot_mapping(std::size_t num_nodes) noexcept
+        : mask_(num_nodes - 1U),
+          shift_(static_cast<std::size_t>(
+                     std::numeric_limits<std::size_t>::digits) -
+              utility::count_right_zero_bits(num_nodes)) {}
+
+    /*!
+     * \brief Calculate the node index determined by a hash number.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Node index.
+     */
+    [[nodiscard]] auto node_ind_of(std::size_t hash_number) const noexcept
+        -> std::size_t {
+        return (hash_number * internal::fibonacci_multiplier()) >> shift_;
+    }
+
+    /*!
+     * \brief Calculate the node index after a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto add(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        return (node_ind + offset) & mask_;
+    }
+
+    /*!
+     * \brief Calculate the node index before a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto subtract(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        return (node_ind - offset) & mask_;
+    }
+
+private:
+    //! Bit mask.
+    std::size_t mask_;
+
+    //! Number of bits to shift.
+    std::size_t shift_;
+};
+
+/*!
+ * \brief Slot mapping multiplying hash numbers by the number of nodes and
+ * taking upper bits (Lemire's fast range reduction).
+ *
+ * The number of nodes can be any number. Hash numbers are mixed by
+ * multiplication of Fibonacci hashing before the reduction, because the
+ * reduction uses only upper bits of hash numbers.
+ */
+class fastrange_slot_mapping {
+public:
+    //! Whether the number of nodes must be a power of two.
+    static constexpr bool requires_power_of_two = false;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_nodes Number of nodes.
+     */
+    explicit fastrange_slot_mapping(std::size_t num_nodes) noexcept
+        : num_nodes_(num_nodes) {}
+
+    /*!
+     * \brief Calculate the node index determined by a hash number.
+     *
+     * \param[in] hash_number Hash number.
+     * \return Node index.
+     */
+    [[nodiscard]] auto node_ind_of(std::size_t hash_number) const noexcept
+        -> std::size_t {
+        return utility::multiply_high(
+            hash_number * internal::fibonacci_multiplier(), num_nodes_);
+    }
+
+    /*!
+     * \brief Calculate the node index after a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto add(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        node_ind += offset;
+        if (node_ind >= num_nodes_) {
+            node_ind %= num_nodes_;
+        }
+        return node_ind;
+    }
+
+    /*!
+     * \brief Calculate the node index before a node.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] offset Offset.
+     * \return Node index.
+     */
+    [[nodiscard]] auto subtract(std::size_t node_ind, std::size_t offset) const
+        noexcept -> std::size_t {
+        offset %= num_nodes_;
+        if (node_ind >= offset) {
+            return node_ind - offset;
+        }
+        return node_ind + (num_nodes_ - offset);
+    }
+
+private:
+    //! Number of nodes.
+    std::size_t num_nodes_;
+};
+
+/*!
+ * \brief Growth to double the number of nodes.
+ */
+struct double_growth {
+    /*!
+     * \brief Calculate the minimum number of nodes after growth.
+     *
+     * \param[in] num_nodes Current number of nodes.
+     * \return Minimum number of nodes after growth.
+     */
+    [[nodiscard]] static constexpr auto grow(std::size_t num_nodes) noexcept
+        -> std::size_t {
+        return num_nodes * 2U;
+    }
+};
+
+/*!
+ * \brief Growth to multiply the number of nodes by 1.5.
+ *
+ * \note Slot mappings requiring numbers of nodes of powers of two round up
+ * the result to a power of two, so this is effective only with slot mappings
+ * like fastrange_slot_mapping.
+ */
+struct one_and_half_growth {
+    /*!
+     * \brief Calculate the minimum number of nodes after growth.
+     *
+     * \param[in] num_nodes Current number of nodes.
+     * \return Minimum number of nodes after growth.
+     */
+    [[nodiscard]] static constexpr auto grow(std::size_t num_nodes) noexcept
+        -> std::size_t {
+        return num_nodes + num_nodes / 2U;
+    }
+};
+
+/*!
+ * \brief Class of policies of hash tables using open addressing.
+ *
+ * \tparam Strategy Type of the strategy of insertion and deletion
+ * (tombstone_strategy or robin_hood_strategy).
+ * \tparam Probing Type of the probing (linear_probing, quadratic_probing,
+ * or triangular_probing).
+ * \tparam SlotMapping Type of the mapping from hash numbers to nodes
+ * (mask_slot_mapping, fibonacci_slot_mapping, or fastrange_slot_mapping).
+ * \tparam Growth Type of the growth of the number of nodes (double_growth or
+ * one_and_half_growth).
+ * \tparam StoreHash Whether to store hash numbers of keys in nodes.
+ * Stored hash numbers are compared before keys and reused in rehashing at the
+ * cost of memory of a hash number per node.
+ * \tparam SeparateValues Whether to store values in an array separated from
+ * nodes. Nodes then have only states, distances, and hash numbers (hash
+ * numbers are always stored), and values are read only for nodes with the
+ * same hash number as the searched key, which reduces memory access in
+ * probing for large values.
+ */
+template <typename Strategy = tombstone_strategy,
+    typename Probing = linear_probing,
+    typename SlotMapping = mask_slot_mapping,
+    typename Growth = double_growth, bool StoreHash = false,
+    bool SeparateValues = false>
+struct open_address_policy {
+    //! Type of the strategy of insertion and deletion.
+    using strategy_type = Strategy;
+
+    //! Type of the probing.
+    using probing_type = Probing;
+
+    //! Type of the mapping from hash numbers to nodes.
+    using slot_mapping_type = SlotMapping;
+
+    //! Type of the growth of the number of nodes.
+    using growth_type = Growth;
+
+    //! Whether to store hash numbers of keys in nodes.
+    static constexpr bool store_hash = StoreHash;
+
+    //! Whether to store values in an array separated from nodes.
+    static constexpr bool separate_values = SeparateValues;
+};
+
+//! Default policy of hash tables using open addressing.
+using default_open_address_policy = open_address_policy<>;
+
+//! Policy of hash tables using open addressing with Robin Hood hashing.
+using robin_hood_policy = open_address_policy<robin_hood_strategy>;
+
+//! Policy of hash tables using open addressing with values stored in an array
+//! separated from nodes, for large values.
+using separate_values_policy = open_address_policy<tombstone_strategy,
+    linear_probing, mask_slot_mapping, double_growth, true, true>;
+
+//! Default maximum number of values stored inline in small_table_policy.
+inline constexpr std::size_t default_small_table_inline_capacity = 8;
+
+/*!
+ * \brief Class of policies of hash tables storing a small number of values
+ * inline without allocation of memory.
+ *
+ * Maps and sets using open_address_table_st use small_open_address_table_st
+ * with this policy.
+ *
+ * \tparam InlineCapacity Maximum number of values stored inline. (1 to 64.)
+ * \tparam BasePolicy Type of the policy of open_address_table_st used when
+ * values don't fit in the inline storage (open_address_policy).
+ */
+template <std::size_t InlineCapacity = default_small_table_inline_capacity,
+    typename BasePolicy = default_open_address_policy>
+struct small_table_policy {
+    //! Maximum number of values stored inline.
+    static constexpr std::size_t inline_capacity = InlineCapacity;
+
+    //! Type of the policy of open_address_table_st.
+    using base_policy_type = BasePolicy;
+};
+
+}  // namespace hash_tables::tables::policies
@@ -19,11 +19,15 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -34,7 +38,12 @@
 
 #include "hash_tables/exceptions.h"
 #include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/node_handle.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/is_trivially_relocatable.h"
 #include "hash_tables/utility/move_if_nothrow_move_constructible.h"
+#include "hash_tables/utility/prefetch.h"
 #include "hash_tables/utility/round_up_to_power_of_two.h"
 #include "hash_tables/utility/value_storage.h"
 
@@ -42,17 +51,81 @@ namespace hash_tables::tables {
 
 namespace internal {
 
+/*!
+ * \brief Class to store hash numbers in nodes of open_address_table_st class.
+ *
+ * \tparam StoreHash Whether to store hash numbers.
+ */
+template <bool StoreHash>
+class open_address_table_st_node_hash {
+public:
+    /*!
+     * \brief Get the hash number.
+     *
+     * \return Hash number.
+     */
+    [[nodiscard]] auto hash_number() const noexcept -> std::size_t {
+        return hash_number_;
+    }
+
+    /*!
+     * \brief Set the hash number.
+     *
+     * \param[in] value Hash number.
+     */
+    void hash_number(std::size_t value) noexcept { hash_number_ = value; }
+
+private:
+    //! Hash number.
+    std::size_t hash_number_{0};
+};
+
+/*!
+ * \brief Class to store hash numbers in nodes of open_address_table_st class
+ * (specialization without storage).
+ */
+template <>
+class open_address_table_st_node_hash<false> {};
+
 /*!
  * \brief Class of nodes in open_address_table_st class.
  *
+ * The state and the distance (see dist() const) are stored in an integer.
+ * In Robin Hood hashing, the integer has 32 bits to store exact distances.
+ * Otherwise, the integer has 8 bits, which usually fits in the padding after
+ * the state, so nodes are not larger than nodes with only states.
+ *
  * \tparam ValueType Type of values.
+ * \tparam StoreHash Whether to store hash numbers.
+ * \tparam RobinHood Whether to use Robin Hood hashing.
  */
-template <typename ValueType>
-class open_address_table_st_node {
+template <typename ValueType, bool StoreHash = false, bool RobinHood = false>
+class open_address_table_st_node
+    : public open_address_table_st_node_hash<StoreHash> {
+private:
+    //! Type of the integer storing the state and the distance.
+    using bits_type = std::conditional_t<RobinHood, std::uint32_t, std::uint8_t>;
+
+    //! Number of bits for the state.
+    static constexpr unsigned int state_bits = 2U;
+
+    //! Bit mask of the state.
+    static constexpr bits_type state_mask = (1U << state_bits) - 1U;
+
 public:
     //! Type of values.
     using value_type = ValueType;
 
+    /*!
+     * \brief Maximum distance stored in nodes.
+     *
+     * Without Robin Hood hashing, larger distances are stored as this value,
+     * which means that the distance is unknown.
+     */
+    static constexpr std::uint32_t max_dist =
+        static_cast<std::uint32_t>(std::numeric_limits<bits_type>::max()) >>
+        state_bits;
+
     //! Enumeration of states of nodes.
     enum class node_state : std::uint8_t {
         //! Initial state.
@@ -75,11 +148,16 @@ public:
      *
      * \param[in] obj Object to copy from.
      */
-    open_address_table_st_node(const open_address_table_st_node& obj) {
-        if (obj.state_ == node_state::filled) {
+    open_address_table_st_node(const open_address_table_st_node& obj)
+        : open_address_table_st_node_hash<StoreHash>(obj) {
+        if constexpr (utility::is_bytewise_copyable_v<value_type>) {
+            // Copy bytes without branches so that arrays of nodes can be
+            // copied quickly.
+            storage_.copy_bytes_from(obj.storage_);
+        } else if (obj.state() == node_state::filled) {
             storage_.emplace(obj.value());
         }
-        state_ = obj.state_;
+        bits_ = obj.bits_;
     }
 
     open_address_table_st_node(open_address_table_st_node&&) = delete;
@@ -97,10 +175,11 @@ public:
         }
 
         clear();
-        if (obj.state_ == node_state::filled) {
+        if (obj.state() == node_state::filled) {
             storage_.emplace(obj.value());
         }
-        state_ = obj.state_;
+        bits_ = obj.bits_;
+        open_address_table_st_node_hash<StoreHash>::operator=(obj);
         return *this;
     }
 
@@ -119,9 +198,9 @@ public:
      */
     template <typename... Args>
     void emplace(Args&&... args) {
-        assert(state_ != node_state::filled);
+        assert(state() != node_state::filled);
         storage_.emplace(std::forward<Args>(args)...);
-        state_ = node_state::filled;
+        state(node_state::filled);
     }
 
     /*!
@@ -132,7 +211,7 @@ public:
      */
     template <typename... Args>
     void assign(Args&&... args) {
-        assert(state_ == node_state::filled);
+        assert(state() == node_state::filled);
         value() = value_type(std::forward<Args>(args)...);
     }
 
@@ -140,10 +219,44 @@ public:
      * \brief Clear the value.
      */
     void clear() noexcept {
-        if (state_ == node_state::filled) {
+        if (state() == node_state::filled) {
             storage_.clear();
-            state_ = node_state::erased;
+            state(node_state::erased);
+        }
+    }
+
+    /*!
+     * \brief Relocate the value in another node by copying bytes.
+     *
+     * The other node returns to the initial state without destruction of the
+     * value.
+     *
+     * \param[in,out] obj Node to relocate the value from.
+     *
+     * \note This function is valid only for trivially relocatable types.
+     * (See utility::is_trivially_relocatable.)
+     */
+    void relocate_from(open_address_table_st_node& obj) noexcept {
+        assert(state() != node_state::filled);
+        assert(obj.state() == node_state::filled);
+        storage_.relocate_from(obj.storage_);
+        state(node_state::filled);
+        obj.bits_ = 0U;
+    }
+
+    /*!
+     * \brief Clear the value and return to the initial state.
+     *
+     * When values are trivially destructible, this function has no branches,
+     * so that loops resetting many nodes are compiled to plain stores.
+     */
+    void reset() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            if (state() == node_state::filled) {
+                storage_.clear();
+            }
         }
+        bits_ = 0U;
     }
 
     /*!
@@ -151,7 +264,41 @@ public:
      *
      * \return State.
      */
-    [[nodiscard]] auto state() const noexcept -> node_state { return state_; }
+    [[nodiscard]] auto state() const noexcept -> node_state {
+        return static_cast<node_state>(bits_ & state_mask);
+    }
+
+    /*!
+     * \brief Get the distance.
+     *
+     * In Robin Hood hashing, this is the distance of the value in this node
+     * from the node determined by its hash number. Otherwise, this is the
+     * maximum distance of values from this node when this node is determined
+     * by their hash numbers, and max_dist means that the maximum distance is
+     * unknown.
+     *
+     * \return Distance.
+     */
+    [[nodiscard]] auto dist() const noexcept -> std::uint32_t {
+        return static_cast<std::uint32_t>(bits_ >> state_bits);
+    }
+
+    /*!
+     * \brief Set the distance.
+     *
+     * \param[in] value Distance. (Distances larger than max_dist are stored
+     * as max_dist without Robin Hood hashing.)
+     * \sa dist() const
+     */
+    void dist(std::uint32_t value) noexcept {
+        if constexpr (RobinHood) {
+            assert(value <= max_dist);
+        } else {
+            value = std::min(value, max_dist);
+        }
+        bits_ = static_cast<bits_type>((bits_ & state_mask) |
+            static_cast<bits_type>(value << state_bits));
+    }
 
     /*!
      * \brief Get the value.
@@ -159,7 +306,7 @@ public:
      * \return Value.
      */
     [[nodiscard]] auto value() noexcept -> value_type& {
-        assert(state_ == node_state::filled);
+        assert(state() == node_state::filled);
         return storage_.get();
     }
 
@@ -169,53 +316,62 @@ public:
      * \return Value.
      */
     [[nodiscard]] auto value() const noexcept -> const value_type& {
-        assert(state_ == node_state::filled);
+        assert(state() == node_state::filled);
+        return storage_.get();
+    }
+
+    /*!
+     * \brief Get the value without checking the state.
+     *
+     * This is used to read values while other threads may modify nodes, and
+     * the value may be broken.
+     *
+     * \return Value.
+     */
+    [[nodiscard]] auto value_unchecked() const noexcept -> const value_type& {
         return storage_.get();
     }
 
 private:
+    /*!
+     * \brief Set the state.
+     *
+     * \param[in] value State.
+     */
+    void state(node_state value) noexcept {
+        bits_ = static_cast<bits_type>(
+            (bits_ & ~state_mask) | static_cast<bits_type>(value));
+    }
+
     //! Storage for a value.
     utility::value_storage<value_type> storage_{};
 
-    //! State.
-    node_state state_{node_state::init};
+    //! State in the lower bits and distance in the upper bits.
+    bits_type bits_{0U};
 };
 
-}  // namespace internal
-
 /*!
- * \brief Class of hash tables using open addressing.
+ * \brief Class of arrays of nodes in open_address_table_st class.
+ *
+ * This class stores values in nodes.
  *
  * \tparam ValueType Type of values.
- * \tparam KeyType Type of keys.
- * \tparam ExtractKey Type of the function to extract keys from values.
- * \tparam Hash Type of the hash function.
- * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam StoreHash Whether to store hash numbers.
+ * \tparam RobinHood Whether to use Robin Hood hashing.
+ * \tparam SeparateValues Whether to store values in an array separated from
+ * nodes.
  * \tparam Allocator Type of allocators.
- *
- * \thread_safety Safe if only functions without modifications of data are
- * called.
  */
-template <typename ValueType, typename KeyType, typename ExtractKey,
-    typename Hash = hashes::default_hash<KeyType>,
-    typename KeyEqual = std::equal_to<KeyType>,
-    typename Allocator = std::allocator<ValueType>>
-class open_address_table_st {
+template <typename ValueType, bool StoreHash, bool RobinHood,
+    bool SeparateValues, typename Allocator>
+class open_address_table_st_nodes {
 public:
     //! Type of values.
     using value_type = ValueType;
 
-    //! Type of keys.
-    using key_type = KeyType;
-
-    //! Type of the function to extract keys from values.
-    using extract_key_type = ExtractKey;
-
-    //! Type of the hash function.
-    using hash_type = Hash;
-
-    //! Type of the function to check whether keys are equal.
-    using key_equal_type = KeyEqual;
+    //! Type of nodes.
+    using node_type =
+        open_address_table_st_node<value_type, StoreHash, RobinHood>;
 
     //! Type of allocators.
     using allocator_type = Allocator;
@@ -223,794 +379,3182 @@ public:
     //! Type of sizes.
     using size_type = std::size_t;
 
-    //! Default number of nodes.
-    static constexpr size_type default_num_nodes = 32;
-
-    /*!
-     * \brief Constructor.
-     */
-    open_address_table_st() : open_address_table_st(default_num_nodes) {}
-
     /*!
      * \brief Constructor.
      *
-     * \param[in] min_num_nodes Minimum number of nodes.
-     * \param[in] extract_key Function to extract keys from values.
-     * \param[in] hash Hash function.
-     * \param[in] key_equal Function to check whether keys are equal.
+     * \param[in] num_nodes Number of nodes.
      * \param[in] allocator Allocator.
      */
-    explicit open_address_table_st(size_type min_num_nodes,
-        extract_key_type extract_key = extract_key_type(),
-        hash_type hash = hash_type(),
-        key_equal_type key_equal = key_equal_type(),
-        allocator_type allocator = allocator_type())
-        : nodes_(determine_num_node_from_min_num_node(min_num_nodes),
-              node_allocator_type(std::move(allocator))),
-          extract_key_(std::move(extract_key)),
-          hash_(std::move(hash)),
-          key_equal_(std::move(key_equal)),
-          desired_node_ind_mask_(nodes_.size() - 1U) {}
-
-    /*!
-     * \brief Copy constructor.
-     */
-    open_address_table_st(const open_address_table_st&) = default;
+    open_address_table_st_nodes(
+        size_type num_nodes, const allocator_type& allocator)
+        : nodes_(num_nodes, node_allocator_type(allocator)) {}
 
     /*!
-     * \brief Move constructor.
+     * \brief Get the number of nodes.
+     *
+     * \return Number of nodes.
      */
-    open_address_table_st(open_address_table_st&&)
-#ifndef HASH_TABLES_DOCUMENTATION
-        noexcept(std::is_nothrow_move_constructible_v<extract_key_type> &&  //
-            std::is_nothrow_move_constructible_v<hash_type> &&              //
-            std::is_nothrow_move_constructible_v<key_equal_type> &&         //
-            std::is_nothrow_move_constructible_v<
-                std::vector<internal::open_address_table_st_node<value_type>,
-                    typename std::allocator_traits<allocator_type>::
-                        template rebind_alloc<
-                            internal::open_address_table_st_node<value_type>>>>)
-#endif
-        = default;
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return nodes_.size();
+    }
 
     /*!
-     * \brief Copy assignment operator.
+     * \brief Get the pointer to the first node.
      *
-     * \return This.
+     * \return Pointer.
      */
-    auto operator=(const open_address_table_st&) -> open_address_table_st&
-#ifndef HASH_TABLES_DOCUMENTATION
-        = default
-#endif
-        ;
+    [[nodiscard]] auto data() const noexcept -> const node_type* {
+        return nodes_.data();
+    }
 
     /*!
-     * \brief Move assignment operator.
+     * \brief Get the maximum number of nodes.
      *
-     * \return This.
+     * \return Maximum number of nodes.
      */
-    auto operator=(open_address_table_st&&)
-#ifndef HASH_TABLES_DOCUMENTATION
-        noexcept(std::is_nothrow_move_assignable_v<extract_key_type> &&  //
-            std::is_nothrow_move_assignable_v<hash_type> &&              //
-            std::is_nothrow_move_assignable_v<key_equal_type> &&         //
-            std::is_nothrow_move_assignable_v<
-                std::vector<internal::open_address_table_st_node<value_type>,
-                    typename std::allocator_traits<allocator_type>::
-                        template rebind_alloc<
-                            internal::open_address_table_st_node<value_type>>>>)
-#endif
-            -> open_address_table_st&
-#ifndef HASH_TABLES_DOCUMENTATION
-        = default
-#endif
-        ;
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return nodes_.max_size();
+    }
 
     /*!
-     * \brief Destructor.
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
      */
-    ~open_address_table_st() noexcept = default;
+    [[nodiscard]] auto get_allocator() const -> allocator_type {
+        return allocator_type(nodes_.get_allocator());
+    }
 
     /*!
-     * \name Create or update values.
+     * \brief Access a node.
+     *
+     * \param[in] node_ind Node index.
+     * \return Node.
      */
-    ///@{
+    [[nodiscard]] auto operator[](size_type node_ind) noexcept -> node_type& {
+        return nodes_[node_ind];
+    }
 
     /*!
-     * \brief Insert a value.
+     * \brief Access a node.
      *
-     * \param[in] value Value.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
+     * \param[in] node_ind Node index.
+     * \return Node.
      */
-    auto insert(const value_type& value) -> bool {
-        reserve(size_ + 1U);
-        return insert_without_rehash(value);
+    [[nodiscard]] auto operator[](size_type node_ind) const noexcept
+        -> const node_type& {
+        return nodes_[node_ind];
     }
 
     /*!
-     * \brief Insert a value.
+     * \brief Get the value in a node.
      *
-     * \param[in] value Value.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
+     * \param[in] node_ind Node index.
+     * \return Value.
      */
-    auto insert(value_type&& value) -> bool {
-        reserve(size_ + 1U);
-        return insert_without_rehash(std::move(value));
+    [[nodiscard]] auto value(size_type node_ind) noexcept -> value_type& {
+        return nodes_[node_ind].value();
     }
 
     /*!
-     * \brief Insert a value from the arguments of its constructor.
+     * \brief Get the value in a node.
      *
-     * \tparam Args Type of arguments of the constructor.
-     * \param[in] key Key of the value. (Assumed to be equal to the key of the
-     * value constructed from arguments.)
-     * \param[in] args Arguments of the constructor.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
+     * \param[in] node_ind Node index.
+     * \return Value.
      */
-    template <typename... Args>
-    auto emplace(const key_type& key, Args&&... args) -> bool {
-        reserve(size_ + 1U);
-        return emplace_without_rehash(key, std::forward<Args>(args)...);
+    [[nodiscard]] auto value(size_type node_ind) const noexcept
+        -> const value_type& {
+        return nodes_[node_ind].value();
     }
 
     /*!
-     * \brief Insert a value from the arguments of its constructor if not exist,
-     * or assign to an existing value.
+     * \brief Construct a value in a node.
      *
-     * \tparam Args Type of arguments of the constructor.
-     * \param[in] key Key of the value. (Assumed to be equal to the key of the
-     * value constructed from arguments.)
+     * \tparam Args Type of arguments.
+     * \param[in] node_ind Node index.
      * \param[in] args Arguments of the constructor.
-     * \retval true Value is inserted.
-     * \retval false Value is assigned to an existing value.
      */
     template <typename... Args>
-    auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
-        reserve(size_ + 1U);
-        const auto [node_ptr, dist] = prepare_place_for(key);
-        if (node_ptr->state() == node_type::node_state::filled) {
-            node_ptr->assign(std::forward<Args>(args)...);
-            return false;
-        }
-        node_ptr->emplace(std::forward<Args>(args)...);
-        update_max_dist_if_needed(dist);
-        ++size_;
-        return true;
+    void emplace(size_type node_ind, Args&&... args) {
+        nodes_[node_ind].emplace(std::forward<Args>(args)...);
     }
 
     /*!
-     * \brief Assign a value to an existing key from the arguments of its
-     * constructor.
+     * \brief Assign a value in a node.
      *
-     * \tparam Args Type of arguments of the constructor.
-     * \param[in] key Key of the value. (Assumed to be equal to the key of the
-     * value constructed from arguments.)
+     * \tparam Args Type of arguments.
+     * \param[in] node_ind Node index.
      * \param[in] args Arguments of the constructor.
-     * \retval true Value is assigned.
-     * \retval false Value is not assigned due to non-existing key.
      */
     template <typename... Args>
-    auto assign(const key_type& key, Args&&... args) -> bool {
-        const auto [node_ptr, dist] = prepare_place_for(key);
-        if (node_ptr->state() == node_type::node_state::filled) {
-            node_ptr->assign(std::forward<Args>(args)...);
-            return true;
-        }
-        return false;
+    void assign(size_type node_ind, Args&&... args) {
+        nodes_[node_ind].assign(std::forward<Args>(args)...);
     }
 
-    ///@}
-
-    /*!
-     * \name Read values.
-     */
-    ///@{
-
     /*!
-     * \brief Get a value.
+     * \brief Clear the value in a node leaving a tombstone.
      *
-     * \param[in] key Key.
-     * \return Value.
+     * \param[in] node_ind Node index.
      */
-    [[nodiscard]] auto at(const key_type& key) -> value_type& {
-        return nodes_[require_node_ind_for(key)].value();
-    }
+    void clear(size_type node_ind) noexcept { nodes_[node_ind].clear(); }
 
     /*!
-     * \brief Get a value.
+     * \brief Clear the value in a node and return to the initial state.
      *
-     * \param[in] key Key.
-     * \return Value.
+     * \param[in] node_ind Node index.
      */
-    [[nodiscard]] auto at(const key_type& key) const -> const value_type& {
-        return nodes_[require_node_ind_for(key)].value();
-    }
+    void reset(size_type node_ind) noexcept { nodes_[node_ind].reset(); }
 
     /*!
-     * \brief Get a value constructing it if not found.
+     * \brief Clear all values and return all nodes to the initial state.
      *
-     * \tparam Args Type of arguments of the constructor.
-     * \param[in] key Key.
-     * \param[in] args Arguments of the constructor.
-     * \return Value.
+     * When values are trivially destructible, nodes are reset without
+     * checking their states.
      */
-    template <typename... Args>
-    [[nodiscard]] auto get_or_create(const key_type& key, Args&&... args)
-        -> value_type& {
-        reserve(size_ + 1U);
-        const auto [node_ptr, dist] = prepare_place_for(key);
-        if (node_ptr->state() != node_type::node_state::filled) {
-            node_ptr->emplace(std::forward<Args>(args)...);
-            update_max_dist_if_needed(dist);
-            ++size_;
+    void reset_all() noexcept {
+        for (auto& node : nodes_) {
+            node.reset();
         }
-        return node_ptr->value();
     }
 
     /*!
-     * \brief Get a value constructing using a factory function it if not found.
+     * \brief Relocate the value in a node of another array by copying bytes.
      *
-     * \tparam Function Type of the factory function.
-     * \param[in] key Key.
-     * \param[in] function Factory function.
-     * \return Value.
+     * \param[in] node_ind Node index.
+     * \param[in,out] from Array of nodes to relocate the value from.
+     * \param[in] from_node_ind Index of the node to relocate the value from.
+     *
+     * \note This function is valid only for trivially relocatable types.
      */
-    template <typename Function>
-    [[nodiscard]] auto get_or_create_with_factory(
-        const key_type& key, Function&& function) -> value_type& {
-        reserve(size_ + 1U);
-        const auto [node_ptr, dist] = prepare_place_for(key);
-        if (node_ptr->state() != node_type::node_state::filled) {
-            node_ptr->emplace(std::invoke(std::forward<Function>(function)));
-            update_max_dist_if_needed(dist);
-            ++size_;
-        }
-        return node_ptr->value();
+    void relocate_from(size_type node_ind, open_address_table_st_nodes& from,
+        size_type from_node_ind) noexcept {
+        nodes_[node_ind].relocate_from(from.nodes_[from_node_ind]);
     }
 
-    /*!
-     * \brief Get a value if found.
-     *
-     * \param[in] key Key.
-     * \return Pointer to the value if found, otherwise nullptr.
-     */
-    [[nodiscard]] auto try_get(const key_type& key) -> value_type* {
-        const auto node_ind = find_node_ind_for(key);
-        if (!node_ind) {
-            return nullptr;
+private:
+    //! Type of allocators of nodes.
+    using node_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<node_type>;
+
+    //! Nodes.
+    std::vector<node_type, node_allocator_type> nodes_;
+};
+
+/*!
+ * \brief Class of empty values in nodes without values.
+ */
+struct open_address_table_st_no_value {};
+
+/*!
+ * \brief Class of arrays of nodes in open_address_table_st class
+ * (specialization to store values in an array separated from nodes).
+ *
+ * Nodes have only states, distances, and hash numbers, and values are stored
+ * in another array with the same indices, so that searching a key reads
+ * values only in nodes with the same hash number.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam StoreHash Whether to store hash numbers.
+ * \tparam RobinHood Whether to use Robin Hood hashing.
+ * \tparam Allocator Type of allocators.
+ */
+template <typename ValueType, bool StoreHash, bool RobinHood,
+    typename Allocator>
+class open_address_table_st_nodes<ValueType, StoreHash, RobinHood, true,
+    Allocator> {
+public:
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of nodes.
+    using node_type = open_address_table_st_node<open_address_table_st_no_value,
+        StoreHash, RobinHood>;
+
+    //! Type of allocators.
+    using allocator_type = Allocator;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_nodes Number of nodes.
+     * \param[in] allocator Allocator.
+     */
+    open_address_table_st_nodes(
+        size_type num_nodes, const allocator_type& allocator)
+        : nodes_(num_nodes, node_allocator_type(allocator)),
+          values_(num_nodes, storage_allocator_type(allocator)) {}
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \param[in] obj Object to copy from.
+     */
+    open_address_table_st_nodes(const open_address_table_st_nodes& obj)
+        : nodes_(obj.nodes_),
+          values_(obj.values_.size(), obj.values_.get_allocator()) {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if constexpr (utility::is_bytewise_copyable_v<value_type>) {
+                values_[i].copy_bytes_from(obj.values_[i]);
+            } else if (nodes_[i].state() == node_type::node_state::filled) {
+                try {
+                    values_[i].emplace(obj.values_[i].get());
+                } catch (...) {
+                    // Leave only the copied values to be destroyed.
+                    for (size_type j = i; j < nodes_.size(); ++j) {
+                        nodes_[j].reset();
+                    }
+                    clear_all();
+                    throw;
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Move constructor.
+     */
+    open_address_table_st_nodes(open_address_table_st_nodes&&) noexcept =
+        default;
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * \param[in] obj Object to copy from.
+     * \return This.
+     */
+    auto operator=(const open_address_table_st_nodes& obj)
+        -> open_address_table_st_nodes& {
+        if (this != &obj) {
+            *this = open_address_table_st_nodes(obj);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param[in,out] obj Object to move from.
+     * \return This.
+     */
+    auto operator=(open_address_table_st_nodes&& obj) noexcept
+        -> open_address_table_st_nodes& {
+        if (this != &obj) {
+            clear_all();
+            nodes_.swap(obj.nodes_);
+            values_.swap(obj.values_);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Destructor.
+     */
+    ~open_address_table_st_nodes() noexcept { clear_all(); }
+
+    /*!
+     * \brief Get the number of nodes.
+     *
+     * \return Number of nodes.
+     */
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return nodes_.size();
+    }
+
+    /*!
+     * \brief Get the maximum number of nodes.
+     *
+     * \return Maximum number of nodes.
+     */
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return std::min(nodes_.max_size(), values_.max_size());
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto get_allocator() const -> allocator_type {
+        return allocator_type(nodes_.get_allocator());
+    }
+
+    /*!
+     * \brief Access a node.
+     *
+     * \param[in] node_ind Node index.
+     * \return Node.
+     */
+    [[nodiscard]] auto operator[](size_type node_ind) noexcept -> node_type& {
+        return nodes_[node_ind];
+    }
+
+    /*!
+     * \brief Access a node.
+     *
+     * \param[in] node_ind Node index.
+     * \return Node.
+     */
+    [[nodiscard]] auto operator[](size_type node_ind) const noexcept
+        -> const node_type& {
+        return nodes_[node_ind];
+    }
+
+    /*!
+     * \brief Get the value in a node.
+     *
+     * \param[in] node_ind Node index.
+     * \return Value.
+     */
+    [[nodiscard]] auto value(size_type node_ind) noexcept -> value_type& {
+        assert(nodes_[node_ind].state() == node_type::node_state::filled);
+        return values_[node_ind].get();
+    }
+
+    /*!
+     * \brief Get the value in a node.
+     *
+     * \param[in] node_ind Node index.
+     * \return Value.
+     */
+    [[nodiscard]] auto value(size_type node_ind) const noexcept
+        -> const value_type& {
+        assert(nodes_[node_ind].state() == node_type::node_state::filled);
+        return values_[node_ind].get();
+    }
+
+    /*!
+     * \brief Construct a value in a node.
+     *
+     * \tparam Args Type of arguments.
+     * \param[in] node_ind Node index.
+     * \param[in] args Arguments of the constructor.
+     */
+    template <typename... Args>
+    void emplace(size_type node_ind, Args&&... args) {
+        values_[node_ind].emplace(std::forward<Args>(args)...);
+        nodes_[node_ind].emplace();
+    }
+
+    /*!
+     * \brief Assign a value in a node.
+     *
+     * \tparam Args Type of arguments.
+     * \param[in] node_ind Node index.
+     * \param[in] args Arguments of the constructor.
+     */
+    template <typename... Args>
+    void assign(size_type node_ind, Args&&... args) {
+        value(node_ind) = value_type(std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Clear the value in a node leaving a tombstone.
+     *
+     * \param[in] node_ind Node index.
+     */
+    void clear(size_type node_ind) noexcept {
+        if (nodes_[node_ind].state() == node_type::node_state::filled) {
+            values_[node_ind].clear();
+        }
+        nodes_[node_ind].clear();
+    }
+
+    /*!
+     * \brief Clear the value in a node and return to the initial state.
+     *
+     * \param[in] node_ind Node index.
+     */
+    void reset(size_type node_ind) noexcept {
+        if (nodes_[node_ind].state() == node_type::node_state::filled) {
+            values_[node_ind].clear();
+        }
+        nodes_[node_ind].reset();
+    }
+
+    /*!
+     * \brief Clear all values and return all nodes to the initial state.
+     *
+     * Values are checked only when they are not trivially destructible, and
+     * nodes without values are reset without checking their states.
+     */
+    void reset_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < nodes_.size(); ++i) {
+                if (nodes_[i].state() == node_type::node_state::filled) {
+                    values_[i].clear();
+                }
+            }
+        }
+        for (auto& node : nodes_) {
+            node.reset();
+        }
+    }
+
+    /*!
+     * \brief Relocate the value in a node of another array by copying bytes.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in,out] from Array of nodes to relocate the value from.
+     * \param[in] from_node_ind Index of the node to relocate the value from.
+     *
+     * \note This function is valid only for trivially relocatable types.
+     */
+    void relocate_from(size_type node_ind, open_address_table_st_nodes& from,
+        size_type from_node_ind) noexcept {
+        values_[node_ind].relocate_from(from.values_[from_node_ind]);
+        nodes_[node_ind].relocate_from(from.nodes_[from_node_ind]);
+    }
+
+private:
+    //! Type of allocators of nodes.
+    using node_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<node_type>;
+
+    //! Type of storages of values.
+    using storage_type = utility::value_storage<value_type>;
+
+    //! Type of allocators of storages of values.
+    using storage_allocator_type = typename std::allocator_traits<
+        allocator_type>::template rebind_alloc<storage_type>;
+
+    /*!
+     * \brief Destroy all values.
+     */
+    void clear_all() noexcept {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                values_[i].clear();
+                nodes_[i].reset();
+            }
+        }
+    }
+
+    //! Nodes.
+    std::vector<node_type, node_allocator_type> nodes_;
+
+    //! Values in nodes with the same indices.
+    std::vector<storage_type, storage_allocator_type> values_;
+};
+
+}  // namespace internal
+
+#ifndef HASH_TABLES_DOCUMENTATION
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash, typename KeyEqual, typename Allocator,
+    std::size_t MinNumTables, typename Policy>
+class multi_open_address_table_st;
+#endif
+
+/*!
+ * \brief Class of hash tables using open addressing.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy
+ * (policies::default_open_address_policy or policies::robin_hood_policy).
+ *
+ * \thread_safety Safe if only functions without modifications of data are
+ * called.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash = hashes::default_hash<KeyType>,
+    typename KeyEqual = std::equal_to<KeyType>,
+    typename Allocator = std::allocator<ValueType>,
+    typename Policy = policies::default_open_address_policy>
+class open_address_table_st {
+public:
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of keys.
+    using key_type = KeyType;
+
+    //! Type of the function to extract keys from values.
+    using extract_key_type = ExtractKey;
+
+    //! Type of the hash function.
+    using hash_type = Hash;
+
+    //! Type of the function to check whether keys are equal.
+    using key_equal_type = KeyEqual;
+
+    //! Type of allocators.
+    using allocator_type = Allocator;
+
+    //! Type of the policy.
+    using policy_type = Policy;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    //! Default number of nodes.
+    static constexpr size_type default_num_nodes = 32;
+
+    //! Whether to use Robin Hood hashing.
+    static constexpr bool use_robin_hood =
+        std::is_same_v<typename policy_type::strategy_type,
+            policies::robin_hood_strategy>;
+
+    //! Whether to store values in an array separated from nodes.
+    static constexpr bool separate_values = policy_type::separate_values;
+
+    //! Whether to store hash numbers of keys in nodes. (Always true when
+    //! values are separated from nodes.)
+    static constexpr bool store_hash =
+        policy_type::store_hash || separate_values;
+
+    static_assert(
+        !use_robin_hood || std::is_nothrow_move_constructible_v<value_type>,
+        "Robin Hood hashing requires nothrow move constructible values.");
+
+    static_assert(!use_robin_hood ||
+            std::is_same_v<typename policy_type::probing_type,
+                policies::linear_probing>,
+        "Robin Hood hashing requires linear probing.");
+
+    /*!
+     * \brief Class of forward iterators of values in tables.
+     *
+     * Iterators visit values in the current nodes and then values in the old
+     * nodes of incremental rehashing, skipping nodes without values.
+     *
+     * \tparam IsConst Whether values are accessed as constant values.
+     *
+     * \note Iterators are invalidated by any modification of the table
+     * including insertion, deletion, and rehashing.
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        //! Type of the category of iterators.
+        using iterator_category = std::forward_iterator_tag;
+
+        //! Type of values.
+        using value_type = typename open_address_table_st::value_type;
+
+        //! Type of differences of iterators.
+        using difference_type = std::ptrdiff_t;
+
+        //! Type of pointers to values.
+        using pointer =
+            std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        //! Type of references to values.
+        using reference =
+            std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        /*!
+         * \brief Constructor of the iterator at the end.
+         */
+        basic_iterator() noexcept = default;
+
+        /*!
+         * \brief Constructor to convert a non-constant iterator to a constant
+         * iterator.
+         *
+         * \tparam OtherIsConst Whether the other iterator is constant.
+         * \param[in] obj Iterator.
+         */
+        template <bool OtherIsConst,
+            typename = std::enable_if_t<IsConst && !OtherIsConst>>
+        basic_iterator(  // NOLINT(google-explicit-constructor)
+            const basic_iterator<OtherIsConst>& obj) noexcept
+            : table_(obj.table_), node_ind_(obj.node_ind_) {}
+
+        /*!
+         * \brief Get the value.
+         *
+         * \return Value.
+         */
+        [[nodiscard]] auto operator*() const noexcept -> reference {
+            return table_->nodes_.value(node_ind_);
+        }
+
+        /*!
+         * \brief Get the pointer to the value.
+         *
+         * \return Pointer to the value.
+         */
+        [[nodiscard]] auto operator->() const noexcept -> pointer {
+            return std::addressof(table_->nodes_.value(node_ind_));
+        }
+
+        /*!
+         * \brief Move to the next value.
+         *
+         * \return This iterator.
+         */
+        auto operator++() noexcept -> basic_iterator& {
+            ++node_ind_;
+            skip_empty_nodes();
+            return *this;
+        }
+
+        /*!
+         * \brief Move to the next value.
+         *
+         * \return Iterator before the move.
+         */
+        auto operator++(int) noexcept -> basic_iterator {
+            basic_iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        /*!
+         * \brief Compare with another iterator.
+         *
+         * \param[in] right Right-hand-side object.
+         * \return Whether the iterators point to the same node.
+         */
+        [[nodiscard]] auto operator==(
+            const basic_iterator& right) const noexcept -> bool {
+            return table_ == right.table_ && node_ind_ == right.node_ind_;
+        }
+
+        /*!
+         * \brief Compare with another iterator.
+         *
+         * \param[in] right Right-hand-side object.
+         * \return Whether the iterators point to different nodes.
+         */
+        [[nodiscard]] auto operator!=(
+            const basic_iterator& right) const noexcept -> bool {
+            return !(*this == right);
+        }
+
+    private:
+        friend class open_address_table_st;
+
+        template <bool>
+        friend class basic_iterator;
+
+        //! Type of pointers to tables.
+        using table_pointer = std::conditional_t<IsConst,
+            const open_address_table_st*, open_address_table_st*>;
+
+        /*!
+         * \brief Constructor.
+         *
+         * This moves to the first node with a value at or after the given
+         * node.
+         *
+         * \param[in] table Table.
+         * \param[in] node_ind Index of the node.
+         */
+        basic_iterator(table_pointer table, size_type node_ind) noexcept
+            : table_(table), node_ind_(node_ind) {
+            skip_empty_nodes();
+        }
+
+        /*!
+         * \brief Move to the first node with a value at or after the current
+         * node.
+         */
+        void skip_empty_nodes() noexcept {
+            while (table_ != nullptr) {
+                const auto& nodes = table_->nodes_;
+                for (; node_ind_ < nodes.size(); ++node_ind_) {
+                    if (nodes[node_ind_].state() ==
+                        node_type::node_state::filled) {
+                        return;
+                    }
+                }
+                table_ = table_->migrating_table_.get();
+                node_ind_ = 0;
+            }
+        }
+
+        //! Table of the current node. (Null at the end.)
+        table_pointer table_{nullptr};
+
+        //! Index of the current node.
+        size_type node_ind_{0};
+    };
+
+    //! Type of iterators.
+    using iterator = basic_iterator<false>;
+
+    //! Type of constant iterators.
+    using const_iterator = basic_iterator<true>;
+
+    //! Type of handles of values extracted from tables.
+    using node_handle_type = node_handle<value_type>;
+
+    /*!
+     * \brief Constructor.
+     */
+    open_address_table_st() : open_address_table_st(default_num_nodes) {}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] min_num_nodes Minimum number of nodes.
+     * \param[in] extract_key Function to extract keys from values.
+     * \param[in] hash Hash function.
+     * \param[in] key_equal Function to check whether keys are equal.
+     * \param[in] allocator Allocator.
+     */
+    explicit open_address_table_st(size_type min_num_nodes,
+        extract_key_type extract_key = extract_key_type(),
+        hash_type hash = hash_type(),
+        key_equal_type key_equal = key_equal_type(),
+        allocator_type allocator = allocator_type())
+        : nodes_(determine_num_node_from_min_num_node(min_num_nodes),
+              allocator),
+          extract_key_(std::move(extract_key)),
+          hash_(std::move(hash)),
+          key_equal_(std::move(key_equal)),
+          slot_mapping_(nodes_.size()) {}
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \param[in] obj Object to copy from.
+     */
+    open_address_table_st(const open_address_table_st& obj)
+        : nodes_(obj.nodes_),
+          size_(obj.size_),
+          num_erased_(obj.num_erased_),
+          extract_key_(obj.extract_key_),
+          hash_(obj.hash_),
+          key_equal_(obj.key_equal_),
+          max_load_factor_(obj.max_load_factor_),
+          min_load_factor_(obj.min_load_factor_),
+          incremental_rehash_step_(obj.incremental_rehash_step_),
+          migrating_table_(obj.migrating_table_
+                  ? std::make_unique<open_address_table_st>(
+                        *obj.migrating_table_)
+                  : nullptr),
+          migrating_node_ind_(obj.migrating_node_ind_),
+          migration_step_(obj.migration_step_),
+          slot_mapping_(obj.slot_mapping_) {}
+
+    /*!
+     * \brief Move constructor.
+     */
+    open_address_table_st(open_address_table_st&&)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_constructible_v<extract_key_type> &&  //
+            std::is_nothrow_move_constructible_v<hash_type> &&              //
+            std::is_nothrow_move_constructible_v<key_equal_type> &&         //
+            std::is_nothrow_move_constructible_v<
+                internal::open_address_table_st_nodes<value_type, store_hash,
+                    use_robin_hood, separate_values, allocator_type>>)
+#endif
+        = default;
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * \param[in] obj Object to copy from.
+     * \return This.
+     */
+    auto operator=(const open_address_table_st& obj) -> open_address_table_st& {
+        if (this != &obj) {
+            *this = open_address_table_st(obj);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \return This.
+     */
+    auto operator=(open_address_table_st&&)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_assignable_v<extract_key_type> &&  //
+            std::is_nothrow_move_assignable_v<hash_type> &&              //
+            std::is_nothrow_move_assignable_v<key_equal_type> &&         //
+            std::is_nothrow_move_assignable_v<
+                internal::open_address_table_st_nodes<value_type, store_hash,
+                    use_robin_hood, separate_values, allocator_type>>)
+#endif
+            -> open_address_table_st&
+#ifndef HASH_TABLES_DOCUMENTATION
+        = default
+#endif
+        ;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~open_address_table_st() noexcept = default;
+
+    /*!
+     * \name Create or update values.
+     */
+    ///@{
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(const value_type& value) -> bool {
+        return insert_with_hash(value, hash_(extract_key_(value)));
+    }
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(value_type&& value) -> bool {
+        const size_type hash_number = hash_(extract_key_(value));
+        return insert_with_hash(std::move(value), hash_number);
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace(const key_type& key, Args&&... args) -> bool {
+        return emplace_with_hash(key, hash_(key), std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(const value_type& value, size_type hash_number)
+        -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the
+     * hash number of its key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        prepare_for_insertion_with_hash(key, hash_number);
+        return emplace_without_rehash_with_hash(
+            key, hash_number, std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Insert a value extracted from a table.
+     *
+     * The hash number in the handle is used without calculating it again, so
+     * the handle must be extracted from a table whose hash function calculates
+     * the same hash numbers as hash().
+     *
+     * \param[in,out] node Handle of the value. (Empty after this function if
+     * the value is inserted.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key or an empty
+     * handle.
+     */
+    auto insert(node_handle_type&& node) -> bool {
+        if (node.empty()) {
+            return false;
+        }
+        if (!emplace_with_hash(extract_key_(node.value()), node.hash_number(),
+                std::move(node.value()))) {
+            return false;
+        }
+        node.clear();
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * Unlike emplace function, this function searches the key before any
+     * preparation for insertion, so that existing keys are handled quickly.
+     * Arguments are used only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \return Reference to the inserted or existing value, and whether the
+     * value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args)
+        -> std::pair<value_type&, bool> {
+        const size_type hash_number = hash_(key);
+        if (auto* value = find_value_for(key, hash_number)) {
+            return {*value, false};
+        }
+        prepare_nodes_for_insertion();
+        const auto [node_ind, dist] = prepare_place_for_new_key(hash_number);
+        emplace_at(node_ind, dist, hash_number, std::forward<Args>(args)...);
+        return {nodes_.value(node_ind), true};
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor if not exist,
+     * or assign to an existing value.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is assigned to an existing value.
+     */
+    template <typename... Args>
+    auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
+        const size_type hash_number = hash_(key);
+        prepare_for_insertion_with_hash(key, hash_number);
+        const auto [node_ind, dist, found] =
+            prepare_place_for(key, hash_number);
+        if (found) {
+            nodes_.assign(node_ind, std::forward<Args>(args)...);
+            return false;
+        }
+        emplace_at(node_ind, dist, hash_number, std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Assign a value to an existing key from the arguments of its
+     * constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is assigned.
+     * \retval false Value is not assigned due to non-existing key.
+     */
+    template <typename... Args>
+    auto assign(const key_type& key, Args&&... args) -> bool {
+        value_type* value = find_value_for(key);
+        if (value == nullptr) {
+            return false;
+        }
+        *value = value_type(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        value_type* value = find_value_for(key);
+        if (value == nullptr) {
+            return false;
+        }
+        std::invoke(std::forward<Function>(function), *value);
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The key is searched only once.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        const size_type hash_number = hash_(key);
+        if (auto* value = find_value_for(key, hash_number)) {
+            std::invoke(std::forward<Function>(function), *value);
+            return false;
+        }
+        prepare_nodes_for_insertion();
+        const auto [node_ind, dist] = prepare_place_for_new_key(hash_number);
+        emplace_at(node_ind, dist, hash_number,
+            std::invoke(std::forward<Factory>(factory)));
+        return true;
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * Values with keys not in this table are moved to this table, and the
+     * other values remain in the other table. Nodes for all values are
+     * reserved beforehand so that this table is rehashed at most once.
+     *
+     * Hash numbers of keys in the other table are reused when hash_type has no
+     * state. Otherwise, the hash function of the other table may calculate
+     * different hash numbers, so hash numbers are calculated again using the
+     * hash function of this table.
+     *
+     * \param[in,out] other Table to move values from.
+     */
+    void merge(open_address_table_st& other) {
+        if (&other == this) {
+            return;
+        }
+        other.finish_migration();
+        reserve(size() + other.size());
+        other.erase_nodes_if([this, &other](size_type node_ind) {
+            auto& value = other.nodes_.value(node_ind);
+            const auto& key = other.extract_key_(value);
+            size_type hash_number{};
+            if constexpr (std::is_empty_v<hash_type>) {
+                hash_number = other.hash_number_of(node_ind);
+            } else {
+                hash_number = hash_(key);
+            }
+            return emplace_with_hash(key, hash_number,
+                utility::move_if_nothrow_move_constructible(value));
+        });
+        other.shrink_if_needed();
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * \param[in,out] other Table to move values from.
+     * \sa merge(open_address_table_st&)
+     */
+    void merge(open_address_table_st&& other) { merge(other); }
+
+    ///@}
+
+    /*!
+     * \name Read values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     */
+    [[nodiscard]] auto at(const key_type& key) -> value_type& {
+        return require_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) -> value_type& {
+        return require_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     */
+    [[nodiscard]] auto at(const key_type& key) const -> const value_type& {
+        return require_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> const value_type& {
+        return require_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename... Args>
+    [[nodiscard]] auto get_or_create(const key_type& key, Args&&... args)
+        -> value_type& {
+        const size_type hash_number = hash_(key);
+        prepare_for_insertion_with_hash(key, hash_number);
+        const auto [node_ind, dist, found] =
+            prepare_place_for(key, hash_number);
+        if (!found) {
+            emplace_at(
+                node_ind, dist, hash_number, std::forward<Args>(args)...);
+        }
+        return nodes_.value(node_ind);
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type& {
+        const size_type hash_number = hash_(key);
+        prepare_for_insertion_with_hash(key, hash_number);
+        const auto [node_ind, dist, found] =
+            prepare_place_for(key, hash_number);
+        if (!found) {
+            emplace_at(
+                node_ind, dist, hash_number, std::forward<Args>(args)...);
+        }
+        return nodes_.value(node_ind);
+    }
+
+    /*!
+     * \brief Get a value constructing using a factory function it if not found.
+     *
+     * \tparam Function Type of the factory function.
+     * \param[in] key Key.
+     * \param[in] function Factory function.
+     * \return Value.
+     */
+    template <typename Function>
+    [[nodiscard]] auto get_or_create_with_factory(
+        const key_type& key, Function&& function) -> value_type& {
+        const size_type hash_number = hash_(key);
+        prepare_for_insertion_with_hash(key, hash_number);
+        const auto [node_ind, dist, found] =
+            prepare_place_for(key, hash_number);
+        if (!found) {
+            emplace_at(node_ind, dist, hash_number,
+                std::invoke(std::forward<Function>(function)));
+        }
+        return nodes_.value(node_ind);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) -> value_type* {
+        return find_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) -> value_type* {
+        return find_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) const -> const value_type* {
+        return find_value_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const -> const value_type* {
+        return find_value_for(key);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has(const key_type& key) const -> bool {
+        return find_value_for(key) != nullptr;
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return find_value_for(key) != nullptr;
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) -> value_type* {
+        return find_value_for(key, hash_number);
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(const key_type& key,
+        size_type hash_number) const -> const value_type* {
+        return find_value_for(key, hash_number);
+    }
+
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return find_value_for(key, hash_number) != nullptr;
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * Hash numbers of keys are calculated and the nodes of the keys are
+     * prefetched in chunks before searching the keys, so that latency of
+     * memory access for one key is hidden by processing of other keys.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) {
+        hash_in_batch(keys,
+            [this, &keys, &outputs](size_type i, size_type hash_number) {
+                outputs[i] = find_value_for(keys[i], hash_number);
+            });
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) const {
+        hash_in_batch(keys,
+            [this, &keys, &outputs](size_type i, size_type hash_number) {
+                outputs[i] = find_value_for(keys[i], hash_number);
+            });
+    }
+
+    /*!
+     * \brief Check whether multiple keys exist.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from bool values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Whether the keys exist. (Written in the same order
+     * as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void has_batch(const Keys& keys, Outputs&& outputs) const {
+        hash_in_batch(keys,
+            [this, &keys, &outputs](size_type i, size_type hash_number) {
+                outputs[i] = find_value_for(keys[i], hash_number) != nullptr;
+            });
+    }
+
+    /*!
+     * \brief Prefetch the node in which searching a key starts.
+     *
+     * This function only hints the processor to load the memory, so calling
+     * this function before searching some keys can hide latency of memory
+     * access.
+     *
+     * \tparam KeyLike Type of the key. (Must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \param[in] key Key.
+     */
+    template <typename KeyLike,
+        utility::enable_lookup_t<hash_type, key_equal_type, key_type,
+            KeyLike> = nullptr>
+    void prefetch(const KeyLike& key) const {
+        utility::prefetch(&nodes_[desired_node_ind(key)]);
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                std::invoke(
+                    function, static_cast<value_type&>(nodes_.value(i)));
+            }
+        }
+        if (migrating_table_) {
+            migrating_table_->for_all(function);
+        }
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) const {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                std::invoke(
+                    function, static_cast<const value_type&>(nodes_.value(i)));
+            }
+        }
+        if (migrating_table_) {
+            std::as_const(*migrating_table_).for_all(function);
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Iterate over values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(this, 0);
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(this, 0);
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() noexcept -> iterator { return iterator(); }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * Start with cursor 0 and pass the returned cursor to the next call until
+     * 0 is returned, so that all values can be visited in small steps.
+     * Values are visited exactly once if the table is not modified between
+     * calls. Otherwise, some values may be skipped or visited more than once.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items, Function&& function)
+        -> size_type {
+        assert(max_items > 0U);
+        auto iter = iterator_at_cursor<false>(this, cursor);
+        for (size_type i = 0; i < max_items && iter != end(); ++i, ++iter) {
+            std::invoke(function, *iter);
+        }
+        return cursor_of(iter);
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     * \sa scan(size_type, size_type, Function&&)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items,
+        Function&& function) const -> size_type {
+        assert(max_items > 0U);
+        auto iter = iterator_at_cursor<true>(this, cursor);
+        for (size_type i = 0; i < max_items && iter != end(); ++i, ++iter) {
+            std::invoke(function, *iter);
+        }
+        return cursor_of(iter);
+    }
+
+    ///@}
+
+    /*!
+     * \name Delete values.
+     */
+    ///@{
+
+    /*!
+     * \brief Delete all values.
+     *
+     * All nodes return to the initial state without tombstones, and nodes
+     * are not touched when neither values nor tombstones exist.
+     */
+    void clear() noexcept {
+        migrating_table_.reset();
+        if (size_ == 0U && num_erased_ == 0U) {
+            return;
+        }
+        nodes_.reset_all();
+        size_ = 0;
+        num_erased_ = 0;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase(const key_type& key) -> bool {
+        return erase_for(key, hash_(key));
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        return erase_for(key, hash_(key));
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        return erase_for(key, hash_number);
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    [[nodiscard]] auto extract(const key_type& key) -> node_handle_type {
+        return extract_for(key, hash_(key));
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto extract(const KeyLike& key) -> node_handle_type {
+        return extract_for(key, hash_(key));
+    }
+
+    /*!
+     * \brief Delete values which satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check the condition.
+     * \return Number of removed values.
+     */
+    template <typename Function>
+    auto erase_if(Function&& function) -> size_type {
+        finish_migration();
+        const size_type removed =
+            erase_nodes_if([this, &function](size_type node_ind) {
+                return std::invoke(function,
+                    static_cast<const value_type&>(nodes_.value(node_ind)));
+            });
+        shrink_if_needed();
+        return removed;
+    }
+
+    ///@}
+
+    /*!
+     * \name Check conditions for elements.
+     */
+    ///@{
+
+    /*!
+     * \brief Check whether all elements satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true All elements satisfied the condition.
+     * \retval false Some elements didn't satisfy the condition.
+     */
+    template <typename Function>
+    auto check_all_satisfy(Function&& function) const -> bool {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                if (!std::invoke(function,
+                        static_cast<const value_type&>(nodes_.value(i)))) {
+                    return false;
+                }
+            }
+        }
+        return !migrating_table_ ||
+            std::as_const(*migrating_table_).check_all_satisfy(function);
+    }
+
+    /*!
+     * \brief Check whether at least one element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true At least one element satisfied the condition.
+     * \retval false No element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_any_satisfy(Function&& function) const -> bool {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                if (std::invoke(function,
+                        static_cast<const value_type&>(nodes_.value(i)))) {
+                    return true;
+                }
+            }
+        }
+        return migrating_table_ &&
+            std::as_const(*migrating_table_).check_any_satisfy(function);
+    }
+
+    /*!
+     * \brief Check whether no element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true No element satisfied the condition.
+     * \retval false At least one element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_none_satisfy(Function&& function) const -> bool {
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                if (std::invoke(function,
+                        static_cast<const value_type&>(nodes_.value(i)))) {
+                    return false;
+                }
+            }
+        }
+        return !migrating_table_ ||
+            std::as_const(*migrating_table_).check_none_satisfy(function);
+    }
+
+    ///@}
+
+    /*!
+     * \name Handle size.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the number of values.
+     *
+     * \return Number of values.
+     */
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        if (migrating_table_) {
+            return size_ + migrating_table_->size_;
+        }
+        return size_;
+    }
+
+    /*!
+     * \brief Check whether this object is empty.
+     *
+     * \retval true This object is empty.
+     * \retval false This object is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+    /*!
+     * \brief Get the maximum number of values.
+     *
+     * \return Maximum number of values.
+     */
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return nodes_.max_size();
+    }
+
+    /*!
+     * \brief Reserve enough place for values.
+     *
+     * \param[in] size Number of values.
+     */
+    void reserve(size_type size) {
+        rehash(static_cast<size_type>(
+            std::ceil(static_cast<float>(size) / max_load_factor_)));
+    }
+
+    /*!
+     * \brief Decrease the number of nodes to the minimum number for the
+     * current values.
+     */
+    void shrink_to_fit() {
+        finish_migration();
+        const size_type num_nodes =
+            determine_num_node_from_min_num_node(static_cast<size_type>(
+                std::ceil(static_cast<float>(size_) / max_load_factor_)));
+        if (num_nodes >= nodes_.size() && num_erased_ == 0U) {
+            return;
+        }
+        rehash_to(num_nodes);
+    }
+
+    ///@}
+
+    /*!
+     * \name Access to internal information.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the function to extract keys from values.
+     *
+     * \return Function to extract keys from values.
+     */
+    [[nodiscard]] auto extract_key() const noexcept -> const extract_key_type& {
+        return extract_key_;
+    }
+
+    /*!
+     * \brief Get the hash function.
+     *
+     * \return Hash function.
+     */
+    [[nodiscard]] auto hash() const noexcept -> const hash_type& {
+        return hash_;
+    }
+
+    /*!
+     * \brief Get the function to check whether keys are equal.
+     *
+     * \return Function to check whether keys are equal.
+     */
+    [[nodiscard]] auto key_equal() const noexcept -> const key_equal_type& {
+        return key_equal_;
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto allocator() const -> allocator_type {
+        return allocator_type(nodes_.get_allocator());
+    }
+
+    /*!
+     * \brief Get the number of nodes.
+     *
+     * \return Number of nodes.
+     */
+    [[nodiscard]] auto num_nodes() const noexcept -> size_type {
+        return nodes_.size();
+    }
+
+    /*!
+     * \brief Change the number of nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     */
+    void rehash(size_type min_num_node) {
+        if (min_num_node < nodes_.size()) {
+            return;
+        }
+        rehash_to(min_num_node);
+    }
+
+    /*!
+     * \brief Remove marks of erased values (tombstones) rebuilding nodes
+     * without changing the number of nodes.
+     *
+     * This function is called automatically when too many nodes are used by
+     * values and tombstones, but can be called explicitly in idle time.
+     */
+    void compact() {
+        if (num_erased_ == 0U) {
+            return;
+        }
+        rehash_to(nodes_.size());
+    }
+
+    /*!
+     * \brief Get the number of marks of erased values (tombstones).
+     *
+     * \return Number of tombstones.
+     */
+    [[nodiscard]] auto num_erased() const noexcept -> size_type {
+        return num_erased_;
+    }
+
+    /*!
+     * \brief Get the load factor (number of values / number of nodes).
+     *
+     * \return Load factor.
+     */
+    auto load_factor() -> float {
+        return static_cast<float>(size()) / static_cast<float>(nodes_.size());
+    }
+
+    /*!
+     * \brief Get the maximum load factor (number of values / number of nodes).
+     *
+     * \return Maximum load factor.
+     */
+    auto max_load_factor() -> float { return max_load_factor_; }
+
+    /*!
+     * \brief Set the maximum load factor (number of values / number of nodes).
+     *
+     * \param[in] value Maximum load factor. (Must be larger than twice the
+     * minimum load factor.)
+     */
+    void max_load_factor(float value) {
+        if (value <= 0.0F || 1.0F <= value ||
+            value * 0.5F <= min_load_factor_) {
+            throw std::invalid_argument("Invalid maximum load factor.");
         }
-        return &nodes_[*node_ind].value();
+        max_load_factor_ = value;
     }
 
     /*!
-     * \brief Get a value if found.
+     * \brief Get the minimum load factor (number of values / number of nodes).
      *
-     * \param[in] key Key.
-     * \return Pointer to the value if found, otherwise nullptr.
+     * \return Minimum load factor.
      */
-    [[nodiscard]] auto try_get(const key_type& key) const -> const value_type* {
-        const auto node_ind = find_node_ind_for(key);
-        if (!node_ind) {
-            return nullptr;
+    auto min_load_factor() -> float { return min_load_factor_; }
+
+    /*!
+     * \brief Set the minimum load factor (number of values / number of nodes).
+     *
+     * When the load factor becomes smaller than this value by deletion of
+     * values, the number of nodes is decreased using shrink_to_fit function.
+     * Zero (default) disables this behavior.
+     *
+     * \param[in] value Minimum load factor. (Must be smaller than the half of
+     * the maximum load factor.)
+     */
+    void min_load_factor(float value) {
+        if (value < 0.0F || max_load_factor_ * 0.5F <= value) {
+            throw std::invalid_argument("Invalid minimum load factor.");
         }
-        return &nodes_[*node_ind].value();
+        min_load_factor_ = value;
     }
 
     /*!
-     * \brief Check whether a key exists.
+     * \brief Get the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing.
      *
-     * \param[in] key Key.
-     * \retval true Key exists.
-     * \retval false Key doesn't exists.
+     * \return Number of nodes. (Zero if incremental rehashing is disabled.)
      */
-    [[nodiscard]] auto has(const key_type& key) const -> bool {
-        return static_cast<bool>(find_node_ind_for(key));
+    [[nodiscard]] auto incremental_rehash_step() const noexcept -> size_type {
+        return incremental_rehash_step_;
     }
 
     /*!
-     * \brief Call a function with all values.
+     * \brief Set the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function.
+     * When this value is positive, increasing the number of nodes in
+     * insertions doesn't move all values at once. Instead, old nodes are kept
+     * with new nodes, and values in this number of old nodes are moved to the
+     * new nodes in each of the following insertions and deletions. Values in
+     * both nodes can be searched until all values are moved. This bounds the
+     * time of each insertion at the cost of slower searches during rehashing.
+     * Zero (default) disables incremental rehashing.
+     *
+     * \note If this value is too small to move all values before the number
+     * of nodes needs to be increased again, a larger number of nodes
+     * determined by the maximum load factor and the growth policy is processed
+     * in each insertion or deletion instead, so the time of each insertion
+     * stays bounded. A new positive value is used from the next incremental
+     * rehashing.
+     *
+     * \note Allocation of new nodes at the start of incremental rehashing still
+     * takes time proportional to the number of nodes. Functions changing the
+     * number of nodes explicitly (rehash, reserve, shrink_to_fit) and removal
+     * of tombstones still move all values at once.
+     *
+     * \param[in] value Number of nodes.
      */
-    template <typename Function>
-    void for_all(Function&& function) {
-        for (auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                std::invoke(function, static_cast<value_type&>(node.value()));
-            }
+    void incremental_rehash_step(size_type value) {
+        incremental_rehash_step_ = value;
+        if (value == 0U) {
+            finish_migration();
         }
     }
 
     /*!
-     * \brief Call a function with all values.
+     * \brief Check whether incremental rehashing is in progress.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function.
+     * \retval true Some values are left in old nodes.
+     * \retval false No value is left in old nodes.
      */
-    template <typename Function>
-    void for_all(Function&& function) const {
-        for (const auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                std::invoke(
-                    function, static_cast<const value_type&>(node.value()));
+    [[nodiscard]] auto is_rehashing() const noexcept -> bool {
+        return static_cast<bool>(migrating_table_);
+    }
+
+    /*!
+     * \brief Class of views of tables to find values while other threads may
+     * modify the tables.
+     *
+     * \sa create_read_view
+     */
+    class read_view;
+
+    /*!
+     * \brief Create a view to find values while other threads may modify this
+     * table.
+     *
+     * Views copy the pointer to nodes, the number of nodes, and the mapping to
+     * nodes, so that searches in a view access only the nodes at the creation
+     * of the view. This is used in concurrent tables reading values without
+     * locks, which must check that no thread modified this table during the
+     * creation of a view and during a search, and must keep the memory of
+     * nodes released in rehashing.
+     *
+     * \note Searches in views can return broken values when other threads
+     * modify this table, but never access memory out of the nodes.
+     * \note Values in old nodes of incremental rehashing are not searched.
+     *
+     * \return View.
+     */
+    [[nodiscard]] auto create_read_view() const noexcept -> read_view {
+        static_assert(!separate_values,
+            "Views of tables with separate values are not supported.");
+        return read_view(*this);
+    }
+
+    ///@}
+
+private:
+    // multi_open_address_table_st moves values out of internal tables in
+    // merge.
+    template <typename, typename, typename, typename, typename, typename,
+        std::size_t, typename>
+    friend class multi_open_address_table_st;
+
+    //! Type of arrays of nodes.
+    using nodes_type = internal::open_address_table_st_nodes<value_type,
+        store_hash, use_robin_hood, separate_values, allocator_type>;
+
+    //! Type of nodes.
+    using node_type = typename nodes_type::node_type;
+
+    //! Type of the probing.
+    using probing_type = typename policy_type::probing_type;
+
+    //! Type of the mapping from hash numbers to node indices.
+    using slot_mapping_type = typename policy_type::slot_mapping_type;
+
+    //! Type of the growth of the number of nodes.
+    using growth_type = typename policy_type::growth_type;
+
+    //! Whether to relocate values by copying bytes.
+    static constexpr bool use_relocation =
+        utility::is_trivially_relocatable_v<value_type>;
+
+public:
+    /*!
+     * \brief Class of views of tables to find values while other threads may
+     * modify the tables.
+     *
+     * \sa create_read_view
+     */
+    class read_view {
+    public:
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] table Table.
+         */
+        explicit read_view(const open_address_table_st& table) noexcept
+            : nodes_(table.nodes_.data()),
+              num_nodes_(table.nodes_.size()),
+              slot_mapping_(table.slot_mapping_),
+              table_(&table) {}
+
+        /*!
+         * \brief Find a value.
+         *
+         * This searches nodes in the same way as the table, but stops after
+         * visiting as many nodes as the nodes in this view in case nodes are
+         * broken.
+         *
+         * \tparam KeyLike Type of the key.
+         * \param[in] key Key.
+         * \return Pointer to the value if found, otherwise nullptr.
+         */
+        template <typename KeyLike>
+        [[nodiscard]] auto find(const KeyLike& key) const
+            -> const value_type* {
+            const size_type hash_number = table_->hash_(key);
+            size_type node_ind = slot_mapping_.node_ind_of(hash_number);
+            if constexpr (use_robin_hood) {
+                for (size_type dist = 0; dist < num_nodes_; ++dist) {
+                    const node_type& node = node_at(node_ind);
+                    if (node.state() != node_type::node_state::filled ||
+                        node.dist() < dist) {
+                        return nullptr;
+                    }
+                    if (has_key(node, key, hash_number)) {
+                        return &node.value_unchecked();
+                    }
+                    node_ind = slot_mapping_.add(node_ind, 1U);
+                }
+            } else {
+                const size_type desired_node_ind = node_ind;
+                const size_type max_dist =
+                    max_dist_from(node_at(node_ind), num_nodes_);
+                for (size_type dist = 0;
+                     dist <= max_dist && dist < num_nodes_;) {
+                    const node_type& node = node_at(node_ind);
+                    if (node.state() == node_type::node_state::filled &&
+                        has_key(node, key, hash_number)) {
+                        return &node.value_unchecked();
+                    }
+                    if (node.state() == node_type::node_state::init) {
+                        return nullptr;
+                    }
+                    ++dist;
+                    node_ind = slot_mapping_.add(desired_node_ind,
+                        probing_type::offset(dist, num_nodes_));
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        /*!
+         * \brief Access a node.
+         *
+         * \param[in] node_ind Node index.
+         * \return Node.
+         */
+        [[nodiscard]] auto node_at(size_type node_ind) const noexcept
+            -> const node_type& {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return nodes_[node_ind];
+        }
+
+        /*!
+         * \brief Check whether a node has a key.
+         *
+         * \tparam KeyLike Type of the key.
+         * \param[in] node Node with a value.
+         * \param[in] key Key.
+         * \param[in] hash_number Hash number of the key.
+         * \retval true The node has the key.
+         * \retval false The node has a value with another key.
+         */
+        template <typename KeyLike>
+        [[nodiscard]] auto has_key(const node_type& node, const KeyLike& key,
+            [[maybe_unused]] size_type hash_number) const -> bool {
+            if constexpr (store_hash) {
+                if (node.hash_number() != hash_number) {
+                    return false;
+                }
             }
+            return table_->key_equal_(
+                table_->extract_key_(node.value_unchecked()), key);
+        }
+
+        //! Nodes.
+        const node_type* nodes_;
+
+        //! Number of nodes.
+        size_type num_nodes_;
+
+        //! Mapping from hash numbers to node indices.
+        slot_mapping_type slot_mapping_;
+
+        //! Table.
+        const open_address_table_st* table_;
+    };
+
+private:
+
+    /*!
+     * \brief Determine the number of nodes from the minimum number of nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     * \return Number of nodes to use.
+     */
+    [[nodiscard]] static auto determine_num_node_from_min_num_node(
+        size_type min_num_node) -> size_type {
+        size_type required_num_nodes = min_num_node;
+        if constexpr (slot_mapping_type::requires_power_of_two) {
+            required_num_nodes =
+                utility::round_up_to_power_of_two(required_num_nodes);
+        }
+        if (required_num_nodes < default_num_nodes) {
+            required_num_nodes = default_num_nodes;
         }
+        return required_num_nodes;
     }
 
-    ///@}
+    /*!
+     * \brief Calculate the node index determined by hash number.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Node index.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto desired_node_ind(const KeyLike& key) const
+        -> size_type {
+        const size_type hash_number = hash_(key);
+        return slot_mapping_.node_ind_of(hash_number);
+    }
 
     /*!
-     * \name Delete values.
+     * \brief Rebuild nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     */
+    void rehash_to(size_type min_num_node) {
+        finish_migration();
+        open_address_table_st new_table{
+            min_num_node, extract_key_, hash_, key_equal_, allocator()};
+        for (size_type i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].state() == node_type::node_state::filled) {
+                const size_type hash_number = hash_number_of(i);
+                const auto [node_ind, dist] =
+                    new_table.prepare_place_for_new_key(hash_number);
+                if constexpr (use_relocation) {
+                    new_table.relocate_at(
+                        node_ind, dist, hash_number, nodes_, i);
+                } else {
+                    new_table.emplace_at(node_ind, dist, hash_number,
+                        utility::move_if_nothrow_move_constructible(
+                            nodes_.value(i)));
+                }
+            }
+        }
+        std::swap(nodes_, new_table.nodes_);
+        std::swap(slot_mapping_, new_table.slot_mapping_);
+        num_erased_ = 0;
+    }
+
+    /*!
+     * \name Internal functions for incremental rehashing.
      */
     ///@{
 
     /*!
-     * \brief Delete all values.
+     * \brief Start incremental rehashing.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
      */
-    void clear() noexcept {
-        for (auto& node : nodes_) {
-            node.clear();
+    void start_migration(size_type min_num_node) {
+        finish_migration();
+        auto old_table = std::make_unique<open_address_table_st>(
+            min_num_node, extract_key_, hash_, key_equal_, allocator());
+        std::swap(nodes_, old_table->nodes_);
+        std::swap(size_, old_table->size_);
+        std::swap(num_erased_, old_table->num_erased_);
+        std::swap(slot_mapping_, old_table->slot_mapping_);
+        // Start from an empty node so that values shifted back in deletion
+        // are visited only once.
+        migrating_node_ind_ = 0;
+        while (old_table->nodes_[migrating_node_ind_].state() ==
+            node_type::node_state::filled) {
+            ++migrating_node_ind_;
         }
-        size_ = 0;
+        migrating_table_ = std::move(old_table);
+        migration_step_ = determine_migration_step();
     }
 
     /*!
-     * \brief Delete a value.
+     * \brief Determine the number of old nodes processed in each step of the
+     * current incremental rehashing.
      *
-     * \param[in] key Key.
-     * \retval true Deleted the value.
-     * \retval false Failed to delete the value because the key not found.
+     * The number is increased from incremental_rehash_step() if needed so that
+     * all values are moved before the number of nodes needs to be increased
+     * again.
+     *
+     * \return Number of old nodes.
+     */
+    [[nodiscard]] auto determine_migration_step() const -> size_type {
+        const auto& old_table = *migrating_table_;
+        // Each old node is skipped once and each value is moved once.
+        const size_type required_steps =
+            old_table.nodes_.size() + old_table.size_;
+        const auto max_num_values = static_cast<size_type>(
+            static_cast<float>(nodes_.size()) * max_load_factor_);
+        // Insertions after the current one until the number of nodes needs to
+        // be increased again, excluding the last one to leave a margin.
+        const size_type current_num_values = size() + 1U;
+        const size_type num_insertions =
+            (max_num_values > current_num_values + 1U)
+            ? max_num_values - current_num_values - 1U
+            : 1U;
+        const size_type min_step =
+            (required_steps + num_insertions - 1U) / num_insertions;
+        return std::max(incremental_rehash_step_, min_step);
+    }
+
+    /*!
+     * \brief Move values in old nodes to the current nodes.
+     *
+     * \param[in] num_steps Number of old nodes to process.
+     */
+    void migrate_nodes(size_type num_steps) {
+        auto& old_table = *migrating_table_;
+        for (size_type i = 0; i < num_steps && old_table.size_ > 0U; ++i) {
+            if (old_table.nodes_[migrating_node_ind_].state() ==
+                node_type::node_state::filled) {
+                // Another value may be shifted to this node, so the same node
+                // is checked again.
+                migrate_node(migrating_node_ind_);
+            } else {
+                migrating_node_ind_ =
+                    old_table.slot_mapping_.add(migrating_node_ind_, 1U);
+            }
+        }
+        if (old_table.size_ == 0U) {
+            migrating_table_.reset();
+        }
+    }
+
+    /*!
+     * \brief Move all values in old nodes to the current nodes.
      */
-    auto erase(const key_type& key) -> bool {
-        const auto node_ind = find_node_ind_for(key);
-        if (!node_ind) {
-            return false;
+    void finish_migration() {
+        if (migrating_table_) {
+            migrate_nodes(std::numeric_limits<size_type>::max());
         }
-        nodes_[*node_ind].clear();
-        --size_;
-        return true;
     }
 
     /*!
-     * \brief Delete values which satisfy a condition.
+     * \brief Move a value in old nodes to the current nodes if found.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function to check the condition.
-     * \return Number of removed values.
+     * \param[in] node_ind Index of the old node. (Null if not found.)
      */
-    template <typename Function>
-    auto erase_if(Function&& function) -> size_type {
-        size_type removed = 0;
-        for (auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                if (std::invoke(function,
-                        static_cast<const value_type&>(node.value()))) {
-                    node.clear();
-                    ++removed;
-                    --size_;
-                }
-            }
+    void migrate_node_if_found(std::optional<size_type> node_ind) {
+        if (!node_ind) {
+            return;
         }
-        return removed;
+        migrate_node(*node_ind);
+        if (migrating_table_->size_ == 0U) {
+            migrating_table_.reset();
+        }
+    }
+
+    /*!
+     * \brief Move a value in an old node to the current nodes.
+     *
+     * \param[in] node_ind Index of the old node.
+     */
+    void migrate_node(size_type node_ind) {
+        auto& old_table = *migrating_table_;
+        auto& value = old_table.nodes_.value(node_ind);
+        emplace_without_rehash_with_hash(extract_key_(value),
+            old_table.hash_number_of(node_ind),
+            utility::move_if_nothrow_move_constructible(value));
+        old_table.erase_at(node_ind);
     }
 
     ///@}
 
     /*!
-     * \name Check conditions for elements.
+     * \name Internal functions to create or update values.
      */
     ///@{
 
     /*!
-     * \brief Check whether all elements satisfy a condition.
+     * \brief Prepare nodes for insertion of a value with the hash number of
+     * its key calculated beforehand.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function to check each element.
-     * \retval true All elements satisfied the condition.
-     * \retval false Some elements didn't satisfy the condition.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key of the value.
+     * \param[in] hash_number Hash number of the key.
+     */
+    template <typename KeyLike>
+    void prepare_for_insertion_with_hash(
+        const KeyLike& key, size_type hash_number) {
+        prepare_nodes_for_insertion();
+        if (migrating_table_) {
+            migrate_node_if_found(
+                migrating_table_->find_node_ind_for(key, hash_number));
+        }
+    }
+
+    /*!
+     * \brief Prepare nodes for insertion of a value.
+     *
+     * This function increases the number of nodes if required, and removes
+     * tombstones when values and tombstones use too many nodes.
      */
-    template <typename Function>
-    auto check_all_satisfy(Function&& function) const -> bool {
-        for (auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                if (!std::invoke(function,
-                        static_cast<const value_type&>(node.value()))) {
-                    return false;
-                }
+    void prepare_nodes_for_insertion() {
+        if (migrating_table_) {
+            migrate_nodes(migration_step_);
+        }
+        const size_type num_values = size() + 1U;
+        if (static_cast<float>(num_values) >
+            static_cast<float>(nodes_.size()) * max_load_factor_) {
+            const size_type min_num_node =
+                std::max(growth_type::grow(nodes_.size()),
+                    static_cast<size_type>(std::ceil(
+                        static_cast<float>(num_values) / max_load_factor_)));
+            if (incremental_rehash_step_ == 0U) {
+                rehash_to(min_num_node);
+            } else {
+                start_migration(min_num_node);
             }
         }
-        return true;
+        if (static_cast<float>(num_values + num_erased_) >
+            static_cast<float>(nodes_.size()) * max_load_factor_) {
+            compact();
+        }
     }
 
     /*!
-     * \brief Check whether at least one element satisfies a condition.
+     * \brief Insert a value from the arguments of its constructor with the
+     * hash number of its key without changing the number of nodes.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function to check each element.
-     * \retval true At least one element satisfied the condition.
-     * \retval false No element satisfied the condition.
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key.
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
      */
-    template <typename Function>
-    auto check_any_satisfy(Function&& function) const -> bool {
-        for (auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                if (std::invoke(function,
-                        static_cast<const value_type&>(node.value()))) {
-                    return true;
+    template <typename... Args>
+    auto emplace_without_rehash_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        const auto [node_ind, dist, found] =
+            prepare_place_for(key, hash_number);
+        if (found) {
+            return false;
+        }
+        emplace_at(node_ind, dist, hash_number, std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Find the place to insert or assign a value.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key of the value.
+     * \param[in] hash_number Hash number of the key.
+     * \return Node index, distance from the place determined by hash number,
+     * and whether the key was found.
+     */
+    template <typename KeyLike>
+    auto prepare_place_for(const KeyLike& key, size_type hash_number)
+        -> std::tuple<size_type, size_type, bool> {
+        size_type node_ind = slot_mapping_.node_ind_of(hash_number);
+        size_type dist = 0;
+        if constexpr (use_robin_hood) {
+            while (true) {
+                const auto& node = nodes_[node_ind];
+                if (node.state() != node_type::node_state::filled ||
+                    node.dist() < dist) {
+                    return {node_ind, dist, false};
+                }
+                if (node_has_key(node_ind, key, hash_number)) {
+                    return {node_ind, dist, true};
+                }
+                ++dist;
+                node_ind = slot_mapping_.add(node_ind, 1U);
+            }
+        } else {
+            const size_type desired_node_ind = node_ind;
+            const size_type max_dist =
+                max_dist_from(nodes_[node_ind], nodes_.size());
+            std::optional<std::tuple<size_type, size_type, bool>> empty_place;
+            while (true) {
+                const auto& node = nodes_[node_ind];
+                if (node.state() == node_type::node_state::filled) {
+                    if (node_has_key(node_ind, key, hash_number)) {
+                        return {node_ind, dist, true};
+                    }
+                } else {
+                    if (!empty_place) {
+                        empty_place.emplace(node_ind, dist, false);
+                    }
+                }
+                if (node.state() == node_type::node_state::init) {
+                    return *empty_place;
+                }
+                ++dist;
+                if (dist > max_dist && empty_place) {
+                    return *empty_place;
                 }
+                node_ind = slot_mapping_.add(desired_node_ind,
+                    probing_type::offset(dist, nodes_.size()));
             }
         }
-        return false;
     }
 
     /*!
-     * \brief Check whether no element satisfies a condition.
+     * \brief Construct a value at the place found by prepare_place_for
+     * function.
      *
-     * \tparam Function Type of the function.
-     * \param[in] function Function to check each element.
-     * \retval true No element satisfied the condition.
-     * \retval false At least one element satisfied the condition.
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] node_ind Node index.
+     * \param[in] dist Distance from the place determined by hash number.
+     * \param[in] hash_number Hash number of the key.
+     * \param[in] args Arguments of the constructor.
      */
-    template <typename Function>
-    auto check_none_satisfy(Function&& function) const -> bool {
-        for (auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                if (std::invoke(function,
-                        static_cast<const value_type&>(node.value()))) {
-                    return false;
+    template <typename... Args>
+    void emplace_at(size_type node_ind, size_type dist, size_type hash_number,
+        Args&&... args) {
+        if constexpr (use_robin_hood) {
+            shift_for_place_at(node_ind);
+            try {
+                nodes_.emplace(node_ind, std::forward<Args>(args)...);
+            } catch (...) {
+                shift_back_after(node_ind);
+                throw;
+            }
+        } else {
+            const bool was_erased =
+                nodes_[node_ind].state() == node_type::node_state::erased;
+            nodes_.emplace(node_ind, std::forward<Args>(args)...);
+            if (was_erased) {
+                --num_erased_;
+            }
+        }
+        finish_placement_at(node_ind, dist, hash_number);
+    }
+
+    /*!
+     * \brief Find the place to insert a value with a key which is known not to
+     * exist in this table.
+     *
+     * Unlike prepare_place_for function, this function doesn't compare keys.
+     *
+     * \param[in] hash_number Hash number of the key.
+     * \return Node index and distance from the place determined by hash
+     * number.
+     */
+    [[nodiscard]] auto prepare_place_for_new_key(size_type hash_number) const
+        -> std::tuple<size_type, size_type> {
+        const size_type desired_node_ind =
+            slot_mapping_.node_ind_of(hash_number);
+        size_type node_ind = desired_node_ind;
+        size_type dist = 0;
+        while (true) {
+            const auto& node = nodes_[node_ind];
+            if (node.state() != node_type::node_state::filled) {
+                return {node_ind, dist};
+            }
+            if constexpr (use_robin_hood) {
+                if (node.dist() < dist) {
+                    return {node_ind, dist};
                 }
             }
+            ++dist;
+            node_ind = slot_mapping_.add(
+                desired_node_ind, probing_type::offset(dist, nodes_.size()));
         }
-        return true;
     }
 
-    ///@}
-
     /*!
-     * \name Handle size.
-     */
-    ///@{
+     * \brief Relocate a value in a node of another table to the place found by
+     * prepare_place_for_new_key function.
+     *
+     * \param[in] node_ind Node index.
+     * \param[in] dist Distance from the place determined by hash number.
+     * \param[in] hash_number Hash number of the key.
+     * \param[in,out] from Nodes to relocate the value from.
+     * \param[in] from_node_ind Index of the node to relocate the value from.
+     *
+     * \note This function is valid only for trivially relocatable types.
+     */
+    void relocate_at(size_type node_ind, size_type dist,
+        size_type hash_number, nodes_type& from,
+        size_type from_node_ind) noexcept {
+        if constexpr (use_robin_hood) {
+            shift_for_place_at(node_ind);
+        } else {
+            if (nodes_[node_ind].state() == node_type::node_state::erased) {
+                --num_erased_;
+            }
+        }
+        nodes_.relocate_from(node_ind, from, from_node_ind);
+        finish_placement_at(node_ind, dist, hash_number);
+    }
 
     /*!
-     * \brief Get the number of values.
+     * \brief Shift values in Robin Hood hashing until an empty node to make
+     * place for a value.
      *
-     * \return Number of values.
+     * \param[in] node_ind Node index of the place.
      */
-    [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+    void shift_for_place_at(size_type node_ind) noexcept {
+        size_type empty_node_ind = node_ind;
+        while (
+            nodes_[empty_node_ind].state() == node_type::node_state::filled) {
+            empty_node_ind = slot_mapping_.add(empty_node_ind, 1U);
+        }
+        while (empty_node_ind != node_ind) {
+            const size_type prev_node_ind =
+                slot_mapping_.subtract(empty_node_ind, 1U);
+            move_node(prev_node_ind, empty_node_ind,
+                nodes_[prev_node_ind].dist() + 1U);
+            empty_node_ind = prev_node_ind;
+        }
+    }
 
     /*!
-     * \brief Check whether this object is empty.
+     * \brief Update distances, hash numbers and the number of values after a
+     * value is placed in a node.
      *
-     * \retval true This object is empty.
-     * \retval false This object is not empty.
-     */
-    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+     * \param[in] node_ind Node index.
+     * \param[in] dist Distance from the place determined by hash number.
+     * \param[in] hash_number Hash number of the key.
+     */
+    void finish_placement_at(
+        size_type node_ind, size_type dist, size_type hash_number) noexcept {
+        if constexpr (use_robin_hood) {
+            nodes_[node_ind].dist(static_cast<std::uint32_t>(dist));
+        } else {
+            update_max_dist_if_needed(
+                slot_mapping_.node_ind_of(hash_number), dist);
+        }
+        if constexpr (store_hash) {
+            nodes_[node_ind].hash_number(hash_number);
+        }
+        ++size_;
+    }
 
     /*!
-     * \brief Get the maximum number of values.
+     * \brief Get the maximum distance of values from a node determined by
+     * their hash numbers.
      *
-     * \return Maximum number of values.
-     */
-    [[nodiscard]] auto max_size() const noexcept -> size_type {
-        return nodes_.max_size();
+     * \param[in] node Node.
+     * \param[in] num_nodes Number of nodes.
+     * \return Maximum distance.
+     */
+    [[nodiscard]] static auto max_dist_from(
+        const node_type& node, size_type num_nodes) noexcept -> size_type {
+        const size_type dist = node.dist();
+        if (dist == node_type::max_dist) {
+            // The exact distance is unknown, but probing visits all nodes
+            // within this distance, so values are placed before it.
+            return 2U * num_nodes;
+        }
+        return dist;
     }
 
     /*!
-     * \brief Reserve enough place for values.
+     * \brief Update maximum distance from the place determined by hash number
+     * if needed.
      *
-     * \param[in] size Number of values.
+     * \param[in] desired_node_ind Node index determined by hash number.
+     * \param[in] dist Distance of the inserted value from the place determined
+     * by hash number.
      */
-    void reserve(size_type size) {
-        rehash(static_cast<size_type>(
-            std::ceil(static_cast<float>(size) / max_load_factor_)));
+    void update_max_dist_if_needed(
+        size_type desired_node_ind, size_type dist) noexcept {
+        auto& desired_node = nodes_[desired_node_ind];
+        if (dist > desired_node.dist()) {
+            desired_node.dist(static_cast<std::uint32_t>(dist));
+        }
     }
 
     ///@}
 
     /*!
-     * \name Access to internal information.
+     * \name Internal functions to read values.
      */
     ///@{
 
     /*!
-     * \brief Get the function to extract keys from values.
+     * \brief Check whether a node has a value with a key.
      *
-     * \return Function to extract keys from values.
-     */
-    [[nodiscard]] auto extract_key() const noexcept -> const extract_key_type& {
-        return extract_key_;
+     * When hash numbers are stored, they are compared before keys.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] node_ind Index of a node with a value.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \retval true The node has a value with the key.
+     * \retval false The node has a value with another key.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto node_has_key(size_type node_ind, const KeyLike& key,
+        [[maybe_unused]] size_type hash_number) const -> bool {
+        if constexpr (store_hash) {
+            if (nodes_[node_ind].hash_number() != hash_number) {
+                return false;
+            }
+        }
+        return key_equal_(extract_key_(nodes_.value(node_ind)), key);
     }
 
     /*!
-     * \brief Get the hash function.
+     * \brief Get the hash number of the key of the value in a node.
      *
-     * \return Hash function.
+     * \param[in] node_ind Index of a node with a value.
+     * \return Hash number.
      */
-    [[nodiscard]] auto hash() const noexcept -> const hash_type& {
-        return hash_;
+    [[nodiscard]] auto hash_number_of(size_type node_ind) const
+        -> size_type {
+        if constexpr (store_hash) {
+            return nodes_[node_ind].hash_number();
+        } else {
+            return hash_(extract_key_(nodes_.value(node_ind)));
+        }
     }
 
     /*!
-     * \brief Get the function to check whether keys are equal.
+     * \brief Find a node index.
      *
-     * \return Function to check whether keys are equal.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Node index. (Null if not found.)
      */
-    [[nodiscard]] auto key_equal() const noexcept -> const key_equal_type& {
-        return key_equal_;
+    template <typename KeyLike>
+    [[nodiscard]] auto find_node_ind_for(const KeyLike& key) const
+        -> std::optional<size_type> {
+        return find_node_ind_for(key, hash_(key));
     }
 
     /*!
-     * \brief Get the allocator.
+     * \brief Find a node index with the hash number of the key.
      *
-     * \return Allocator.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Node index. (Null if not found.)
      */
-    [[nodiscard]] auto allocator() const -> allocator_type {
-        return allocator_type(nodes_.get_allocator());
+    template <typename KeyLike>
+    [[nodiscard]] auto find_node_ind_for(
+        const KeyLike& key, size_type hash_number) const
+        -> std::optional<size_type> {
+        size_type node_ind = slot_mapping_.node_ind_of(hash_number);
+        if constexpr (use_robin_hood) {
+            for (size_type dist = 0;; ++dist) {
+                const auto& node = nodes_[node_ind];
+                if (node.state() != node_type::node_state::filled ||
+                    node.dist() < dist) {
+                    return std::nullopt;
+                }
+                if (node_has_key(node_ind, key, hash_number)) {
+                    return node_ind;
+                }
+                node_ind = slot_mapping_.add(node_ind, 1U);
+            }
+        } else {
+            const size_type desired_node_ind = node_ind;
+            const size_type max_dist =
+                max_dist_from(nodes_[node_ind], nodes_.size());
+            for (size_type dist = 0; dist <= max_dist;) {
+                const auto& node = nodes_[node_ind];
+                if (node.state() == node_type::node_state::filled &&
+                    node_has_key(node_ind, key, hash_number)) {
+                    return node_ind;
+                }
+                if (node.state() == node_type::node_state::init) {
+                    return std::nullopt;
+                }
+                ++dist;
+                node_ind = slot_mapping_.add(desired_node_ind,
+                    probing_type::offset(dist, nodes_.size()));
+            }
+            return std::nullopt;
+        }
     }
 
     /*!
-     * \brief Get the number of nodes.
+     * \brief Find a value in the current nodes or old nodes.
      *
-     * \return Number of nodes.
-     */
-    [[nodiscard]] auto num_nodes() const noexcept -> size_type {
-        return nodes_.size();
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Pointer to the value. (Null if not found.)
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_value_for(const KeyLike& key,
+        size_type hash_number) -> value_type* {
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (node_ind) {
+            return &nodes_.value(*node_ind);
+        }
+        if (migrating_table_) {
+            return migrating_table_->find_value_for(key, hash_number);
+        }
+        return nullptr;
     }
 
     /*!
-     * \brief Change the number of nodes.
+     * \brief Find a value in the current nodes or old nodes.
      *
-     * \param[in] min_num_node Minimum number of nodes.
-     */
-    void rehash(size_type min_num_node) {
-        if (min_num_node < nodes_.size()) {
-            return;
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Pointer to the value. (Null if not found.)
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_value_for(const KeyLike& key,
+        size_type hash_number) const -> const value_type* {
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (node_ind) {
+            return &nodes_.value(*node_ind);
         }
-
-        open_address_table_st new_table{
-            min_num_node, extract_key_, hash_, key_equal_, allocator()};
-        for (const auto& node : nodes_) {
-            if (node.state() == node_type::node_state::filled) {
-                new_table.insert_without_rehash(
-                    utility::move_if_nothrow_move_constructible(node.value()));
-            }
+        if (migrating_table_) {
+            return std::as_const(*migrating_table_)
+                .find_value_for(key, hash_number);
         }
-        std::swap(nodes_, new_table.nodes_);
-        std::swap(desired_node_ind_mask_, new_table.desired_node_ind_mask_);
+        return nullptr;
     }
 
     /*!
-     * \brief Get the load factor (number of values / number of nodes).
+     * \brief Find a value in the current nodes or old nodes.
      *
-     * \return Load factor.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value. (Null if not found.)
      */
-    auto load_factor() -> float {
-        return static_cast<float>(size_) / static_cast<float>(nodes_.size());
+    template <typename KeyLike>
+    [[nodiscard]] auto find_value_for(const KeyLike& key) -> value_type* {
+        return find_value_for(key, hash_(key));
     }
 
     /*!
-     * \brief Get the maximum load factor (number of values / number of nodes).
+     * \brief Find a value in the current nodes or old nodes.
      *
-     * \return Maximum load factor.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value. (Null if not found.)
      */
-    auto max_load_factor() -> float { return max_load_factor_; }
+    template <typename KeyLike>
+    [[nodiscard]] auto find_value_for(const KeyLike& key) const
+        -> const value_type* {
+        return find_value_for(key, hash_(key));
+    }
 
     /*!
-     * \brief Set the maximum load factor (number of values / number of nodes).
+     * \brief Calculate hash numbers of multiple keys prefetching nodes.
      *
-     * \param[in] value Maximum load factor.
+     * \tparam Keys Type of the sequence of keys.
+     * \tparam Function Type of the function called with the index of each key
+     * and the hash number of the key.
+     * \param[in] keys Keys.
+     * \param[in] function Function.
      */
-    void max_load_factor(float value) {
-        if (value <= 0.0F || 1.0F <= value) {
-            throw std::invalid_argument("Invalid maximum load factor.");
+    template <typename Keys, typename Function>
+    void hash_in_batch(const Keys& keys, Function&& function) const {
+        const size_type num_keys = std::size(keys);
+        std::array<size_type, batch_chunk_size> hash_numbers{};
+        for (size_type first = 0; first < num_keys;
+             first += batch_chunk_size) {
+            const size_type chunk_size =
+                std::min<size_type>(batch_chunk_size, num_keys - first);
+            for (size_type i = 0; i < chunk_size; ++i) {
+                hash_numbers[i] = hash_(keys[first + i]);
+                utility::prefetch(
+                    &nodes_[slot_mapping_.node_ind_of(hash_numbers[i])]);
+            }
+            for (size_type i = 0; i < chunk_size; ++i) {
+                function(first + i, hash_numbers[i]);
+            }
         }
-        max_load_factor_ = value;
     }
 
-    ///@}
-
-private:
-    //! Type of nodes.
-    using node_type = internal::open_address_table_st_node<value_type>;
-
-    //! Type of allocators for nodes.
-    using node_allocator_type = typename std::allocator_traits<
-        allocator_type>::template rebind_alloc<node_type>;
-
     /*!
-     * \brief Determine the number of nodes from the minimum number of nodes.
+     * \brief Find a value.
      *
-     * \param[in] min_num_node Minimum number of nodes.
-     * \return Number of nodes to use.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Value.
+     * \throw std::out_of_range If not found.
      */
-    [[nodiscard]] static auto determine_num_node_from_min_num_node(
-        size_type min_num_node) -> size_type {
-        size_type required_num_nodes =
-            utility::round_up_to_power_of_two(min_num_node);
-        if (required_num_nodes < default_num_nodes) {
-            required_num_nodes = default_num_nodes;
+    template <typename KeyLike>
+    [[nodiscard]] auto require_value_for(const KeyLike& key) -> value_type& {
+        auto* value = find_value_for(key);
+        if (value == nullptr) {
+            throw key_not_found();
         }
-        return required_num_nodes;
+        return *value;
     }
 
     /*!
-     * \brief Calculate the node index determined by hash number.
+     * \brief Find a value.
      *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
-     * \return Node index.
+     * \return Value.
+     * \throw std::out_of_range If not found.
      */
-    [[nodiscard]] auto desired_node_ind(const key_type& key) const
-        -> size_type {
-        const size_type hash_number = hash_(key);
-        return hash_number & desired_node_ind_mask_;
+    template <typename KeyLike>
+    [[nodiscard]] auto require_value_for(const KeyLike& key) const
+        -> const value_type& {
+        const auto* value = find_value_for(key);
+        if (value == nullptr) {
+            throw key_not_found();
+        }
+        return *value;
     }
 
     /*!
-     * \name Internal functions to create or update values.
-     */
-    ///@{
+     * \brief Get an iterator at a cursor of scan.
+     *
+     * Cursors are indices of the current nodes followed by indices of the old
+     * nodes in incremental rehashing.
+     *
+     * \tparam IsConst Whether values are accessed as constant values.
+     * \tparam Table Type of the table.
+     * \param[in] table Table.
+     * \param[in] cursor Cursor.
+     * \return Iterator.
+     */
+    template <bool IsConst, typename Table>
+    [[nodiscard]] static auto iterator_at_cursor(
+        Table* table, size_type cursor) noexcept -> basic_iterator<IsConst> {
+        if (cursor < table->nodes_.size()) {
+            return basic_iterator<IsConst>(table, cursor);
+        }
+        cursor -= table->nodes_.size();
+        if (table->migrating_table_ &&
+            cursor < table->migrating_table_->nodes_.size()) {
+            return basic_iterator<IsConst>(
+                table->migrating_table_.get(), cursor);
+        }
+        return basic_iterator<IsConst>();
+    }
 
     /*!
-     * \brief Insert a value without changing the number of nodes.
+     * \brief Get the cursor of scan at an iterator.
      *
-     * \param[in] value Value.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
-     */
-    auto insert_without_rehash(const value_type& value) -> bool {
-        return emplace_without_rehash(extract_key_(value), value);
+     * \tparam IsConst Whether values are accessed as constant values.
+     * \param[in] iter Iterator.
+     * \return Cursor. (0 at the end.)
+     */
+    template <bool IsConst>
+    [[nodiscard]] auto cursor_of(
+        const basic_iterator<IsConst>& iter) const noexcept -> size_type {
+        if (iter.table_ == nullptr) {
+            return 0;
+        }
+        if (iter.table_ == this) {
+            return iter.node_ind_;
+        }
+        return nodes_.size() + iter.node_ind_;
     }
 
+    ///@}
+
     /*!
-     * \brief Insert a value without changing the number of nodes.
-     *
-     * \param[in] value Value.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
+     * \name Internal functions to delete values.
      */
-    auto insert_without_rehash(value_type&& value) -> bool {
-        return emplace_without_rehash(extract_key_(value), std::move(value));
-    }
+    ///@{
 
     /*!
-     * \brief Insert a value from the arguments of its constructor without
-     * changing the number of nodes.
+     * \brief Delete a value.
      *
-     * \tparam Args Type of arguments of the constructor.
-     * \param[in] key Key of the value. (Assumed to be equal to the key of the
-     * value constructed from arguments.)
-     * \param[in] args Arguments of the constructor.
-     * \retval true Value is inserted.
-     * \retval false Value is not inserted due to a duplicated key.
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
      */
-    template <typename... Args>
-    auto emplace_without_rehash(const key_type& key, Args&&... args) -> bool {
-        const auto [node_ptr, dist] = prepare_place_for(key);
-        if (node_ptr->state() == node_type::node_state::filled) {
-            return false;
+    template <typename KeyLike>
+    auto erase_for(const KeyLike& key, size_type hash_number) -> bool {
+        if (migrating_table_) {
+            migrate_nodes(migration_step_);
         }
-        node_ptr->emplace(std::forward<Args>(args)...);
-        update_max_dist_if_needed(dist);
-        ++size_;
+        const auto node_ind =
+            find_node_ind_for(key, hash_number);
+        if (node_ind) {
+            erase_at(*node_ind);
+        } else {
+            if (!migrating_table_) {
+                return false;
+            }
+            auto& old_table = *migrating_table_;
+            const auto old_node_ind =
+                old_table.find_node_ind_for(key, hash_number);
+            if (!old_node_ind) {
+                return false;
+            }
+            old_table.erase_at(*old_node_ind);
+            if (old_table.size_ == 0U) {
+                migrating_table_.reset();
+            }
+        }
+        shrink_if_needed();
         return true;
     }
 
     /*!
-     * \brief Find the place to insert or assign a value.
+     * \brief Delete a value and get the handle of the value.
      *
-     * \param[in] key Key of the value.
-     * \return Pointer to the node and distance from the place determined by
-     * hash number.
-     */
-    auto prepare_place_for(const key_type& key)
-        -> std::tuple<node_type*, size_type> {
-        const size_type start_node_ind = desired_node_ind(key);
-        auto iter = nodes_.begin() + start_node_ind;
-        size_type dist = 0;
-        std::optional<std::tuple<node_type*, size_type>> empty_place;
-        while (true) {
-            if (iter->state() == node_type::node_state::filled) {
-                if (key_equal_(extract_key_(iter->value()), key)) {
-                    return {&(*iter), dist};
-                }
-            } else {
-                if (!empty_place) {
-                    empty_place.emplace(&(*iter), dist);
-                }
-            }
-            if (iter->state() == node_type::node_state::init) {
-                return *empty_place;
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    template <typename KeyLike>
+    auto extract_for(const KeyLike& key, size_type hash_number)
+        -> node_handle_type {
+        if (migrating_table_) {
+            migrate_nodes(migration_step_);
+        }
+        node_handle_type node;
+        const auto node_ind = find_node_ind_for(key, hash_number);
+        if (node_ind) {
+            extract_at(*node_ind, hash_number, node);
+        } else {
+            if (!migrating_table_) {
+                return node;
             }
-            ++dist;
-            if (dist > max_dist_ && empty_place) {
-                return *empty_place;
+            auto& old_table = *migrating_table_;
+            const auto old_node_ind =
+                old_table.find_node_ind_for(key, hash_number);
+            if (!old_node_ind) {
+                return node;
             }
-            ++iter;
-            if (iter == nodes_.end()) {
-                iter = nodes_.begin();
+            old_table.extract_at(*old_node_ind, hash_number, node);
+            if (old_table.size_ == 0U) {
+                migrating_table_.reset();
             }
         }
+        shrink_if_needed();
+        return node;
     }
 
     /*!
-     * \brief Update maximum distance from the place determined by hash number
-     * if needed.
+     * \brief Move a value in a node to a handle and delete the value.
      *
-     * \param[in] dist Distance of the inserted value from the place determined
-     * by hash number.
+     * \param[in] node_ind Node index.
+     * \param[in] hash_number Hash number of the key of the value.
+     * \param[out] node Empty handle to move the value to.
+     */
+    void extract_at(
+        size_type node_ind, size_type hash_number, node_handle_type& node) {
+        node.emplace(hash_number,
+            utility::move_if_nothrow_move_constructible(
+                nodes_.value(node_ind)));
+        erase_at(node_ind);
+    }
+
+    /*!
+     * \brief Delete values in nodes which satisfy a condition.
+     *
+     * This function doesn't handle incremental rehashing and shrinking.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check the condition of each filled
+     * node called with the node index. (The value in the node may be moved by
+     * this function if it returns true.)
+     * \return Number of removed values.
      */
-    void update_max_dist_if_needed(size_type dist) {
-        if (dist > max_dist_) {
-            max_dist_ = dist;
+    template <typename Function>
+    auto erase_nodes_if(Function&& function) -> size_type {
+        size_type removed = 0;
+        if constexpr (use_robin_hood) {
+            // Start from an empty node so that values shifted back in deletion
+            // are visited only once.
+            size_type first_node_ind = 0;
+            while (nodes_[first_node_ind].state() ==
+                node_type::node_state::filled) {
+                ++first_node_ind;
+            }
+            for (size_type i = 0; i < nodes_.size();) {
+                const size_type node_ind = slot_mapping_.add(first_node_ind, i);
+                if (nodes_[node_ind].state() == node_type::node_state::filled &&
+                    std::invoke(function, node_ind)) {
+                    erase_at(node_ind);
+                    ++removed;
+                    // Another value may be shifted to this node.
+                    continue;
+                }
+                ++i;
+            }
+        } else {
+            for (size_type i = 0; i < nodes_.size(); ++i) {
+                if (nodes_[i].state() == node_type::node_state::filled &&
+                    std::invoke(function, i)) {
+                    erase_at(i);
+                    ++removed;
+                }
+            }
         }
+        return removed;
     }
 
-    ///@}
-
     /*!
-     * \name Internal functions to read values.
+     * \brief Decrease the number of nodes if the load factor is smaller than
+     * the minimum load factor.
      */
-    ///@{
+    void shrink_if_needed() {
+        if (nodes_.size() > default_num_nodes &&
+            static_cast<float>(size()) <
+                static_cast<float>(nodes_.size()) * min_load_factor_) {
+            shrink_to_fit();
+        }
+    }
 
     /*!
-     * \brief Find a node index.
+     * \brief Delete a value in a node.
      *
-     * \param[in] key Key.
-     * \return Node index. (Null if not found.)
-     */
-    [[nodiscard]] auto find_node_ind_for(const key_type& key) const
-        -> std::optional<size_type> {
-        const size_type start_node_ind = desired_node_ind(key);
-        auto iter = nodes_.begin() + start_node_ind;
-        size_type dist = 0;
-        while (true) {
-            if (iter->state() == node_type::node_state::filled &&
-                key_equal_(extract_key_(iter->value()), key)) {
-                return iter - nodes_.begin();
-            }
-            if (iter->state() == node_type::node_state::init) {
-                return std::nullopt;
-            }
-            ++dist;
-            if (dist > max_dist_) {
-                break;
-            }
-            ++iter;
-            if (iter == nodes_.end()) {
-                iter = nodes_.begin();
-            }
+     * \param[in] node_ind Node index.
+     */
+    void erase_at(size_type node_ind) noexcept {
+        if constexpr (use_robin_hood) {
+            nodes_.reset(node_ind);
+            shift_back_after(node_ind);
+        } else {
+            nodes_.clear(node_ind);
+            ++num_erased_;
         }
-        return std::nullopt;
+        --size_;
     }
 
     /*!
-     * \brief Find a node index.
+     * \brief Shift values after an empty node back to fill the node.
      *
-     * \param[in] key Key.
-     * \return Node index.
-     * \throw std::out_of_range If not found.
-     */
-    [[nodiscard]] auto require_node_ind_for(const key_type& key) const
-        -> size_type {
-        const auto node_ind = find_node_ind_for(key);
-        if (!node_ind) {
-            throw key_not_found();
+     * \param[in] node_ind Index of the empty node.
+     */
+    void shift_back_after(size_type node_ind) noexcept {
+        size_type next_node_ind = slot_mapping_.add(node_ind, 1U);
+        while (nodes_[next_node_ind].state() == node_type::node_state::filled &&
+            nodes_[next_node_ind].dist() > 0U) {
+            move_node(
+                next_node_ind, node_ind, nodes_[next_node_ind].dist() - 1U);
+            node_ind = next_node_ind;
+            next_node_ind = slot_mapping_.add(node_ind, 1U);
+        }
+    }
+
+    /*!
+     * \brief Move a value to an empty node.
+     *
+     * \param[in] from_node_ind Index of the node to move the value from.
+     * \param[in] to_node_ind Index of the node to move the value to.
+     * \param[in] dist Distance of the value in the new node.
+     */
+    void move_node(size_type from_node_ind, size_type to_node_ind,
+        std::uint32_t dist) noexcept {
+        if constexpr (store_hash) {
+            nodes_[to_node_ind].hash_number(
+                nodes_[from_node_ind].hash_number());
         }
-        return *node_ind;
+        if constexpr (use_relocation) {
+            nodes_.relocate_from(to_node_ind, nodes_, from_node_ind);
+        } else {
+            nodes_.emplace(to_node_ind, std::move(nodes_.value(from_node_ind)));
+            nodes_.reset(from_node_ind);
+        }
+        nodes_[to_node_ind].dist(dist);
     }
 
     ///@}
 
     //! Nodes.
-    std::vector<node_type, node_allocator_type> nodes_;
+    nodes_type nodes_;
 
     //! Number of values.
     size_type size_{0};
 
+    //! Number of marks of erased values (tombstones).
+    size_type num_erased_{0};
+
     //! Function to extract keys from values.
     extract_key_type extract_key_;
 
@@ -1023,14 +3567,30 @@ private:
     //! Default maximum load factor.
     static constexpr float default_max_load_factor = 0.8F;
 
+    //! Number of keys processed at once in batched search.
+    static constexpr size_type batch_chunk_size = 16;
+
     //! Maximum load factor.
     float max_load_factor_{default_max_load_factor};
 
-    //! Current maximum distance from the place determined by hash number.
-    size_type max_dist_{0};
+    //! Minimum load factor.
+    float min_load_factor_{0.0F};
+
+    //! Number of old nodes processed in each step of incremental rehashing.
+    size_type incremental_rehash_step_{0};
+
+    //! Table of old nodes in incremental rehashing. (Null if not rehashing.)
+    std::unique_ptr<open_address_table_st> migrating_table_{};
+
+    //! Index of the old node to process next in incremental rehashing.
+    size_type migrating_node_ind_{0};
+
+    //! Number of old nodes processed in each step of the current incremental
+    //! rehashing.
+    size_type migration_step_{0};
 
-    //! Bit mask to get node index determined by hash number.
-    size_type desired_node_ind_mask_{};
+    //! Mapping from hash numbers to node indices.
+    slot_mapping_type slot_mapping_;
 };
 
 }  // namespace hash_tables::tables
@@ -26,14 +26,15 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "hash_tables/exceptions.h"
 #include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables/utility/cache_line.h"
+#include "hash_tables/utility/is_transparent.h"
 #include "hash_tables/utility/round_up_to_power_of_two.h"
 
 namespace hash_tables::tables {
@@ -47,13 +48,16 @@ namespace hash_tables::tables {
  * \tparam Hash Type of the hash function.
  * \tparam KeyEqual Type of the function to check whether keys are equal.
  * \tparam Allocator Type of allocators.
+ * \tparam LockPolicy Type of the policy of locks of buckets. (Optimistic reads
+ * are not supported.)
  *
  * \thread_safety Safe even for the same object.
  */
 template <typename ValueType, typename KeyType, typename ExtractKey,
     typename Hash = hashes::default_hash<KeyType>,
     typename KeyEqual = std::equal_to<KeyType>,
-    typename Allocator = std::allocator<ValueType>>
+    typename Allocator = std::allocator<ValueType>,
+    typename LockPolicy = policies::mutex_lock_policy>
 class separate_shared_chain_table_mt {
 public:
     //! Type of values.
@@ -74,6 +78,13 @@ public:
     //! Type of allocators.
     using allocator_type = Allocator;
 
+    //! Type of the policy of locks.
+    using lock_policy_type = LockPolicy;
+
+    static_assert(!lock_policy_type::optimistic_read,
+        "Optimistic reads are not supported in "
+        "separate_shared_chain_table_mt.");
+
     //! Type of sizes.
     using size_type = std::size_t;
 
@@ -145,6 +156,21 @@ public:
         return emplace(extract_key_(value), value);
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(
+        const value_type& value, size_type hash_number) -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
     /*!
      * \brief Insert a value.
      *
@@ -156,6 +182,21 @@ public:
         return emplace(extract_key_(value), std::move(value));
     }
 
+    /*!
+     * \brief Insert a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
     /*!
      * \brief Insert a value from the arguments of its constructor.
      *
@@ -169,7 +210,34 @@ public:
     template <typename... Args>
     auto emplace(const key_type& key, Args&&... args) -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
+        if (std::none_of(bucket.nodes.begin(), bucket.nodes.end(),
+                value_has_key_equal_to(key))) {
+            bucket.nodes.emplace_back(std::forward<Args>(args)...);
+            ++size_;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the hash
+     * number of the key calculated beforehand.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        auto& bucket = bucket_for_hash(hash_number);
+        exclusive_lock_type lock(bucket.mutex);
         if (std::none_of(bucket.nodes.begin(), bucket.nodes.end(),
                 value_has_key_equal_to(key))) {
             bucket.nodes.emplace_back(std::forward<Args>(args)...);
@@ -193,7 +261,7 @@ public:
     template <typename... Args>
     auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -219,7 +287,7 @@ public:
     template <typename... Args>
     auto assign(const key_type& key, Args&&... args) -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -229,6 +297,65 @@ public:
         return false;
     }
 
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        auto& bucket = bucket_for(key);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter == bucket.nodes.end()) {
+            return false;
+        }
+        std::invoke(std::forward<Function>(function), *iter);
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists, or
+     * insert a value created by a factory function otherwise.
+     *
+     * The function is called while the lock for the key is held, so that
+     * read-modify-write of a value is done atomically.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function of the value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        auto& bucket = bucket_for(key);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            std::invoke(std::forward<Function>(function), *iter);
+            return false;
+        }
+        bucket.nodes.emplace_back(std::invoke(std::forward<Factory>(factory)));
+        ++size_;
+        return true;
+    }
+
     ///@}
 
     /*!
@@ -244,7 +371,29 @@ public:
      */
     [[nodiscard]] auto at(const key_type& key) const -> value_type {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            return *iter;
+        }
+        throw key_not_found();
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> value_type {
+        auto& bucket = bucket_for(key);
+        shared_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -263,7 +412,32 @@ public:
     template <typename ValueOutput>
     void get_to(ValueOutput& value, const key_type& key) const {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            value = *iter;
+            return;
+        }
+        throw key_not_found();
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[out] value Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput>
+    void get_to(ValueOutput& value, const KeyLike& key) const {
+        auto& bucket = bucket_for(key);
+        shared_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -285,7 +459,35 @@ public:
     [[nodiscard]] auto get_or_create(const key_type& key, Args&&... args)
         -> value_type {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            return *iter;
+        }
+        auto& value = bucket.nodes.emplace_back(std::forward<Args>(args)...);
+        ++size_;
+        return value;
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type {
+        auto& bucket = bucket_for(key);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -309,7 +511,38 @@ public:
     void get_or_create_to(
         ValueOutput& value, const key_type& key, Args&&... args) {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            value = *iter;
+            return;
+        }
+        const auto& value_temp =
+            bucket.nodes.emplace_back(std::forward<Args>(args)...);
+        ++size_;
+        value = value_temp;
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \tparam Args Type of arguments of the constructor.
+     * \param[out] value Value.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput, typename... Args>
+    void get_or_create_to(
+        ValueOutput& value, const KeyLike& key, Args&&... args) {
+        auto& bucket = bucket_for(key);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -334,7 +567,7 @@ public:
     [[nodiscard]] auto get_or_create_with_factory(
         const key_type& key, Function&& function) -> value_type {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -359,7 +592,7 @@ public:
     void get_or_create_with_factory_to(
         ValueOutput& value, const key_type& key, Function&& function) {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -381,7 +614,52 @@ public:
     [[nodiscard]] auto try_get(const key_type& key) const
         -> std::optional<value_type> {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            return *iter;
+        }
+        return std::nullopt;
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Value if found, otherwise null.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) const
+        -> std::optional<value_type> {
+        auto& bucket = bucket_for_hash(hash_number);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            return *iter;
+        }
+        return std::nullopt;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value if found, otherwise null.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const
+        -> std::optional<value_type> {
+        auto& bucket = bucket_for(key);
+        shared_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -402,7 +680,60 @@ public:
     template <typename ValueOutput>
     auto try_get_to(ValueOutput& value, const key_type& key) const -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            value = *iter;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[out] value Value.
+     * \retval true Value was found and assigned to value.
+     * \retval false Value was not found.
+     */
+    template <typename ValueOutput>
+    auto try_get_to_with_hash(ValueOutput& value,
+        const key_type& key, size_type hash_number) const -> bool {
+        auto& bucket = bucket_for_hash(hash_number);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            value = *iter;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam ValueOutput Type of the value for output.
+     * \param[in] key Key.
+     * \param[out] value Value.
+     * \retval true Value was found and assigned to value.
+     * \retval false Value was not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename ValueOutput>
+    auto try_get_to(ValueOutput& value, const KeyLike& key) const -> bool {
+        auto& bucket = bucket_for(key);
+        shared_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -421,7 +752,46 @@ public:
      */
     [[nodiscard]] auto has(const key_type& key) const -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        return iter != bucket.nodes.end();
+    }
+
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        auto& bucket = bucket_for_hash(hash_number);
+        shared_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        return iter != bucket.nodes.end();
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        auto& bucket = bucket_for(key);
+        shared_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         return iter != bucket.nodes.end();
@@ -437,7 +807,7 @@ public:
     void for_all(Function&& function) {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            exclusive_lock_type lock(bucket.mutex);
             for (auto& node : bucket.nodes) {
                 std::invoke(function, static_cast<value_type&>(node));
             }
@@ -454,7 +824,7 @@ public:
     void for_all(Function&& function) const {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            shared_lock_type lock(bucket.mutex);
             for (auto& node : bucket.nodes) {
                 std::invoke(function, static_cast<const value_type&>(node));
             }
@@ -474,7 +844,7 @@ public:
     void clear() {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            exclusive_lock_type lock(bucket.mutex);
             size_type erased_size = bucket.nodes.size();
             bucket.nodes.clear();
             size_ -= erased_size;
@@ -490,7 +860,55 @@ public:
      */
     auto erase(const key_type& key) -> bool {
         auto& bucket = bucket_for(key);
-        std::unique_lock<std::mutex> lock(bucket.mutex);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            bucket.nodes.erase(iter);
+            --size_;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        auto& bucket = bucket_for_hash(hash_number);
+        exclusive_lock_type lock(bucket.mutex);
+        const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
+            value_has_key_equal_to(key));
+        if (iter != bucket.nodes.end()) {
+            bucket.nodes.erase(iter);
+            --size_;
+            return true;
+        }
+        return false;
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        auto& bucket = bucket_for(key);
+        exclusive_lock_type lock(bucket.mutex);
         const auto iter = std::find_if(bucket.nodes.begin(), bucket.nodes.end(),
             value_has_key_equal_to(key));
         if (iter != bucket.nodes.end()) {
@@ -513,7 +931,7 @@ public:
         size_type erased_count = 0;
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            exclusive_lock_type lock(bucket.mutex);
             for (auto iter = bucket.nodes.begin();
                 iter != bucket.nodes.end();) {
                 if (std::invoke(
@@ -548,7 +966,7 @@ public:
     auto check_all_satisfy(Function&& function) const -> bool {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            shared_lock_type lock(bucket.mutex);
             for (const auto& node : bucket.nodes) {
                 if (!std::invoke(
                         function, static_cast<const value_type&>(node))) {
@@ -571,7 +989,7 @@ public:
     auto check_any_satisfy(Function&& function) const -> bool {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            shared_lock_type lock(bucket.mutex);
             for (const auto& node : bucket.nodes) {
                 if (std::invoke(
                         function, static_cast<const value_type&>(node))) {
@@ -594,7 +1012,7 @@ public:
     auto check_none_satisfy(Function&& function) const -> bool {
         for (auto& bucket_ptr : buckets_) {
             auto& bucket = *bucket_ptr;
-            std::unique_lock<std::mutex> lock(bucket.mutex);
+            shared_lock_type lock(bucket.mutex);
             for (const auto& node : bucket.nodes) {
                 if (std::invoke(
                         function, static_cast<const value_type&>(node))) {
@@ -706,7 +1124,7 @@ private:
         std::vector<value_type, allocator_type> nodes;
 
         //! Mutex.
-        std::mutex mutex{};
+        typename lock_policy_type::mutex_type mutex{};
 
         /*!
          * \brief Constructor.
@@ -717,6 +1135,12 @@ private:
             : nodes(allocator) {}
     };
 
+    //! Type of locks to read values.
+    using shared_lock_type = typename lock_policy_type::shared_lock_type;
+
+    //! Type of locks to modify values.
+    using exclusive_lock_type = typename lock_policy_type::exclusive_lock_type;
+
     //! Type of pointers of buckets.
     using bucket_ptr_type = std::unique_ptr<bucket_type>;
 
@@ -727,10 +1151,12 @@ private:
     /*!
      * \brief Calculate the bucket index using hash number.
      *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
      * \return Bucket index.
      */
-    [[nodiscard]] auto bucket_ind_of(const key_type& key) const -> size_type {
+    template <typename KeyLike>
+    [[nodiscard]] auto bucket_ind_of(const KeyLike& key) const -> size_type {
         const size_type hash_number = hash_(key);
         return hash_number & bucket_ind_mask_;
     }
@@ -738,21 +1164,36 @@ private:
     /*!
      * \brief Access to the bucket for a key.
      *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
      * \return Bucket.
      */
-    [[nodiscard]] auto bucket_for(const key_type& key) const -> bucket_type& {
+    template <typename KeyLike>
+    [[nodiscard]] auto bucket_for(const KeyLike& key) const -> bucket_type& {
         return *buckets_[bucket_ind_of(key)];
     }
 
+    /*!
+     * \brief Access to the bucket for a hash number.
+     *
+     * \param[in] hash_number Hash number of a key.
+     * \return Bucket.
+     */
+    [[nodiscard]] auto bucket_for_hash(size_type hash_number) const
+        -> bucket_type& {
+        return *buckets_[hash_number & bucket_ind_mask_];
+    }
+
     /*!
      * \brief Get a function to check whether a value has a key equal to the
      * given key.
      *
+     * \tparam KeyLike Type of the key.
      * \param[in] key Key.
      * \return Function.
      */
-    [[nodiscard]] auto value_has_key_equal_to(const key_type& key) const {
+    template <typename KeyLike>
+    [[nodiscard]] auto value_has_key_equal_to(const KeyLike& key) const {
         return [this, &key](const value_type& value) -> bool {
             return key_equal_(extract_key_(value), key);
         };
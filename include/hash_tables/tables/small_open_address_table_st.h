@@ -0,0 +1,2044 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of small_open_address_table_st class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>  // IWYU pragma: keep
+#include <utility>
+
+#include "hash_tables/exceptions.h"
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/node_handle.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables/tables/open_address_table_st.h"
+#include "hash_tables/utility/is_transparent.h"
+#include "hash_tables/utility/move_if_nothrow_move_constructible.h"
+#include "hash_tables/utility/value_storage.h"
+
+namespace hash_tables::tables {
+
+/*!
+ * \brief Class of hash tables storing a small number of values inline.
+ *
+ * Up to policies::small_table_policy::inline_capacity values are stored in
+ * this object without allocation of memory, and keys are searched by linear
+ * scans without calculating hash numbers. When more values are inserted,
+ * values are moved to open_address_table_st allocated in heap memory, which
+ * is used until clear or shrink_to_fit function is called with a small number
+ * of values.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy (policies::small_table_policy).
+ *
+ * \thread_safety Safe if only functions without modifications of data are
+ * called.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash = hashes::default_hash<KeyType>,
+    typename KeyEqual = std::equal_to<KeyType>,
+    typename Allocator = std::allocator<ValueType>,
+    typename Policy = policies::small_table_policy<>>
+class small_open_address_table_st {
+public:
+    //! Type of values.
+    using value_type = ValueType;
+
+    //! Type of keys.
+    using key_type = KeyType;
+
+    //! Type of the function to extract keys from values.
+    using extract_key_type = ExtractKey;
+
+    //! Type of the hash function.
+    using hash_type = Hash;
+
+    //! Type of the function to check whether keys are equal.
+    using key_equal_type = KeyEqual;
+
+    //! Type of allocators.
+    using allocator_type = Allocator;
+
+    //! Type of the policy.
+    using policy_type = Policy;
+
+    //! Type of sizes.
+    using size_type = std::size_t;
+
+    //! Type of the table used when values don't fit in the inline storage.
+    using large_table_type = open_address_table_st<value_type, key_type,
+        extract_key_type, hash_type, key_equal_type, allocator_type,
+        typename policy_type::base_policy_type>;
+
+    //! Maximum number of values stored inline.
+    static constexpr size_type inline_capacity = policy_type::inline_capacity;
+
+    static_assert(0U < inline_capacity && inline_capacity <= 64U,
+        "Inline capacity must be from 1 to 64.");
+
+    //! Number of nodes of new tables. (Values are stored inline.)
+    static constexpr size_type default_num_nodes = inline_capacity;
+
+    /*!
+     * \brief Class of forward iterators of values in tables.
+     *
+     * \tparam IsConst Whether values are accessed as constant values.
+     *
+     * \note Iterators are invalidated by any modification of the table.
+     */
+    template <bool IsConst>
+    class basic_iterator {
+    public:
+        //! Type of the category of iterators.
+        using iterator_category = std::forward_iterator_tag;
+
+        //! Type of values.
+        using value_type = typename small_open_address_table_st::value_type;
+
+        //! Type of differences of iterators.
+        using difference_type = std::ptrdiff_t;
+
+        //! Type of pointers to values.
+        using pointer =
+            std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        //! Type of references to values.
+        using reference =
+            std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        /*!
+         * \brief Constructor of the iterator at the end.
+         */
+        basic_iterator() noexcept = default;
+
+        /*!
+         * \brief Constructor to convert a non-constant iterator to a constant
+         * iterator.
+         *
+         * \tparam OtherIsConst Whether the other iterator is constant.
+         * \param[in] obj Iterator.
+         */
+        template <bool OtherIsConst,
+            typename = std::enable_if_t<IsConst && !OtherIsConst>>
+        basic_iterator(  // NOLINT(google-explicit-constructor)
+            const basic_iterator<OtherIsConst>& obj) noexcept
+            : table_(obj.table_),
+              slot_ind_(obj.slot_ind_),
+              large_iterator_(obj.large_iterator_) {}
+
+        /*!
+         * \brief Get the value.
+         *
+         * \return Value.
+         */
+        [[nodiscard]] auto operator*() const noexcept -> reference {
+            if (slot_ind_ < inline_capacity) {
+                return table_->inline_values_[slot_ind_].get();
+            }
+            return *large_iterator_;
+        }
+
+        /*!
+         * \brief Get the pointer to the value.
+         *
+         * \return Pointer to the value.
+         */
+        [[nodiscard]] auto operator->() const noexcept -> pointer {
+            return std::addressof(**this);
+        }
+
+        /*!
+         * \brief Move to the next value.
+         *
+         * \return This iterator.
+         */
+        auto operator++() noexcept -> basic_iterator& {
+            if (slot_ind_ < inline_capacity) {
+                slot_ind_ = table_->next_filled_slot(slot_ind_ + 1U);
+            } else {
+                ++large_iterator_;
+            }
+            return *this;
+        }
+
+        /*!
+         * \brief Move to the next value.
+         *
+         * \return Iterator before the move.
+         */
+        auto operator++(int) noexcept -> basic_iterator {
+            basic_iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        /*!
+         * \brief Compare with another iterator.
+         *
+         * \param[in] right Right-hand-side object.
+         * \return Whether the iterators point to the same value.
+         */
+        [[nodiscard]] auto operator==(
+            const basic_iterator& right) const noexcept -> bool {
+            return slot_ind_ == right.slot_ind_ &&
+                large_iterator_ == right.large_iterator_;
+        }
+
+        /*!
+         * \brief Compare with another iterator.
+         *
+         * \param[in] right Right-hand-side object.
+         * \return Whether the iterators point to different values.
+         */
+        [[nodiscard]] auto operator!=(
+            const basic_iterator& right) const noexcept -> bool {
+            return !(*this == right);
+        }
+
+    private:
+        friend class small_open_address_table_st;
+
+        template <bool>
+        friend class basic_iterator;
+
+        //! Type of pointers to tables.
+        using table_pointer = std::conditional_t<IsConst,
+            const small_open_address_table_st*, small_open_address_table_st*>;
+
+        //! Type of iterators of large tables.
+        using large_iterator =
+            typename large_table_type::template basic_iterator<IsConst>;
+
+        /*!
+         * \brief Constructor.
+         *
+         * \param[in] table Table.
+         * \param[in] slot_ind Index of the inline slot. (inline_capacity for
+         * values in the large table.)
+         * \param[in] iter Iterator in the large table.
+         */
+        basic_iterator(table_pointer table, size_type slot_ind,
+            large_iterator iter) noexcept
+            : table_(table), slot_ind_(slot_ind), large_iterator_(iter) {}
+
+        //! Table.
+        table_pointer table_{nullptr};
+
+        //! Index of the inline slot. (inline_capacity if not in a slot.)
+        size_type slot_ind_{inline_capacity};
+
+        //! Iterator in the large table.
+        large_iterator large_iterator_{};
+    };
+
+    //! Type of iterators.
+    using iterator = basic_iterator<false>;
+
+    //! Type of constant iterators.
+    using const_iterator = basic_iterator<true>;
+
+    //! Type of handles of values extracted from tables.
+    using node_handle_type = node_handle<value_type>;
+
+    /*!
+     * \brief Constructor.
+     */
+    small_open_address_table_st()
+        : small_open_address_table_st(default_num_nodes) {}
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] min_num_nodes Minimum number of nodes. (The large table is
+     * allocated if this is larger than inline_capacity.)
+     * \param[in] extract_key Function to extract keys from values.
+     * \param[in] hash Hash function.
+     * \param[in] key_equal Function to check whether keys are equal.
+     * \param[in] allocator Allocator.
+     */
+    explicit small_open_address_table_st(size_type min_num_nodes,
+        extract_key_type extract_key = extract_key_type(),
+        hash_type hash = hash_type(),
+        key_equal_type key_equal = key_equal_type(),
+        allocator_type allocator = allocator_type())
+        : extract_key_(std::move(extract_key)),
+          hash_(std::move(hash)),
+          key_equal_(std::move(key_equal)),
+          allocator_(std::move(allocator)) {
+        if (min_num_nodes > inline_capacity) {
+            make_large(min_num_nodes);
+        }
+    }
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \param[in] obj Object to copy from.
+     */
+    small_open_address_table_st(const small_open_address_table_st& obj)
+        : large_table_(obj.large_table_
+                  ? std::make_unique<large_table_type>(*obj.large_table_)
+                  : nullptr),
+          extract_key_(obj.extract_key_),
+          hash_(obj.hash_),
+          key_equal_(obj.key_equal_),
+          allocator_(obj.allocator_),
+          max_load_factor_(obj.max_load_factor_),
+          min_load_factor_(obj.min_load_factor_),
+          incremental_rehash_step_(obj.incremental_rehash_step_) {
+        for (size_type i = obj.next_filled_slot(0U); i < inline_capacity;
+             i = obj.next_filled_slot(i + 1U)) {
+            inline_values_[i].emplace(obj.inline_values_[i].get());
+            inline_mask_ |= slot_bit(i);
+            ++inline_size_;
+        }
+    }
+
+    /*!
+     * \brief Move constructor.
+     *
+     * \param[in,out] obj Object to move from.
+     */
+    small_open_address_table_st(small_open_address_table_st&& obj)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_constructible_v<value_type> &&  //
+            std::is_nothrow_move_constructible_v<extract_key_type> &&  //
+            std::is_nothrow_move_constructible_v<hash_type> &&         //
+            std::is_nothrow_move_constructible_v<key_equal_type> &&    //
+            std::is_nothrow_move_constructible_v<allocator_type>)
+#endif
+        : large_table_(std::move(obj.large_table_)),
+          extract_key_(std::move(obj.extract_key_)),
+          hash_(std::move(obj.hash_)),
+          key_equal_(std::move(obj.key_equal_)),
+          allocator_(std::move(obj.allocator_)),
+          max_load_factor_(obj.max_load_factor_),
+          min_load_factor_(obj.min_load_factor_),
+          incremental_rehash_step_(obj.incremental_rehash_step_) {
+        move_inline_values_from(obj);
+    }
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * \param[in] obj Object to copy from.
+     * \return This.
+     */
+    auto operator=(const small_open_address_table_st& obj)
+        -> small_open_address_table_st& {
+        if (this != &obj) {
+            *this = small_open_address_table_st(obj);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param[in,out] obj Object to move from.
+     * \return This.
+     */
+    auto operator=(small_open_address_table_st&& obj)
+#ifndef HASH_TABLES_DOCUMENTATION
+        noexcept(std::is_nothrow_move_constructible_v<value_type> &&  //
+            std::is_nothrow_move_assignable_v<extract_key_type> &&     //
+            std::is_nothrow_move_assignable_v<hash_type> &&            //
+            std::is_nothrow_move_assignable_v<key_equal_type> &&       //
+            std::is_nothrow_move_assignable_v<allocator_type>)
+#endif
+            -> small_open_address_table_st& {
+        if (this != &obj) {
+            clear_inline_values();
+            large_table_ = std::move(obj.large_table_);
+            extract_key_ = std::move(obj.extract_key_);
+            hash_ = std::move(obj.hash_);
+            key_equal_ = std::move(obj.key_equal_);
+            allocator_ = std::move(obj.allocator_);
+            max_load_factor_ = obj.max_load_factor_;
+            min_load_factor_ = obj.min_load_factor_;
+            incremental_rehash_step_ = obj.incremental_rehash_step_;
+            move_inline_values_from(obj);
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief Destructor.
+     */
+    ~small_open_address_table_st() noexcept { clear_inline_values(); }
+
+    /*!
+     * \name Create or update values.
+     */
+    ///@{
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(const value_type& value) -> bool {
+        return emplace(extract_key_(value), value);
+    }
+
+    /*!
+     * \brief Insert a value.
+     *
+     * \param[in] value Value.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert(value_type&& value) -> bool {
+        return emplace(extract_key_(value), std::move(value));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace(const key_type& key, Args&&... args) -> bool {
+        return try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(const value_type& value, size_type hash_number)
+        -> bool {
+        return emplace_with_hash(extract_key_(value), hash_number, value);
+    }
+
+    /*!
+     * \brief Insert a value with the hash number of its key calculated
+     * beforehand.
+     *
+     * \param[in] value Value.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key) for the key of the value.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    auto insert_with_hash(value_type&& value, size_type hash_number) -> bool {
+        return emplace_with_hash(
+            extract_key_(value), hash_number, std::move(value));
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor with the
+     * hash number of its key calculated beforehand.
+     *
+     * The hash number is used only in the large table.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key.
+     */
+    template <typename... Args>
+    auto emplace_with_hash(
+        const key_type& key, size_type hash_number, Args&&... args) -> bool {
+        if (large_table_) {
+            return large_table_->emplace_with_hash(
+                key, hash_number, std::forward<Args>(args)...);
+        }
+        return try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /*!
+     * \brief Insert a value extracted from a table.
+     *
+     * \param[in,out] node Handle of the value. (Empty after this function if
+     * the value is inserted.)
+     * \retval true Value is inserted.
+     * \retval false Value is not inserted due to a duplicated key or an empty
+     * handle.
+     */
+    auto insert(node_handle_type&& node) -> bool {
+        if (large_table_) {
+            return large_table_->insert(std::move(node));
+        }
+        if (node.empty()) {
+            return false;
+        }
+        if (!emplace_with_hash(extract_key_(node.value()), node.hash_number(),
+                std::move(node.value()))) {
+            return false;
+        }
+        node.clear();
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor only if the
+     * key doesn't exist.
+     *
+     * Arguments are used only when the key doesn't exist.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \return Reference to the inserted or existing value, and whether the
+     * value is inserted.
+     */
+    template <typename... Args>
+    auto try_emplace(const key_type& key, Args&&... args)
+        -> std::pair<value_type&, bool> {
+        if (!large_table_) {
+            const size_type slot_ind = find_slot_for(key);
+            if (slot_ind < inline_capacity) {
+                return {inline_values_[slot_ind].get(), false};
+            }
+            if (inline_size_ < inline_capacity) {
+                return {emplace_inline(std::forward<Args>(args)...), true};
+            }
+            make_large_for_insertion();
+        }
+        return large_table_->try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Insert a value from the arguments of its constructor if not exist,
+     * or assign to an existing value.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is inserted.
+     * \retval false Value is assigned to an existing value.
+     */
+    template <typename... Args>
+    auto emplace_or_assign(const key_type& key, Args&&... args) -> bool {
+        if (large_table_) {
+            return large_table_->emplace_or_assign(
+                key, std::forward<Args>(args)...);
+        }
+        const size_type slot_ind = find_slot_for(key);
+        if (slot_ind < inline_capacity) {
+            inline_values_[slot_ind].get() =
+                value_type(std::forward<Args>(args)...);
+            return false;
+        }
+        if (inline_size_ < inline_capacity) {
+            emplace_inline(std::forward<Args>(args)...);
+            return true;
+        }
+        make_large_for_insertion();
+        return large_table_->try_emplace(key, std::forward<Args>(args)...)
+            .second;
+    }
+
+    /*!
+     * \brief Assign a value to an existing key from the arguments of its
+     * constructor.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key of the value. (Assumed to be equal to the key of the
+     * value constructed from arguments.)
+     * \param[in] args Arguments of the constructor.
+     * \retval true Value is assigned.
+     * \retval false Value is not assigned due to non-existing key.
+     */
+    template <typename... Args>
+    auto assign(const key_type& key, Args&&... args) -> bool {
+        if (large_table_) {
+            return large_table_->assign(key, std::forward<Args>(args)...);
+        }
+        auto* value = try_get(key);
+        if (value == nullptr) {
+            return false;
+        }
+        *value = value_type(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /*!
+     * \brief Update a value in place using a function if the key exists.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] key Key.
+     * \param[in] function Function called with the reference to the value.
+     * (The key must not be changed.)
+     * \retval true Value is updated.
+     * \retval false Value is not updated due to non-existing key.
+     */
+    template <typename Function>
+    auto update(const key_type& key, Function&& function) -> bool {
+        auto* value = try_get(key);
+        if (value == nullptr) {
+            return false;
+        }
+        std::invoke(std::forward<Function>(function), *value);
+        return true;
+    }
+
+    /*!
+     * \brief Insert a value created by a factory function if the key doesn't
+     * exist, or update the existing value in place using a function.
+     *
+     * \tparam Factory Type of the factory function.
+     * \tparam Function Type of the function to update values.
+     * \param[in] key Key.
+     * \param[in] factory Factory function to create a value. (The key of the
+     * created value must be equal to the given key.)
+     * \param[in] function Function called with the reference to the existing
+     * value. (The key must not be changed.)
+     * \retval true Value is inserted.
+     * \retval false Existing value is updated.
+     */
+    template <typename Factory, typename Function>
+    auto upsert(const key_type& key, Factory&& factory, Function&& function)
+        -> bool {
+        if (!large_table_) {
+            const size_type slot_ind = find_slot_for(key);
+            if (slot_ind < inline_capacity) {
+                std::invoke(std::forward<Function>(function),
+                    inline_values_[slot_ind].get());
+                return false;
+            }
+            if (inline_size_ < inline_capacity) {
+                emplace_inline(std::invoke(std::forward<Factory>(factory)));
+                return true;
+            }
+            make_large_for_insertion();
+        }
+        return large_table_->upsert(key, std::forward<Factory>(factory),
+            std::forward<Function>(function));
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * Values with keys not in this table are moved to this table, and the
+     * other values remain in the other table.
+     *
+     * \param[in,out] other Table to move values from.
+     */
+    void merge(small_open_address_table_st& other) {
+        if (&other == this) {
+            return;
+        }
+        reserve(size() + other.size());
+        if (other.large_table_) {
+            if (!large_table_) {
+                make_large(inline_capacity + 1U);
+            }
+            large_table_->merge(*other.large_table_);
+            return;
+        }
+        for (size_type i = other.next_filled_slot(0U); i < inline_capacity;
+             i = other.next_filled_slot(i + 1U)) {
+            auto& value = other.inline_values_[i].get();
+            if (emplace(other.extract_key_(value),
+                    utility::move_if_nothrow_move_constructible(value))) {
+                other.erase_inline_at(i);
+            }
+        }
+    }
+
+    /*!
+     * \brief Move values from another table.
+     *
+     * \param[in,out] other Table to move values from.
+     * \sa merge(small_open_address_table_st&)
+     */
+    void merge(small_open_address_table_st&& other) { merge(other); }
+
+    ///@}
+
+    /*!
+     * \name Read values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     * \throw key_not_found If the key not found.
+     */
+    [[nodiscard]] auto at(const key_type& key) -> value_type& {
+        return require(try_get(key));
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     * \throw key_not_found If the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) -> value_type& {
+        return require(try_get(key));
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \param[in] key Key.
+     * \return Value.
+     * \throw key_not_found If the key not found.
+     */
+    [[nodiscard]] auto at(const key_type& key) const -> const value_type& {
+        return require(try_get(key));
+    }
+
+    /*!
+     * \brief Get a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Value.
+     * \throw key_not_found If the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto at(const KeyLike& key) const -> const value_type& {
+        return require(try_get(key));
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename... Args>
+    [[nodiscard]] auto get_or_create(const key_type& key, Args&&... args)
+        -> value_type& {
+        return try_emplace(key, std::forward<Args>(args)...).first;
+    }
+
+    /*!
+     * \brief Get a value constructing it if not found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] key Key.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr,
+        typename... Args>
+    [[nodiscard]] auto get_or_create(const KeyLike& key, Args&&... args)
+        -> value_type& {
+        if (!large_table_) {
+            const size_type slot_ind = find_slot_for(key);
+            if (slot_ind < inline_capacity) {
+                return inline_values_[slot_ind].get();
+            }
+            if (inline_size_ < inline_capacity) {
+                return emplace_inline(std::forward<Args>(args)...);
+            }
+            make_large_for_insertion();
+        }
+        return large_table_->get_or_create(key, std::forward<Args>(args)...);
+    }
+
+    /*!
+     * \brief Get a value constructing using a factory function it if not found.
+     *
+     * \tparam Function Type of the factory function.
+     * \param[in] key Key.
+     * \param[in] function Factory function.
+     * \return Value.
+     */
+    template <typename Function>
+    [[nodiscard]] auto get_or_create_with_factory(
+        const key_type& key, Function&& function) -> value_type& {
+        if (!large_table_) {
+            const size_type slot_ind = find_slot_for(key);
+            if (slot_ind < inline_capacity) {
+                return inline_values_[slot_ind].get();
+            }
+            if (inline_size_ < inline_capacity) {
+                return emplace_inline(
+                    std::invoke(std::forward<Function>(function)));
+            }
+            make_large_for_insertion();
+        }
+        return large_table_->get_or_create_with_factory(
+            key, std::forward<Function>(function));
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) -> value_type* {
+        return try_get_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) -> value_type* {
+        return try_get_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get(const key_type& key) const -> const value_type* {
+        return try_get_for(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto try_get(const KeyLike& key) const -> const value_type* {
+        return try_get_for(key);
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has(const key_type& key) const -> bool {
+        return try_get_for(key) != nullptr;
+    }
+
+    /*!
+     * \brief Check whether a key exists.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto has(const KeyLike& key) const -> bool {
+        return try_get_for(key) != nullptr;
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(
+        const key_type& key, size_type hash_number) -> value_type* {
+        if (large_table_) {
+            return large_table_->try_get_with_hash(key, hash_number);
+        }
+        return try_get_inline(key);
+    }
+
+    /*!
+     * \brief Get a value if found with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    [[nodiscard]] auto try_get_with_hash(const key_type& key,
+        size_type hash_number) const -> const value_type* {
+        if (large_table_) {
+            return std::as_const(*large_table_)
+                .try_get_with_hash(key, hash_number);
+        }
+        return try_get_inline(key);
+    }
+
+    /*!
+     * \brief Check whether a key exists with the hash number of the key
+     * calculated beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Key exists.
+     * \retval false Key doesn't exists.
+     */
+    [[nodiscard]] auto has_with_hash(
+        const key_type& key, size_type hash_number) const -> bool {
+        return try_get_with_hash(key, hash_number) != nullptr;
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) {
+        if (large_table_) {
+            large_table_->find_batch(keys, std::forward<Outputs>(outputs));
+            return;
+        }
+        const size_type num_keys = std::size(keys);
+        for (size_type i = 0; i < num_keys; ++i) {
+            outputs[i] = try_get_inline(keys[i]);
+        }
+    }
+
+    /*!
+     * \brief Get values of multiple keys if found.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from pointers of values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Pointers to the values if found, otherwise nullptr.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void find_batch(const Keys& keys, Outputs&& outputs) const {
+        if (large_table_) {
+            std::as_const(*large_table_)
+                .find_batch(keys, std::forward<Outputs>(outputs));
+            return;
+        }
+        const size_type num_keys = std::size(keys);
+        for (size_type i = 0; i < num_keys; ++i) {
+            outputs[i] = try_get_inline(keys[i]);
+        }
+    }
+
+    /*!
+     * \brief Check whether multiple keys exist.
+     *
+     * \tparam Keys Type of the sequence of keys. (std::size(keys) and
+     * keys[i] must be valid. keys[i] must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \tparam Outputs Type of the sequence of outputs. (outputs[i] must be
+     * assignable from bool values.)
+     * \param[in] keys Keys.
+     * \param[out] outputs Whether each key exists.
+     * (Written in the same order as keys.)
+     */
+    template <typename Keys, typename Outputs,
+        utility::enable_batch_lookup_t<hash_type, key_equal_type, key_type,
+            Keys> = nullptr>
+    void has_batch(const Keys& keys, Outputs&& outputs) const {
+        if (large_table_) {
+            large_table_->has_batch(keys, std::forward<Outputs>(outputs));
+            return;
+        }
+        const size_type num_keys = std::size(keys);
+        for (size_type i = 0; i < num_keys; ++i) {
+            outputs[i] = (try_get_inline(keys[i]) != nullptr);
+        }
+    }
+
+    /*!
+     * \brief Prefetch the node of a key.
+     *
+     * This does nothing for values stored inline.
+     *
+     * \tparam KeyLike Type of the key. (Must be key_type unless heterogeneous
+     * lookup is enabled.)
+     * \param[in] key Key.
+     */
+    template <typename KeyLike,
+        utility::enable_lookup_t<hash_type, key_equal_type, key_type,
+            KeyLike> = nullptr>
+    void prefetch(const KeyLike& key) const {
+        if (large_table_) {
+            large_table_->prefetch(key);
+        }
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) {
+        if (large_table_) {
+            large_table_->for_all(function);
+            return;
+        }
+        for (size_type i = next_filled_slot(0U); i < inline_capacity;
+             i = next_filled_slot(i + 1U)) {
+            std::invoke(function, inline_values_[i].get());
+        }
+    }
+
+    /*!
+     * \brief Call a function with all values.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function.
+     */
+    template <typename Function>
+    void for_all(Function&& function) const {
+        if (large_table_) {
+            std::as_const(*large_table_).for_all(function);
+            return;
+        }
+        for (size_type i = next_filled_slot(0U); i < inline_capacity;
+             i = next_filled_slot(i + 1U)) {
+            std::invoke(function,
+                static_cast<const value_type&>(inline_values_[i].get()));
+        }
+    }
+
+    ///@}
+
+    /*!
+     * \name Iterate over values.
+     */
+    ///@{
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        if (large_table_) {
+            return iterator(this, inline_capacity, large_table_->begin());
+        }
+        return iterator(this, next_filled_slot(0U), {});
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        if (large_table_) {
+            return const_iterator(
+                this, inline_capacity, std::as_const(*large_table_).begin());
+        }
+        return const_iterator(this, next_filled_slot(0U), {});
+    }
+
+    /*!
+     * \brief Get an iterator to the first value.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() noexcept -> iterator { return iterator(); }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator();
+    }
+
+    /*!
+     * \brief Get an iterator to the end.
+     *
+     * \return Iterator.
+     */
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * Start with cursor 0 and pass the returned cursor to the next call until
+     * 0 is returned, so that all values can be visited in small steps.
+     * Values are visited exactly once if the table is not modified between
+     * calls. Otherwise, some values may be skipped or visited more than once.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items, Function&& function)
+        -> size_type {
+        if (large_table_) {
+            return large_table_->scan(
+                cursor, max_items, std::forward<Function>(function));
+        }
+        assert(max_items > 0U);
+        size_type slot_ind = next_filled_slot(cursor);
+        for (size_type i = 0; i < max_items && slot_ind < inline_capacity;
+             ++i, slot_ind = next_filled_slot(slot_ind + 1U)) {
+            std::invoke(function, inline_values_[slot_ind].get());
+        }
+        return (slot_ind < inline_capacity) ? slot_ind : 0U;
+    }
+
+    /*!
+     * \brief Call a function with a limited number of values starting from a
+     * cursor.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] cursor Cursor.
+     * \param[in] max_items Maximum number of values to visit. (Positive.)
+     * \param[in] function Function.
+     * \return Cursor for the next call. (0 if all values were visited.)
+     * \sa scan(size_type, size_type, Function&&)
+     */
+    template <typename Function>
+    auto scan(size_type cursor, size_type max_items,
+        Function&& function) const -> size_type {
+        if (large_table_) {
+            return std::as_const(*large_table_)
+                .scan(cursor, max_items, std::forward<Function>(function));
+        }
+        assert(max_items > 0U);
+        size_type slot_ind = next_filled_slot(cursor);
+        for (size_type i = 0; i < max_items && slot_ind < inline_capacity;
+             ++i, slot_ind = next_filled_slot(slot_ind + 1U)) {
+            std::invoke(function,
+                static_cast<const value_type&>(inline_values_[slot_ind].get()));
+        }
+        return (slot_ind < inline_capacity) ? slot_ind : 0U;
+    }
+
+    ///@}
+
+    /*!
+     * \name Delete values.
+     */
+    ///@{
+
+    /*!
+     * \brief Delete all values.
+     *
+     * This releases the large table if allocated.
+     */
+    void clear() noexcept {
+        clear_inline_values();
+        large_table_.reset();
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase(const key_type& key) -> bool { return erase_for(key); }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    auto erase(const KeyLike& key) -> bool {
+        return erase_for(key);
+    }
+
+    /*!
+     * \brief Delete a value with the hash number of the key calculated
+     * beforehand.
+     *
+     * \param[in] key Key.
+     * \param[in] hash_number Hash number of the key calculated by hash_type.
+     * (Must be equal to hash()(key).)
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    auto erase_with_hash(const key_type& key, size_type hash_number) -> bool {
+        if (large_table_) {
+            return large_table_->erase_with_hash(key, hash_number);
+        }
+        return erase_for(key);
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    [[nodiscard]] auto extract(const key_type& key) -> node_handle_type {
+        return extract_for(key);
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \tparam KeyLike Type of the key. (This overload is enabled only when
+     * both hash_type and key_equal_type have is_transparent type.)
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    template <typename KeyLike,
+        utility::enable_transparent_lookup_t<hash_type, key_equal_type,
+            key_type, KeyLike> = nullptr>
+    [[nodiscard]] auto extract(const KeyLike& key) -> node_handle_type {
+        return extract_for(key);
+    }
+
+    /*!
+     * \brief Delete values which satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check the condition.
+     * \return Number of removed values.
+     */
+    template <typename Function>
+    auto erase_if(Function&& function) -> size_type {
+        if (large_table_) {
+            return large_table_->erase_if(std::forward<Function>(function));
+        }
+        size_type removed = 0;
+        for (size_type i = next_filled_slot(0U); i < inline_capacity;
+             i = next_filled_slot(i + 1U)) {
+            if (std::invoke(function,
+                    static_cast<const value_type&>(inline_values_[i].get()))) {
+                erase_inline_at(i);
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    ///@}
+
+    /*!
+     * \name Check conditions for elements.
+     */
+    ///@{
+
+    /*!
+     * \brief Check whether all elements satisfy a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true All elements satisfied the condition.
+     * \retval false Some elements didn't satisfy the condition.
+     */
+    template <typename Function>
+    auto check_all_satisfy(Function&& function) const -> bool {
+        return std::all_of(begin(), end(), std::forward<Function>(function));
+    }
+
+    /*!
+     * \brief Check whether at least one element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true At least one element satisfied the condition.
+     * \retval false No element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_any_satisfy(Function&& function) const -> bool {
+        return std::any_of(begin(), end(), std::forward<Function>(function));
+    }
+
+    /*!
+     * \brief Check whether no element satisfies a condition.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to check each element.
+     * \retval true No element satisfied the condition.
+     * \retval false At least one element satisfied the condition.
+     */
+    template <typename Function>
+    auto check_none_satisfy(Function&& function) const -> bool {
+        return std::none_of(begin(), end(), std::forward<Function>(function));
+    }
+
+    ///@}
+
+    /*!
+     * \name Handle size.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the number of values.
+     *
+     * \return Number of values.
+     */
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        if (large_table_) {
+            return large_table_->size();
+        }
+        return inline_size_;
+    }
+
+    /*!
+     * \brief Check whether this object is empty.
+     *
+     * \retval true This object is empty.
+     * \retval false This object is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+    /*!
+     * \brief Get the maximum number of values.
+     *
+     * \return Maximum number of values.
+     */
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return std::allocator_traits<allocator_type>::max_size(allocator_);
+    }
+
+    /*!
+     * \brief Reserve enough place for values.
+     *
+     * The large table is allocated if the number of values is larger than
+     * inline_capacity.
+     *
+     * \param[in] size Number of values.
+     */
+    void reserve(size_type size) {
+        if (large_table_) {
+            large_table_->reserve(size);
+            return;
+        }
+        if (size > inline_capacity) {
+            make_large(num_nodes_for(size));
+        }
+    }
+
+    /*!
+     * \brief Decrease the number of nodes to the minimum number for the
+     * current values.
+     *
+     * Values are moved back to the inline storage if possible. Values are
+     * copied instead if their move constructor may throw exceptions, so that
+     * the large table is kept unchanged when an exception is thrown.
+     */
+    void shrink_to_fit() {
+        if (!large_table_) {
+            return;
+        }
+        if (large_table_->size() > inline_capacity) {
+            large_table_->shrink_to_fit();
+            return;
+        }
+        try {
+            large_table_->for_all([this](value_type& value) {
+                emplace_inline(
+                    utility::move_if_nothrow_move_constructible(value));
+            });
+        } catch (...) {
+            clear_inline_values();
+            throw;
+        }
+        large_table_.reset();
+    }
+
+    ///@}
+
+    /*!
+     * \name Access to internal information.
+     */
+    ///@{
+
+    /*!
+     * \brief Get the function to extract keys from values.
+     *
+     * \return Function to extract keys from values.
+     */
+    [[nodiscard]] auto extract_key() const noexcept -> const extract_key_type& {
+        return extract_key_;
+    }
+
+    /*!
+     * \brief Get the hash function.
+     *
+     * \return Hash function.
+     */
+    [[nodiscard]] auto hash() const noexcept -> const hash_type& {
+        return hash_;
+    }
+
+    /*!
+     * \brief Get the function to check whether keys are equal.
+     *
+     * \return Function to check whether keys are equal.
+     */
+    [[nodiscard]] auto key_equal() const noexcept -> const key_equal_type& {
+        return key_equal_;
+    }
+
+    /*!
+     * \brief Get the allocator.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] auto allocator() const -> allocator_type {
+        return allocator_;
+    }
+
+    /*!
+     * \brief Check whether values are stored inline.
+     *
+     * \retval true Values are stored inline.
+     * \retval false Values are stored in the large table.
+     */
+    [[nodiscard]] auto is_inline() const noexcept -> bool {
+        return !large_table_;
+    }
+
+    /*!
+     * \brief Get the number of nodes.
+     *
+     * \return Number of nodes. (inline_capacity if values are stored inline.)
+     */
+    [[nodiscard]] auto num_nodes() const noexcept -> size_type {
+        if (large_table_) {
+            return large_table_->num_nodes();
+        }
+        return inline_capacity;
+    }
+
+    /*!
+     * \brief Change the number of nodes.
+     *
+     * \param[in] min_num_node Minimum number of nodes.
+     */
+    void rehash(size_type min_num_node) {
+        if (large_table_) {
+            large_table_->rehash(min_num_node);
+            return;
+        }
+        if (min_num_node > inline_capacity) {
+            make_large(min_num_node);
+        }
+    }
+
+    /*!
+     * \brief Remove marks of erased values (tombstones) in the large table.
+     */
+    void compact() {
+        if (large_table_) {
+            large_table_->compact();
+        }
+    }
+
+    /*!
+     * \brief Get the number of marks of erased values (tombstones).
+     *
+     * \return Number of tombstones.
+     */
+    [[nodiscard]] auto num_erased() const noexcept -> size_type {
+        if (large_table_) {
+            return large_table_->num_erased();
+        }
+        return 0U;
+    }
+
+    /*!
+     * \brief Get the load factor (number of values / number of nodes).
+     *
+     * \return Load factor.
+     */
+    auto load_factor() -> float {
+        return static_cast<float>(size()) / static_cast<float>(num_nodes());
+    }
+
+    /*!
+     * \brief Get the maximum load factor of the large table.
+     *
+     * \return Maximum load factor.
+     */
+    auto max_load_factor() -> float { return max_load_factor_; }
+
+    /*!
+     * \brief Set the maximum load factor of the large table.
+     *
+     * \param[in] value Maximum load factor. (Must be larger than twice the
+     * minimum load factor.)
+     */
+    void max_load_factor(float value) {
+        if (value <= 0.0F || 1.0F <= value ||
+            value * 0.5F <= min_load_factor_) {
+            throw std::invalid_argument("Invalid maximum load factor.");
+        }
+        if (large_table_) {
+            large_table_->max_load_factor(value);
+        }
+        max_load_factor_ = value;
+    }
+
+    /*!
+     * \brief Get the minimum load factor of the large table.
+     *
+     * \return Minimum load factor.
+     */
+    auto min_load_factor() -> float { return min_load_factor_; }
+
+    /*!
+     * \brief Set the minimum load factor of the large table.
+     *
+     * \param[in] value Minimum load factor. (Must be smaller than the half of
+     * the maximum load factor.)
+     * \sa open_address_table_st::min_load_factor(float)
+     */
+    void min_load_factor(float value) {
+        if (value < 0.0F || max_load_factor_ * 0.5F <= value) {
+            throw std::invalid_argument("Invalid minimum load factor.");
+        }
+        if (large_table_) {
+            large_table_->min_load_factor(value);
+        }
+        min_load_factor_ = value;
+    }
+
+    /*!
+     * \brief Get the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing of the large table.
+     *
+     * \return Number of nodes. (Zero if incremental rehashing is disabled.)
+     */
+    [[nodiscard]] auto incremental_rehash_step() const noexcept -> size_type {
+        return incremental_rehash_step_;
+    }
+
+    /*!
+     * \brief Set the number of old nodes processed in each insertion or
+     * deletion during incremental rehashing of the large table.
+     *
+     * \param[in] value Number of nodes.
+     * \sa open_address_table_st::incremental_rehash_step(size_type)
+     */
+    void incremental_rehash_step(size_type value) {
+        if (large_table_) {
+            large_table_->incremental_rehash_step(value);
+        }
+        incremental_rehash_step_ = value;
+    }
+
+    /*!
+     * \brief Check whether incremental rehashing is in progress.
+     *
+     * \retval true Some values are left in old nodes.
+     * \retval false No value is left in old nodes.
+     */
+    [[nodiscard]] auto is_rehashing() const noexcept -> bool {
+        return large_table_ && large_table_->is_rehashing();
+    }
+
+    ///@}
+
+private:
+    //! Type of bit masks of filled inline slots.
+    using slot_mask_type = std::uint64_t;
+
+    /*!
+     * \brief Get the bit of an inline slot.
+     *
+     * \param[in] slot_ind Index of the slot.
+     * \return Bit.
+     */
+    [[nodiscard]] static auto slot_bit(size_type slot_ind) noexcept
+        -> slot_mask_type {
+        return static_cast<slot_mask_type>(1U) << slot_ind;
+    }
+
+    /*!
+     * \brief Get the first filled inline slot at or after a slot.
+     *
+     * \param[in] slot_ind Index of the slot.
+     * \return Index of the filled slot. (inline_capacity if not found.)
+     */
+    [[nodiscard]] auto next_filled_slot(size_type slot_ind) const noexcept
+        -> size_type {
+        for (; slot_ind < inline_capacity && (inline_mask_ >> slot_ind) != 0U;
+             ++slot_ind) {
+            if ((inline_mask_ & slot_bit(slot_ind)) != 0U) {
+                return slot_ind;
+            }
+        }
+        return inline_capacity;
+    }
+
+    /*!
+     * \brief Search the inline slot of a key.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Index of the slot. (inline_capacity if not found.)
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto find_slot_for(const KeyLike& key) const
+        -> size_type {
+        for (size_type i = next_filled_slot(0U); i < inline_capacity;
+             i = next_filled_slot(i + 1U)) {
+            if (key_equal_(extract_key_(inline_values_[i].get()), key)) {
+                return i;
+            }
+        }
+        return inline_capacity;
+    }
+
+    /*!
+     * \brief Get a value in the inline storage if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto try_get_inline(const KeyLike& key) -> value_type* {
+        const size_type slot_ind = find_slot_for(key);
+        if (slot_ind == inline_capacity) {
+            return nullptr;
+        }
+        return &inline_values_[slot_ind].get();
+    }
+
+    /*!
+     * \brief Get a value in the inline storage if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto try_get_inline(const KeyLike& key) const
+        -> const value_type* {
+        const size_type slot_ind = find_slot_for(key);
+        if (slot_ind == inline_capacity) {
+            return nullptr;
+        }
+        return &inline_values_[slot_ind].get();
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto try_get_for(const KeyLike& key) -> value_type* {
+        if (large_table_) {
+            return large_table_->try_get(key);
+        }
+        return try_get_inline(key);
+    }
+
+    /*!
+     * \brief Get a value if found.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Pointer to the value if found, otherwise nullptr.
+     */
+    template <typename KeyLike>
+    [[nodiscard]] auto try_get_for(const KeyLike& key) const
+        -> const value_type* {
+        if (large_table_) {
+            return std::as_const(*large_table_).try_get(key);
+        }
+        return try_get_inline(key);
+    }
+
+    /*!
+     * \brief Get a value from a pointer throwing an exception for nullptr.
+     *
+     * \tparam Pointer Type of the pointer.
+     * \param[in] value Pointer to the value.
+     * \return Value.
+     * \throw key_not_found If the pointer is nullptr.
+     */
+    template <typename Pointer>
+    [[nodiscard]] static auto require(Pointer value) -> decltype(*value) {
+        if (value == nullptr) {
+            throw key_not_found();
+        }
+        return *value;
+    }
+
+    /*!
+     * \brief Construct a value in an empty inline slot.
+     *
+     * \tparam Args Type of arguments of the constructor.
+     * \param[in] args Arguments of the constructor.
+     * \return Value.
+     */
+    template <typename... Args>
+    auto emplace_inline(Args&&... args) -> value_type& {
+        assert(inline_size_ < inline_capacity);
+        size_type slot_ind = 0;
+        while ((inline_mask_ & slot_bit(slot_ind)) != 0U) {
+            ++slot_ind;
+        }
+        inline_values_[slot_ind].emplace(std::forward<Args>(args)...);
+        inline_mask_ |= slot_bit(slot_ind);
+        ++inline_size_;
+        return inline_values_[slot_ind].get();
+    }
+
+    /*!
+     * \brief Delete a value in an inline slot.
+     *
+     * \param[in] slot_ind Index of the slot.
+     */
+    void erase_inline_at(size_type slot_ind) noexcept {
+        inline_values_[slot_ind].clear();
+        inline_mask_ &= ~slot_bit(slot_ind);
+        --inline_size_;
+    }
+
+    /*!
+     * \brief Delete all values in inline slots.
+     */
+    void clear_inline_values() noexcept {
+        for (size_type i = next_filled_slot(0U); i < inline_capacity;
+             i = next_filled_slot(i + 1U)) {
+            inline_values_[i].clear();
+        }
+        inline_mask_ = 0U;
+        inline_size_ = 0U;
+    }
+
+    /*!
+     * \brief Move values in inline slots from another table whose inline
+     * slots are empty.
+     *
+     * \param[in,out] obj Table to move values from. (Inline slots are empty
+     * after this function.)
+     */
+    void move_inline_values_from(small_open_address_table_st& obj) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>) {
+        for (size_type i = obj.next_filled_slot(0U); i < inline_capacity;
+             i = obj.next_filled_slot(i + 1U)) {
+            inline_values_[i].emplace(std::move(obj.inline_values_[i].get()));
+        }
+        inline_mask_ = obj.inline_mask_;
+        inline_size_ = obj.inline_size_;
+        obj.clear_inline_values();
+    }
+
+    /*!
+     * \brief Calculate the number of nodes of the large table for values.
+     *
+     * \param[in] size Number of values.
+     * \return Number of nodes.
+     */
+    [[nodiscard]] auto num_nodes_for(size_type size) const -> size_type {
+        return static_cast<size_type>(
+            std::ceil(static_cast<float>(size) / max_load_factor_));
+    }
+
+    /*!
+     * \brief Move values from inline slots to a new large table.
+     *
+     * Values are copied instead if their move constructor may throw
+     * exceptions. When an exception is thrown, values already moved to the
+     * large table are moved back to inline slots, so that this table is kept
+     * unchanged.
+     *
+     * \param[in] min_num_nodes Minimum number of nodes in the large table.
+     */
+    void make_large(size_type min_num_nodes) {
+        assert(!large_table_);
+        auto large_table = std::make_unique<large_table_type>(
+            min_num_nodes, extract_key_, hash_, key_equal_, allocator_);
+        large_table->max_load_factor(max_load_factor_);
+        large_table->min_load_factor(min_load_factor_);
+        large_table->incremental_rehash_step(incremental_rehash_step_);
+        size_type slot_ind = next_filled_slot(0U);
+        try {
+            for (; slot_ind < inline_capacity;
+                 slot_ind = next_filled_slot(slot_ind + 1U)) {
+                large_table->insert(utility::move_if_nothrow_move_constructible(
+                    inline_values_[slot_ind].get()));
+            }
+        } catch (...) {
+            if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+                for (size_type i = next_filled_slot(0U); i < slot_ind;
+                     i = next_filled_slot(i + 1U)) {
+                    erase_inline_at(i);
+                }
+                large_table->for_all([this](value_type& value) {
+                    emplace_inline(std::move(value));
+                });
+            }
+            throw;
+        }
+        clear_inline_values();
+        large_table_ = std::move(large_table);
+    }
+
+    /*!
+     * \brief Move values from full inline slots to a new large table for
+     * insertion of a value.
+     */
+    void make_large_for_insertion() {
+        make_large(num_nodes_for(inline_capacity + 1U));
+    }
+
+    /*!
+     * \brief Delete a value.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \retval true Deleted the value.
+     * \retval false Failed to delete the value because the key not found.
+     */
+    template <typename KeyLike>
+    auto erase_for(const KeyLike& key) -> bool {
+        if (large_table_) {
+            return large_table_->erase(key);
+        }
+        const size_type slot_ind = find_slot_for(key);
+        if (slot_ind == inline_capacity) {
+            return false;
+        }
+        erase_inline_at(slot_ind);
+        return true;
+    }
+
+    /*!
+     * \brief Delete a value and get the handle of the value.
+     *
+     * \tparam KeyLike Type of the key.
+     * \param[in] key Key.
+     * \return Handle of the value. (Empty if the key not found.)
+     */
+    template <typename KeyLike>
+    auto extract_for(const KeyLike& key) -> node_handle_type {
+        if (large_table_) {
+            return large_table_->extract(key);
+        }
+        node_handle_type node;
+        const size_type slot_ind = find_slot_for(key);
+        if (slot_ind < inline_capacity) {
+            auto& value = inline_values_[slot_ind].get();
+            node.emplace(hash_(extract_key_(value)),
+                utility::move_if_nothrow_move_constructible(value));
+            erase_inline_at(slot_ind);
+        }
+        return node;
+    }
+
+    //! Values stored inline.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init)
+    std::array<utility::value_storage<value_type>, inline_capacity>
+        inline_values_;
+
+    //! Bit mask of filled inline slots.
+    slot_mask_type inline_mask_{0U};
+
+    //! Number of values stored inline.
+    size_type inline_size_{0U};
+
+    //! Table used when values don't fit in the inline storage.
+    std::unique_ptr<large_table_type> large_table_{};
+
+    //! Function to extract keys from values.
+    extract_key_type extract_key_;
+
+    //! Hash function.
+    hash_type hash_;
+
+    //! Function to check whether keys are equal.
+    key_equal_type key_equal_;
+
+    //! Allocator.
+    allocator_type allocator_;
+
+    //! Default maximum load factor.
+    static constexpr float default_max_load_factor = 0.8F;
+
+    //! Maximum load factor of the large table.
+    float max_load_factor_{default_max_load_factor};
+
+    //! Minimum load factor of the large table.
+    float min_load_factor_{0.0F};
+
+    //! Number of old nodes processed in each step of incremental rehashing.
+    size_type incremental_rehash_step_{0};
+};
+
+namespace internal {
+
+/*!
+ * \brief Select the type of hash tables using open addressing for a policy.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash, typename KeyEqual, typename Allocator, typename Policy>
+struct open_address_table_for_policy {
+    //! Type of the table.
+    using type = open_address_table_st<ValueType, KeyType, ExtractKey, Hash,
+        KeyEqual, Allocator, Policy>;
+};
+
+/*!
+ * \brief Select the type of hash tables using open addressing for a policy
+ * (specialization for policies::small_table_policy).
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam InlineCapacity Maximum number of values stored inline.
+ * \tparam BasePolicy Type of the policy of open_address_table_st.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash, typename KeyEqual, typename Allocator,
+    std::size_t InlineCapacity, typename BasePolicy>
+struct open_address_table_for_policy<ValueType, KeyType, ExtractKey, Hash,
+    KeyEqual, Allocator,
+    policies::small_table_policy<InlineCapacity, BasePolicy>> {
+    //! Type of the table.
+    using type = small_open_address_table_st<ValueType, KeyType, ExtractKey,
+        Hash, KeyEqual, Allocator,
+        policies::small_table_policy<InlineCapacity, BasePolicy>>;
+};
+
+/*!
+ * \brief Type of hash tables using open addressing for a policy.
+ *
+ * \tparam ValueType Type of values.
+ * \tparam KeyType Type of keys.
+ * \tparam ExtractKey Type of the function to extract keys from values.
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Allocator Type of allocators.
+ * \tparam Policy Type of the policy.
+ */
+template <typename ValueType, typename KeyType, typename ExtractKey,
+    typename Hash, typename KeyEqual, typename Allocator, typename Policy>
+using open_address_table_for_policy_t =
+    typename open_address_table_for_policy<ValueType, KeyType, ExtractKey,
+        Hash, KeyEqual, Allocator, Policy>::type;
+
+}  // namespace internal
+
+}  // namespace hash_tables::tables
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of adaptive_mutex class.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "hash_tables/utility/pause_cpu.h"
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Class of mutexes spinning for a while and then sleeping.
+ *
+ * This class satisfies the requirements of Mutex in C++ standard library
+ * except for timed locking, so std::unique_lock can be used.
+ *
+ * Short critical sections are waited in busy loops as in spin_mutex, but
+ * threads waiting longer sleep until the lock is released, so that threads
+ * holding locks are not disturbed even when threads are more than
+ * processors. Releasing a lock wakes sleeping threads only when some threads
+ * sleep.
+ *
+ * \thread_safety Safe even for the same object.
+ */
+class adaptive_mutex {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    adaptive_mutex() noexcept = default;
+
+    adaptive_mutex(const adaptive_mutex&) = delete;
+    adaptive_mutex(adaptive_mutex&&) = delete;
+    auto operator=(const adaptive_mutex&) = delete;
+    auto operator=(adaptive_mutex&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~adaptive_mutex() noexcept = default;
+
+    /*!
+     * \brief Acquire the lock.
+     */
+    void lock() {
+        for (std::uint32_t i = 0; i < max_num_spins; ++i) {
+            if (try_lock()) {
+                return;
+            }
+            pause_cpu();
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        // Sleeping threads can't know whether other threads are sleeping, so
+        // the lock is always acquired in the state with sleeping threads.
+        while (state_.exchange(locked_with_sleepers,
+                   std::memory_order_acquire) != unlocked) {
+            wake_up_.wait(lock);
+        }
+    }
+
+    /*!
+     * \brief Try to acquire the lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock() noexcept -> bool {
+        std::uint32_t state = state_.load(std::memory_order_relaxed);
+        return state == unlocked &&
+            state_.compare_exchange_strong(state, locked,
+                std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Release the lock.
+     */
+    void unlock() {
+        if (state_.exchange(unlocked, std::memory_order_release) ==
+            locked_with_sleepers) {
+            // Lock sleep_mutex_ so that a thread between the check of the
+            // state and the start of sleeping doesn't miss the notification.
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            wake_up_.notify_one();
+        }
+    }
+
+private:
+    //! State without locks.
+    static constexpr std::uint32_t unlocked = 0U;
+
+    //! State with a lock and without sleeping threads.
+    static constexpr std::uint32_t locked = 1U;
+
+    //! State with a lock and possibly with sleeping threads.
+    static constexpr std::uint32_t locked_with_sleepers = 2U;
+
+    //! Maximum number of trials to acquire the lock before sleeping.
+    static constexpr std::uint32_t max_num_spins = 100U;
+
+    //! State.
+    std::atomic<std::uint32_t> state_{unlocked};
+
+    //! Mutex for sleeping threads.
+    std::mutex sleep_mutex_{};
+
+    //! Condition variable to wake up sleeping threads.
+    std::condition_variable wake_up_{};
+};
+
+}  // namespace hash_tables::utility
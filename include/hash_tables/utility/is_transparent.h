@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of is_transparent class.
+ */
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Check whether a type of functions has is_transparent type.
+ *
+ * \tparam T Type of functions.
+ */
+template <typename T, typename = void>
+struct is_transparent : public std::false_type {};
+
+#ifndef HASH_TABLES_DOCUMENTATION
+template <typename T>
+struct is_transparent<T, std::void_t<typename T::is_transparent>>
+    : public std::true_type {};
+#endif
+
+/*!
+ * \brief Check whether a type of functions has is_transparent type.
+ *
+ * \tparam T Type of functions.
+ */
+template <typename T>
+inline constexpr bool is_transparent_v = is_transparent<T>::value;
+
+/*!
+ * \brief Check whether lookup with keys of a type other than the key type is
+ * enabled.
+ *
+ * This requires that both functions are transparent, that the hash function
+ * can be called with keys used in lookup, and that the function to check
+ * whether keys are equal can be called with a key and a key used in lookup.
+ *
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Key Type of keys.
+ * \tparam KeyLike Type of keys used in lookup.
+ */
+template <typename Hash, typename KeyEqual, typename Key, typename KeyLike>
+struct is_transparent_lookup
+    : public std::conjunction<is_transparent<Hash>, is_transparent<KeyEqual>,
+          std::is_invocable<const Hash&, const KeyLike&>,
+          std::is_invocable_r<bool, const KeyEqual&, const Key&,
+              const KeyLike&>> {};
+
+/*!
+ * \brief Type to enable functions only for lookup with keys of a type other
+ * than the key type (heterogeneous lookup).
+ *
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Key Type of keys.
+ * \tparam KeyLike Type of keys used in lookup.
+ */
+template <typename Hash, typename KeyEqual, typename Key, typename KeyLike>
+using enable_transparent_lookup_t = std::enable_if_t<
+    is_transparent_lookup<Hash, KeyEqual, Key, KeyLike>::value, void*>;
+
+/*!
+ * \brief Check whether lookup with keys of a type is enabled.
+ *
+ * Lookup is enabled for keys of the key type, and for keys of other types if
+ * heterogeneous lookup is enabled.
+ *
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Key Type of keys.
+ * \tparam KeyLike Type of keys used in lookup.
+ */
+template <typename Hash, typename KeyEqual, typename Key, typename KeyLike>
+struct is_lookup_enabled
+    : public std::disjunction<std::is_same<Key, KeyLike>,
+          is_transparent_lookup<Hash, KeyEqual, Key, KeyLike>> {};
+
+/*!
+ * \brief Type to enable functions only for lookup with keys of the key type
+ * or keys of types enabled for heterogeneous lookup.
+ *
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Key Type of keys.
+ * \tparam KeyLike Type of keys used in lookup.
+ */
+template <typename Hash, typename KeyEqual, typename Key, typename KeyLike>
+using enable_lookup_t = std::enable_if_t<
+    is_lookup_enabled<Hash, KeyEqual, Key, KeyLike>::value, void*>;
+
+/*!
+ * \brief Type to enable functions only for lookup with elements of a
+ * sequence of keys.
+ *
+ * Lookup is enabled if the type of elements is the key type or heterogeneous
+ * lookup is enabled for the type of elements.
+ *
+ * \tparam Hash Type of the hash function.
+ * \tparam KeyEqual Type of the function to check whether keys are equal.
+ * \tparam Key Type of keys.
+ * \tparam Keys Type of the sequence of keys used in lookup.
+ */
+template <typename Hash, typename KeyEqual, typename Key, typename Keys>
+using enable_batch_lookup_t = std::enable_if_t<
+    is_lookup_enabled<Hash, KeyEqual, Key,
+        std::decay_t<decltype(std::declval<const Keys&>()[0])>>::value,
+    void*>;
+
+}  // namespace hash_tables::utility
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of is_trivially_relocatable class.
+ */
+#pragma once
+
+#include <type_traits>
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Check whether values of a type can be relocated by copying their
+ * bytes.
+ *
+ * Relocation is the move of a value to another place followed by destruction
+ * of the original value. Types with trivial move constructors and trivial
+ * destructors are relocatable by default. Other types (for example, types
+ * holding `std::unique_ptr`) can opt in by specializing this class.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+struct is_trivially_relocatable
+    : public std::bool_constant<std::is_trivially_move_constructible_v<T> &&
+          std::is_trivially_destructible_v<T>> {};
+
+/*!
+ * \brief Check whether values of a type can be relocated by copying their
+ * bytes.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+/*!
+ * \brief Check whether values of a type can be copied by copying their bytes.
+ *
+ * Unlike `std::is_trivially_copyable`, this ignores assignment operators,
+ * so that `std::pair` of integers can be copied in bulk.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+inline constexpr bool is_bytewise_copyable_v =
+    std::is_trivially_copy_constructible_v<T> &&
+    std::is_trivially_destructible_v<T>;
+
+}  // namespace hash_tables::utility
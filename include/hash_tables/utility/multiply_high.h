@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of multiply_high function.
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>  // IWYU pragma: keep
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Calculate the upper half of the product of two unsigned integers.
+ *
+ * \tparam Integer Type of the integers.
+ * \param[in] left Left-hand-side integer.
+ * \param[in] right Right-hand-side integer.
+ * \return Upper half of the product. (The product divided by
+ * 2^(number of digits of Integer).)
+ */
+template <typename Integer>
+auto multiply_high(Integer left, Integer right) noexcept -> Integer {
+    static_assert(std::is_integral_v<Integer>);
+    static_assert(std::is_unsigned_v<Integer>);
+    constexpr int digits = std::numeric_limits<Integer>::digits;
+
+    if constexpr (digits <= 32) {  // NOLINT
+        return static_cast<Integer>(
+            (static_cast<std::uint64_t>(left) * right) >> digits);
+    } else {
+        static_assert(digits == 64);  // NOLINT
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128
+            uint128;  // NOLINT(modernize-use-using)
+        return static_cast<Integer>(
+            (static_cast<uint128>(left) * right) >> digits);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        return static_cast<Integer>(__umulh(left, right));
+#else
+        constexpr std::uint64_t lower_mask = 0xFFFFFFFFU;
+        constexpr int half_digits = 32;
+        const std::uint64_t left_lower = left & lower_mask;
+        const std::uint64_t left_upper = left >> half_digits;
+        const std::uint64_t right_lower = right & lower_mask;
+        const std::uint64_t right_upper = right >> half_digits;
+        const std::uint64_t lower_lower = left_lower * right_lower;
+        const std::uint64_t lower_upper = left_lower * right_upper;
+        const std::uint64_t upper_lower = left_upper * right_lower;
+        const std::uint64_t upper_upper = left_upper * right_upper;
+        const std::uint64_t middle = (lower_lower >> half_digits) +
+            (lower_upper & lower_mask) + (upper_lower & lower_mask);
+        return static_cast<Integer>(upper_upper + (lower_upper >> half_digits) +
+            (upper_lower >> half_digits) + (middle >> half_digits));
+#endif
+    }
+}
+
+}  // namespace hash_tables::utility
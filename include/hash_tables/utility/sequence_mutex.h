@@ -0,0 +1,166 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of sequence_mutex class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Class of mutexes with sequence counters for optimistic reads
+ * (sequence locks).
+ *
+ * Exclusive locks increment the sequence counter when acquired and released,
+ * so the counter is odd while a thread modifies the protected data.
+ * Threads reading the data without locks call begin_read before reading and
+ * validate_read after reading, and discard the data read if validate_read
+ * returns false.
+ *
+ * Shared locks only exclude exclusive locks without changing the counter,
+ * so that threads failing in optimistic reads can read the data with locks.
+ * Threads with shared locks don't exclude each other.
+ *
+ * This class satisfies the requirements of SharedMutex in C++ standard
+ * library except for timed locking, so std::unique_lock and std::shared_lock
+ * can be used.
+ *
+ * \note Data read without locks may be modified by other threads at the same
+ * time, so only data which can be copied by copying bytes must be read
+ * without locks, and the memory of the data must not be released while
+ * threads read it. Such reads without atomic operations are data races in
+ * the C++ memory model and are reported by ThreadSanitizer, although the
+ * data read is used only after validate_read returns true.
+ *
+ * \thread_safety Safe even for the same object.
+ */
+class sequence_mutex {
+public:
+    //! Type of sequence numbers.
+    using sequence_type = std::uint64_t;
+
+    /*!
+     * \brief Constructor.
+     */
+    sequence_mutex() noexcept = default;
+
+    sequence_mutex(const sequence_mutex&) = delete;
+    sequence_mutex(sequence_mutex&&) = delete;
+    auto operator=(const sequence_mutex&) = delete;
+    auto operator=(sequence_mutex&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~sequence_mutex() noexcept = default;
+
+    /*!
+     * \brief Acquire an exclusive lock.
+     */
+    void lock() {
+        mutex_.lock();
+        begin_write();
+    }
+
+    /*!
+     * \brief Try to acquire an exclusive lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock() -> bool {
+        if (!mutex_.try_lock()) {
+            return false;
+        }
+        begin_write();
+        return true;
+    }
+
+    /*!
+     * \brief Release the exclusive lock.
+     */
+    void unlock() {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1U,
+            std::memory_order_release);
+        mutex_.unlock();
+    }
+
+    /*!
+     * \brief Acquire a shared lock.
+     */
+    void lock_shared() { mutex_.lock_shared(); }
+
+    /*!
+     * \brief Try to acquire a shared lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock_shared() -> bool {
+        return mutex_.try_lock_shared();
+    }
+
+    /*!
+     * \brief Release a shared lock.
+     */
+    void unlock_shared() { mutex_.unlock_shared(); }
+
+    /*!
+     * \brief Begin to read data without locks.
+     *
+     * \return Sequence number to be given to validate_read.
+     */
+    [[nodiscard]] auto begin_read() const noexcept -> sequence_type {
+        return sequence_.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * \brief Check whether data read without locks is valid.
+     *
+     * \param[in] sequence Sequence number returned by begin_read.
+     * \retval true No thread modified the data after begin_read.
+     * \retval false The data may have been modified.
+     */
+    [[nodiscard]] auto validate_read(sequence_type sequence) const noexcept
+        -> bool {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return (sequence & 1U) == 0U &&
+            sequence_.load(std::memory_order_relaxed) == sequence;
+    }
+
+private:
+    /*!
+     * \brief Mark the beginning of modification.
+     */
+    void begin_write() noexcept {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1U,
+            std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    //! Mutex.
+    std::shared_mutex mutex_{};
+
+    //! Sequence counter.
+    std::atomic<sequence_type> sequence_{0U};
+};
+
+}  // namespace hash_tables::utility
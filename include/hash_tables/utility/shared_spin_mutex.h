@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of shared_spin_mutex class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "hash_tables/utility/pause_cpu.h"
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Class of reader-writer locks waiting in busy loops.
+ *
+ * This class satisfies the requirements of SharedMutex in C++ standard
+ * library except for timed locking, so std::unique_lock and std::shared_lock
+ * can be used.
+ *
+ * A thread waiting for an exclusive lock blocks new shared locks, so that
+ * writers are not starved by continuous readers.
+ *
+ * \thread_safety Safe even for the same object.
+ */
+class shared_spin_mutex {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    shared_spin_mutex() noexcept = default;
+
+    shared_spin_mutex(const shared_spin_mutex&) = delete;
+    shared_spin_mutex(shared_spin_mutex&&) = delete;
+    auto operator=(const shared_spin_mutex&) = delete;
+    auto operator=(shared_spin_mutex&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~shared_spin_mutex() noexcept = default;
+
+    /*!
+     * \brief Acquire an exclusive lock.
+     */
+    void lock() noexcept {
+        while (true) {
+            std::uint32_t state = state_.load(std::memory_order_relaxed);
+            if ((state & ~writer_waiting_bit) == 0U) {
+                if (state_.compare_exchange_weak(state, writer_bit,
+                        std::memory_order_acquire,
+                        std::memory_order_relaxed)) {
+                    return;
+                }
+                continue;
+            }
+            if ((state & writer_waiting_bit) == 0U) {
+                state_.fetch_or(writer_waiting_bit, std::memory_order_relaxed);
+            }
+            pause_cpu();
+        }
+    }
+
+    /*!
+     * \brief Try to acquire an exclusive lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock() noexcept -> bool {
+        std::uint32_t state = state_.load(std::memory_order_relaxed);
+        return (state & ~writer_waiting_bit) == 0U &&
+            state_.compare_exchange_strong(state, writer_bit,
+                std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Release the exclusive lock.
+     */
+    void unlock() noexcept {
+        state_.fetch_and(~writer_bit, std::memory_order_release);
+    }
+
+    /*!
+     * \brief Acquire a shared lock.
+     */
+    void lock_shared() noexcept {
+        while (!try_lock_shared()) {
+            pause_cpu();
+        }
+    }
+
+    /*!
+     * \brief Try to acquire a shared lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock_shared() noexcept -> bool {
+        std::uint32_t state = state_.load(std::memory_order_relaxed);
+        return (state & (writer_bit | writer_waiting_bit)) == 0U &&
+            state_.compare_exchange_weak(state, state + 1U,
+                std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Release a shared lock.
+     */
+    void unlock_shared() noexcept {
+        state_.fetch_sub(1U, std::memory_order_release);
+    }
+
+private:
+    //! Bit set while a thread has the exclusive lock.
+    static constexpr std::uint32_t writer_bit = 0x80000000U;
+
+    //! Bit set while a thread waits for the exclusive lock.
+    static constexpr std::uint32_t writer_waiting_bit = 0x40000000U;
+
+    //! State. (Bits other than the above bits are the number of readers.)
+    std::atomic<std::uint32_t> state_{0U};
+};
+
+}  // namespace hash_tables::utility
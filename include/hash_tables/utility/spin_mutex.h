@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of spin_mutex class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "hash_tables/utility/pause_cpu.h"
+
+namespace hash_tables::utility {
+
+/*!
+ * \brief Class of mutexes waiting in busy loops (test-and-test-and-set locks
+ * with exponential backoff).
+ *
+ * This class satisfies the requirements of Mutex in C++ standard library
+ * except for timed locking, so std::unique_lock can be used.
+ *
+ * Waiting threads read the state without writing it, so that the cache line
+ * isn't moved between processors until the lock is released.
+ *
+ * \thread_safety Safe even for the same object.
+ */
+class spin_mutex {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    spin_mutex() noexcept = default;
+
+    spin_mutex(const spin_mutex&) = delete;
+    spin_mutex(spin_mutex&&) = delete;
+    auto operator=(const spin_mutex&) = delete;
+    auto operator=(spin_mutex&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~spin_mutex() noexcept = default;
+
+    /*!
+     * \brief Acquire the lock.
+     */
+    void lock() noexcept {
+        std::uint32_t num_pauses = 1U;
+        while (locked_.exchange(true, std::memory_order_acquire)) {
+            while (locked_.load(std::memory_order_relaxed)) {
+                for (std::uint32_t i = 0; i < num_pauses; ++i) {
+                    pause_cpu();
+                }
+                if (num_pauses < max_num_pauses) {
+                    num_pauses *= 2U;
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Try to acquire the lock.
+     *
+     * \retval true Acquired the lock.
+     * \retval false Failed to acquire the lock.
+     */
+    [[nodiscard]] auto try_lock() noexcept -> bool {
+        return !locked_.load(std::memory_order_relaxed) &&
+            !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    /*!
+     * \brief Release the lock.
+     */
+    void unlock() noexcept { locked_.store(false, std::memory_order_release); }
+
+private:
+    //! Maximum number of pauses between checks of the state.
+    static constexpr std::uint32_t max_num_pauses = 64U;
+
+    //! Whether a thread has the lock.
+    std::atomic<bool> locked_{false};
+};
+
+}  // namespace hash_tables::utility
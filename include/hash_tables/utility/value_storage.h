@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <cstring>
 #include <new>
 #include <utility>
 
@@ -70,6 +71,36 @@ public:
      */
     void clear() noexcept { get_pointer()->~value_type(); }
 
+    /*!
+     * \brief Copy bytes from another storage.
+     *
+     * After this function, this storage has a copy of the value in the other
+     * storage if exists.
+     *
+     * \param[in] obj Storage to copy bytes from.
+     *
+     * \note This function is valid only for types which can be copied by
+     * copying bytes. (See is_bytewise_copyable_v.)
+     */
+    void copy_bytes_from(const value_storage& obj) noexcept {
+        std::memcpy(storage_, obj.storage_, sizeof(value_type));
+    }
+
+    /*!
+     * \brief Relocate a value from another storage by copying bytes.
+     *
+     * After this function, the value in this storage is valid and the other
+     * storage must be treated as empty without calling clear function.
+     *
+     * \param[in,out] obj Storage to relocate the value from.
+     *
+     * \note This function is valid only for trivially relocatable types.
+     * (See is_trivially_relocatable.)
+     */
+    void relocate_from(value_storage& obj) noexcept {
+        std::memcpy(storage_, obj.storage_, sizeof(value_type));
+    }
+
     /*!
      * \brief Get the pointer of the value.
      *
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to clear and refill maps reused as scratch maps.
+ */
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables_test/create_random_int_vector.h"
+
+using key_type = std::uint64_t;
+using mapped_type = std::uint64_t;
+
+//! Number of values reserved in maps.
+constexpr std::size_t capacity = 65536;
+
+class clear_and_refill_pairs_fixture : public stat_bench::FixtureBase {
+public:
+    clear_and_refill_pairs_fixture() {
+        add_param<std::size_t>("size")
+            ->add(0)     // NOLINT
+            ->add(100)   // NOLINT
+            ->add(1000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(10000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_int_vector<key_type>(size_);
+    }
+
+protected:
+    /*!
+     * \brief Clear a map and insert pairs again.
+     *
+     * \tparam Map Type of the map.
+     * \param[in,out] map Map.
+     */
+    template <typename Map>
+    void clear_and_refill(Map& map) {
+        map.clear();
+        for (const auto& key : keys_) {
+            map.try_emplace(key, key);
+        }
+        assert(map.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(clear_and_refill_pairs_fixture, "clear_and_refill_pairs",
+    "unordered_map") {
+    std::unordered_map<key_type, mapped_type> map;
+    map.reserve(capacity);
+
+    STAT_BENCH_MEASURE() { clear_and_refill(map); };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(clear_and_refill_pairs_fixture, "clear_and_refill_pairs",
+    "open_address_st") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+    map.reserve(capacity);
+
+    STAT_BENCH_MEASURE() { clear_and_refill(map); };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(clear_and_refill_pairs_fixture, "clear_and_refill_pairs",
+    "open_address_st_robin_hood") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type,
+        hash_tables::hashes::default_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::robin_hood_policy>
+        map;
+    map.reserve(capacity);
+
+    STAT_BENCH_MEASURE() { clear_and_refill(map); };
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to insert pairs with many duplicated keys in maps.
+ */
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables_test/create_random_string_vector.h"
+
+using key_type = std::string;
+using mapped_type = std::string;
+
+//! Number of insertions per unique key.
+constexpr std::size_t insertions_per_key = 10;
+
+//! Length of mapped values.
+constexpr std::size_t mapped_length = 64;
+
+class create_pairs_duplicated_fixture : public stat_bench::FixtureBase {
+public:
+    create_pairs_duplicated_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)   // NOLINT
+            ->add(1000000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        num_keys_ = size_ / insertions_per_key;
+        keys_ = hash_tables_test::create_random_string_vector(num_keys_);
+        std::mt19937 engine;  // NOLINT
+        std::uniform_int_distribution<std::size_t> dist(0, num_keys_ - 1U);
+        key_indices_.resize(size_);
+        for (auto& index : key_indices_) {
+            index = dist(engine);
+        }
+    }
+
+protected:
+    /*!
+     * \brief Create a mapped value.
+     *
+     * \param[in] key Key.
+     * \return Mapped value.
+     */
+    [[nodiscard]] static auto create_mapped(const key_type& key)
+        -> mapped_type {
+        return mapped_type(mapped_length, key.front());
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t num_keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<std::size_t> key_indices_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_pairs_duplicated_fixture, "create_pairs_duplicated",
+    "open_address_st_emplace") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+        for (const std::size_t index : key_indices_) {
+            const auto& key = keys_[index];
+            map.emplace(key, create_mapped(key));
+        }
+        assert(map.size() <= num_keys_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_pairs_duplicated_fixture, "create_pairs_duplicated",
+    "open_address_st_try_emplace") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+        for (const std::size_t index : key_indices_) {
+            const auto& key = keys_[index];
+            map.try_emplace(key, mapped_length, key.front());
+        }
+        assert(map.size() <= num_keys_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_pairs_duplicated_fixture, "create_pairs_duplicated",
+    "open_address_st_try_emplace_with_factory") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+        for (const std::size_t index : key_indices_) {
+            const auto& key = keys_[index];
+            map.try_emplace_with_factory(
+                key, [&key] { return create_mapped(key); });
+        }
+        assert(map.size() <= num_keys_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+}
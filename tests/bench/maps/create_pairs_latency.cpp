@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of latency of each insertion of pairs in maps.
+ */
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/core.h>
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables_test/create_random_int_vector.h"
+#include "hash_tables_test/create_random_string_vector.h"
+
+using key_type = std::string;
+using mapped_type = int;
+
+//! Number of old nodes processed in each step of incremental rehashing.
+constexpr std::size_t incremental_rehash_step = 4;
+
+//! Path of the file to which percentiles of latencies are written.
+constexpr const char* percentiles_file_path = "create_pairs_latency.json";
+
+class create_pairs_latency_fixture : public stat_bench::FixtureBase {
+public:
+    create_pairs_latency_fixture() {
+        // Sizes are large enough to have 100 or more samples above the 99.9th
+        // percentile.
+        add_param<std::size_t>("size")
+            ->add(100000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(1000000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_string_vector(size_);
+        second_values_ =
+            hash_tables_test::create_random_int_vector<mapped_type>(size_);
+        latencies_.assign(size_, std::numeric_limits<double>::max());
+    }
+
+protected:
+    /*!
+     * \brief Insert a pair measuring the latency.
+     *
+     * Latency of each insertion is the minimum in all repetitions to remove
+     * noise from the environment, so that the worst case caused by rehashing
+     * remains.
+     *
+     * \tparam Map Type of the map.
+     * \param[in] map Map.
+     * \param[in] i Index of the pair.
+     */
+    template <typename Map>
+    void measure_insertion(Map& map, std::size_t i) {
+        const auto start = std::chrono::steady_clock::now();
+        map.emplace(keys_[i], second_values_[i]);
+        const auto end = std::chrono::steady_clock::now();
+        const double latency =
+            std::chrono::duration<double, std::nano>(end - start).count();
+        latencies_[i] = std::min(latencies_[i], latency);
+    }
+
+    /*!
+     * \brief Write percentiles of latencies.
+     *
+     * Percentiles of all cases measured so far are written to a JSON file in
+     * the working directory, next to the results written by stat_bench.
+     *
+     * \param[in] case_name Name of the case.
+     */
+    void write_percentiles(const char* case_name) const {
+        std::vector<double> sorted = latencies_;
+        std::sort(sorted.begin(), sorted.end());
+        const auto percentile = [&sorted](double rate) {
+            const auto index = static_cast<std::size_t>(
+                rate * static_cast<double>(sorted.size() - 1U));
+            return sorted[index];
+        };
+
+        static std::vector<std::string> results;
+        results.push_back(fmt::format(
+            R"({{"case": "{}", "size": {}, "p50": {:.0f}, "p99": {:.0f}, )"
+            R"("p99.9": {:.0f}, "max": {:.0f}}})",
+            case_name, size_, percentile(0.5), percentile(0.99),  // NOLINT
+            percentile(0.999), sorted.back()));                    // NOLINT
+
+        std::ofstream stream{percentiles_file_path};
+        stream << "[\n";
+        for (auto iter = results.begin(); iter != results.end(); ++iter) {
+            stream << "  " << *iter
+                   << (std::next(iter) == results.end() ? "\n" : ",\n");
+        }
+        stream << "]\n";
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<mapped_type> second_values_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<double> latencies_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    create_pairs_latency_fixture, "create_pairs_latency", "unordered_map") {
+    STAT_BENCH_MEASURE() {
+        std::unordered_map<key_type, mapped_type> map;
+        for (std::size_t i = 0; i < size_; ++i) {
+            measure_insertion(map, i);
+        }
+        assert(map.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+    write_percentiles("unordered_map");
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    create_pairs_latency_fixture, "create_pairs_latency", "open_address_st") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+        for (std::size_t i = 0; i < size_; ++i) {
+            measure_insertion(map, i);
+        }
+        assert(map.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+    write_percentiles("open_address_st");
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_pairs_latency_fixture, "create_pairs_latency",
+    "open_address_st_incremental") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+        map.incremental_rehash_step(incremental_rehash_step);
+        for (std::size_t i = 0; i < size_; ++i) {
+            measure_insertion(map, i);
+        }
+        assert(map.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(map);
+    };
+    write_percentiles("open_address_st_incremental");
+}
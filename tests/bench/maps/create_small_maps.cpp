@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to create many small maps.
+ */
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables_test/create_random_int_vector.h"
+
+using key_type = int;
+using mapped_type = int;
+
+//! Number of maps.
+constexpr std::size_t num_maps = 10000;
+
+/*!
+ * \brief Check whether a key exists in a map.
+ *
+ * \tparam Map Type of the map.
+ * \param[in] map Map.
+ * \param[in] key Key.
+ * \return Whether the key exists.
+ */
+template <typename Map>
+[[nodiscard]] auto has(const Map& map, const key_type& key) -> bool {
+    return map.has(key);
+}
+
+/*!
+ * \brief Check whether a key exists in a map.
+ *
+ * \param[in] map Map.
+ * \param[in] key Key.
+ * \return Whether the key exists.
+ */
+[[nodiscard]] auto has(const std::unordered_map<key_type, mapped_type>& map,
+    const key_type& key) -> bool {
+    return map.find(key) != map.end();
+}
+
+class create_small_maps_fixture : public stat_bench::FixtureBase {
+public:
+    create_small_maps_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1)   // NOLINT
+            ->add(4)   // NOLINT
+            ->add(8)   // NOLINT
+            ->add(16)  // NOLINT
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_int_vector<key_type>(
+            num_maps * size_);
+    }
+
+protected:
+    /*!
+     * \brief Create maps and search all keys in them.
+     *
+     * \tparam Map Type of maps.
+     */
+    template <typename Map>
+    void create_and_find() {
+        std::vector<Map> maps(num_maps);
+        for (std::size_t i = 0; i < num_maps; ++i) {
+            auto& map = maps[i];
+            for (std::size_t j = 0; j < size_; ++j) {
+                map.emplace(keys_[i * size_ + j], static_cast<mapped_type>(j));
+            }
+        }
+        std::size_t num_found = 0;
+        for (std::size_t i = 0; i < num_maps; ++i) {
+            const auto& map = maps[i];
+            for (std::size_t j = 0; j < size_; ++j) {
+                if (has(map, keys_[i * size_ + j])) {
+                    ++num_found;
+                }
+            }
+        }
+        assert(num_found == num_maps * size_);  // NOLINT
+        stat_bench::do_not_optimize(num_found);
+        stat_bench::do_not_optimize(maps);
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    create_small_maps_fixture, "create_small_maps", "unordered_map") {
+    STAT_BENCH_MEASURE() {
+        create_and_find<std::unordered_map<key_type, mapped_type>>();
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    create_small_maps_fixture, "create_small_maps", "open_address_st") {
+    STAT_BENCH_MEASURE() {
+        create_and_find<
+            hash_tables::maps::open_address_map_st<key_type, mapped_type>>();
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    create_small_maps_fixture, "create_small_maps", "small_open_address_st") {
+    STAT_BENCH_MEASURE() {
+        create_and_find<hash_tables::maps::open_address_map_st<key_type,
+            mapped_type, hash_tables::hashes::default_hash<key_type>,
+            std::equal_to<key_type>,
+            std::allocator<std::pair<key_type, mapped_type>>,
+            hash_tables::tables::policies::small_table_policy<>>>();
+    };
+}
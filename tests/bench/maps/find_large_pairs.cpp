@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to find pairs with large mapped values in maps.
+ */
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/multi_open_address_map_st.h"
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables_test/create_random_int_vector.h"
+
+using key_type = std::uint64_t;
+
+//! Number of bytes in mapped values.
+constexpr std::size_t mapped_size = 256;
+
+//! Type of large mapped values.
+struct mapped_type {
+    //! Data.
+    std::array<unsigned char, mapped_size> data;
+};
+
+using separate_values_policy =
+    hash_tables::tables::policies::separate_values_policy;
+
+class find_large_pairs_fixture : public stat_bench::FixtureBase {
+public:
+    find_large_pairs_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1000)   // NOLINT
+            ->add(10000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        // The first half of keys are inserted, and the second half of keys
+        // are used for searches without hits.
+        keys_ = hash_tables_test::create_random_int_vector<key_type>(
+            size_ * 2U);
+    }
+
+protected:
+    /*!
+     * \brief Create a map.
+     *
+     * \tparam Map Type of the map.
+     * \param[out] map Map.
+     */
+    template <typename Map>
+    void fill(Map& map) const {
+        for (std::size_t i = 0; i < size_; ++i) {
+            map.emplace(keys_[i], mapped_type{});
+        }
+        assert(map.size() == size_);  // NOLINT
+    }
+
+    /*!
+     * \brief Search all keys.
+     *
+     * \tparam Map Type of the map.
+     * \param[in] map Map.
+     */
+    template <typename Map>
+    void find_all(Map& map) const {
+        for (const auto& key : keys_) {
+            stat_bench::do_not_optimize(map.try_get(key));
+        }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_large_pairs_fixture, "find_large_pairs", "open_address_st") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+    fill(map);
+
+    STAT_BENCH_MEASURE() { find_all(map); };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_large_pairs_fixture, "find_large_pairs",
+    "open_address_st_separate") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type,
+        hash_tables::hashes::default_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        separate_values_policy>
+        map;
+    fill(map);
+
+    STAT_BENCH_MEASURE() { find_all(map); };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_large_pairs_fixture, "find_large_pairs", "multi_open_address_st") {
+    hash_tables::maps::multi_open_address_map_st<key_type, mapped_type> map;
+    fill(map);
+
+    STAT_BENCH_MEASURE() { find_all(map); };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_large_pairs_fixture, "find_large_pairs",
+    "multi_open_address_st_separate") {
+    hash_tables::maps::multi_open_address_map_st<key_type, mapped_type,
+        hash_tables::hashes::default_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        separate_values_policy>
+        map;
+    fill(map);
+
+    STAT_BENCH_MEASURE() { find_all(map); };
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to find pairs in maps in batches.
+ */
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/maps/multi_open_address_map_st.h"
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables_test/create_random_int_vector.h"
+#include "hash_tables_test/create_random_string_vector.h"
+
+using key_type = std::string;
+using mapped_type = int;
+
+class find_pairs_batch_fixture : public stat_bench::FixtureBase {
+public:
+    find_pairs_batch_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)   // NOLINT
+            ->add(1000000)  // NOLINT
+#endif
+            ;
+        add_param<std::size_t>("batch")
+            ->add(32)   // NOLINT
+            ->add(256)  // NOLINT
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        const auto batch_size = context.get_param<std::size_t>("batch");
+        keys_ = hash_tables_test::create_random_string_vector(size_);
+        second_values_ =
+            hash_tables_test::create_random_int_vector<mapped_type>(size_);
+
+        key_batches_.clear();
+        for (std::size_t first = 0; first < size_; first += batch_size) {
+            const std::size_t last = std::min(first + batch_size, size_);
+            key_batches_.emplace_back(
+                keys_.begin() + static_cast<std::ptrdiff_t>(first),
+                keys_.begin() + static_cast<std::ptrdiff_t>(last));
+        }
+        outputs_.resize(batch_size);
+    }
+
+protected:
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<mapped_type> second_values_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<std::vector<key_type>> key_batches_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<mapped_type*> outputs_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_pairs_batch_fixture, "find_pairs_batch", "open_address_st") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        map.emplace(key, second_value);
+    }
+    assert(map.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (const auto& keys : key_batches_) {
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                outputs_[i] = map.try_get(keys[i]);
+            }
+            stat_bench::do_not_optimize(outputs_);
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_pairs_batch_fixture, "find_pairs_batch", "open_address_st_batch") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        map.emplace(key, second_value);
+    }
+    assert(map.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (const auto& keys : key_batches_) {
+            map.find_batch(keys, outputs_);
+            stat_bench::do_not_optimize(outputs_);
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_pairs_batch_fixture, "find_pairs_batch", "multi_open_address_st") {
+    hash_tables::maps::multi_open_address_map_st<key_type, mapped_type> map;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        map.emplace(key, second_value);
+    }
+    assert(map.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (const auto& keys : key_batches_) {
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                outputs_[i] = map.try_get(keys[i]);
+            }
+            stat_bench::do_not_optimize(outputs_);
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_pairs_batch_fixture, "find_pairs_batch",
+    "multi_open_address_st_batch") {
+    hash_tables::maps::multi_open_address_map_st<key_type, mapped_type> map;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        map.emplace(key, second_value);
+    }
+    assert(map.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (const auto& keys : key_batches_) {
+            map.find_batch(keys, outputs_);
+            stat_bench::do_not_optimize(outputs_);
+        }
+    };
+}
@@ -24,6 +24,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -37,9 +38,10 @@
 #include <stat_bench/invocation_context.h>
 #include <stat_bench/param/parameter_value_vector.h>
 
-#include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/hashes/default_hash.h"
 #include "hash_tables/maps/multi_open_address_map_mt.h"
 #include "hash_tables/maps/separate_shared_chain_map_mt.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables/tables/separate_shared_chain_table_mt.h"
 #include "hash_tables_test/create_random_int_vector.h"
 #include "hash_tables_test/create_random_string_vector.h"
@@ -58,7 +60,15 @@ public:
             ->add(100000)  // NOLINT
 #endif
             ;
-        add_threads_param()->add(1)->add(2)->add(4);
+        add_param<std::string>("keys")->add("uniform")->add("skewed");
+        add_threads_param()
+            ->add(1)
+            ->add(2)
+            ->add(4)
+            ->add(8)    // NOLINT
+            ->add(16)   // NOLINT
+            ->add(32)   // NOLINT
+            ->add(64);  // NOLINT
     }
 
     void setup(stat_bench::InvocationContext& context) override {
@@ -66,9 +76,89 @@ public:
         keys_ = hash_tables_test::create_random_string_vector(size_);
         second_values_ =
             hash_tables_test::create_random_int_vector<mapped_type>(size_);
+        lookup_indices_ = create_lookup_indices(
+            size_ * context.threads(), context.get_param<std::string>("keys"));
     }
 
 protected:
+    /*!
+     * \brief Create indices of keys to look up.
+     *
+     * Skewed indices follow Zipf's law (the probability of the i-th key is
+     * proportional to \( 1 / (i + 1) \)), so that a few hot keys are looked
+     * up from many threads at once.
+     *
+     * \param[in] num_lookups Number of lookups.
+     * \param[in] distribution Name of the distribution of keys.
+     * \return Indices.
+     */
+    [[nodiscard]] std::vector<std::size_t> create_lookup_indices(
+        std::size_t num_lookups, const std::string& distribution) const {
+        std::mt19937 engine;  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+        std::vector<std::size_t> indices;
+        indices.reserve(num_lookups);
+        if (distribution == "skewed") {
+            std::vector<double> weights;
+            weights.reserve(size_);
+            for (std::size_t i = 0; i < size_; ++i) {
+                weights.push_back(1.0 / static_cast<double>(i + 1U));
+            }
+            std::discrete_distribution<std::size_t> dist(
+                weights.begin(), weights.end());
+            for (std::size_t i = 0; i < num_lookups; ++i) {
+                indices.push_back(dist(engine));
+            }
+        } else {
+            std::uniform_int_distribution<std::size_t> dist(0, size_ - 1U);
+            for (std::size_t i = 0; i < num_lookups; ++i) {
+                indices.push_back(dist(engine));
+            }
+        }
+        return indices;
+    }
+
+    /*!
+     * \brief Look up keys assigned to a thread.
+     *
+     * Each thread looks up size_ keys, so that the amount of work per thread
+     * is independent of the number of threads.
+     *
+     * \tparam Function Type of the function to look up a key.
+     * \param[in] thread_ind Index of the thread.
+     * \param[in] function Function to look up a key.
+     */
+    template <typename Function>
+    void look_up(std::size_t thread_ind, Function&& function) const {
+        const std::size_t begin_ind = thread_ind * size_;
+        const std::size_t end_ind = begin_ind + size_;
+        for (std::size_t i = begin_ind; i < end_ind; ++i) {
+            function(keys_[lookup_indices_[i]]);
+        }
+    }
+
+    /*!
+     * \brief Benchmark a map.
+     *
+     * \tparam Map Type of the map.
+     */
+    template <typename Map>
+    void bench_map() {
+        Map map;
+        for (std::size_t i = 0; i < size_; ++i) {
+            const auto& key = keys_.at(i);
+            const auto& second_value = second_values_.at(i);
+            map.emplace(key, second_value);
+        }
+        assert(map.size() == size_);  // NOLINT
+
+        STAT_BENCH_MEASURE_INDEXED(
+            thread_ind, /*sample_ind*/, /*iteration_ind*/) {
+            look_up(thread_ind, [&map](const key_type& key) {
+                stat_bench::do_not_optimize(map.at(key));
+            });
+        };
+    }
+
     // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
     std::size_t size_{};
 
@@ -77,6 +167,9 @@ protected:
 
     // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
     std::vector<mapped_type> second_values_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<std::size_t> lookup_indices_{};
 };
 
 // NOLINTNEXTLINE
@@ -92,70 +185,44 @@ STAT_BENCH_CASE_F(find_pairs_concurrent_fixture, "find_pairs_concurrent",
 
     std::mutex mutex;
 
-    const std::size_t num_threads =
-        stat_bench::current_invocation_context().threads();
-    const std::size_t size_per_thread = (size_ + num_threads - 1) / num_threads;
-
     STAT_BENCH_MEASURE_INDEXED(thread_ind, /*sample_ind*/, /*iteration_ind*/) {
-        const std::size_t begin_ind = thread_ind * size_per_thread;
-        const std::size_t end_ind =
-            std::min((thread_ind + 1) * size_per_thread, size_);
-        for (std::size_t i = begin_ind; i < end_ind; ++i) {
-            const auto& key = keys_.at(i);
+        look_up(thread_ind, [&map, &mutex](const key_type& key) {
             std::unique_lock<std::mutex> lock(mutex);
             stat_bench::do_not_optimize(map.at(key));
-        };
+        });
     };
 }
 
 // NOLINTNEXTLINE
 STAT_BENCH_CASE_F(find_pairs_concurrent_fixture, "find_pairs_concurrent",
     "multi_open_address_mt") {
-    hash_tables::maps::multi_open_address_map_mt<key_type, mapped_type> map;
-    for (std::size_t i = 0; i < size_; ++i) {
-        const auto& key = keys_.at(i);
-        const auto& second_value = second_values_.at(i);
-        map.emplace(key, second_value);
-    }
-    assert(map.size() == size_);  // NOLINT
+    bench_map<
+        hash_tables::maps::multi_open_address_map_mt<key_type, mapped_type>>();
+}
 
-    const std::size_t num_threads =
-        stat_bench::current_invocation_context().threads();
-    const std::size_t size_per_thread = (size_ + num_threads - 1) / num_threads;
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_pairs_concurrent_fixture, "find_pairs_concurrent",
+    "multi_open_address_mt_mutex") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::mutex_lock_policy>>();
+}
 
-    STAT_BENCH_MEASURE_INDEXED(thread_ind, /*sample_ind*/, /*iteration_ind*/) {
-        const std::size_t begin_ind = thread_ind * size_per_thread;
-        const std::size_t end_ind =
-            std::min((thread_ind + 1) * size_per_thread, size_);
-        for (std::size_t i = begin_ind; i < end_ind; ++i) {
-            const auto& key = keys_.at(i);
-            stat_bench::do_not_optimize(map.at(key));
-        };
-    };
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_pairs_concurrent_fixture, "find_pairs_concurrent",
+    "multi_open_address_mt_shared_spin") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::shared_spin_lock_policy>>();
 }
 
 // NOLINTNEXTLINE
 STAT_BENCH_CASE_F(
     find_pairs_concurrent_fixture, "find_pairs_concurrent", "shared_chain_mt") {
-    hash_tables::maps::separate_shared_chain_map_mt<key_type, mapped_type> map;
-    for (std::size_t i = 0; i < size_; ++i) {
-        const auto& key = keys_.at(i);
-        const auto& second_value = second_values_.at(i);
-        map.emplace(key, second_value);
-    }
-    assert(map.size() == size_);  // NOLINT
-
-    const std::size_t num_threads =
-        stat_bench::current_invocation_context().threads();
-    const std::size_t size_per_thread = (size_ + num_threads - 1) / num_threads;
-
-    STAT_BENCH_MEASURE_INDEXED(thread_ind, /*sample_ind*/, /*iteration_ind*/) {
-        const std::size_t begin_ind = thread_ind * size_per_thread;
-        const std::size_t end_ind =
-            std::min((thread_ind + 1) * size_per_thread, size_);
-        for (std::size_t i = begin_ind; i < end_ind; ++i) {
-            const auto& key = keys_.at(i);
-            stat_bench::do_not_optimize(map.at(key));
-        };
-    };
+    bench_map<hash_tables::maps::separate_shared_chain_map_mt<key_type,
+        mapped_type>>();
 }
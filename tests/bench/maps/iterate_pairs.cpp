@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to iterate over pairs in maps after deletion of pairs.
+ */
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/maps/dense_open_address_map_st.h"
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables_test/create_random_int_vector.h"
+
+using key_type = std::uint64_t;
+using mapped_type = std::uint64_t;
+
+//! Modulus used to select keys to delete.
+constexpr key_type deletion_modulus = 10;
+
+//! Number of remainders of keys to delete. (70% of keys are deleted.)
+constexpr key_type num_deleted_remainders = 7;
+
+/*!
+ * \brief Check whether a key is deleted before iteration.
+ *
+ * \param[in] key Key.
+ * \return Whether the key is deleted.
+ */
+[[nodiscard]] auto is_deleted(key_type key) -> bool {
+    return key % deletion_modulus < num_deleted_remainders;
+}
+
+class iterate_pairs_fixture : public stat_bench::FixtureBase {
+public:
+    iterate_pairs_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1000)   // NOLINT
+            ->add(10000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)   // NOLINT
+            ->add(1000000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_int_vector<key_type>(size_);
+    }
+
+protected:
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(iterate_pairs_fixture, "iterate_pairs", "unordered_map") {
+    std::unordered_map<key_type, mapped_type> map;
+    for (const auto& key : keys_) {
+        map.try_emplace(key, key);
+    }
+    for (auto iter = map.begin(); iter != map.end();) {
+        if (is_deleted(iter->first)) {
+            iter = map.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    STAT_BENCH_MEASURE() {
+        mapped_type sum = 0;
+        for (const auto& [key, value] : map) {
+            sum += value;
+        }
+        stat_bench::do_not_optimize(sum);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(iterate_pairs_fixture, "iterate_pairs", "open_address_st") {
+    hash_tables::maps::open_address_map_st<key_type, mapped_type> map;
+    for (const auto& key : keys_) {
+        map.emplace(key, key);
+    }
+    map.erase_if([](const key_type& key, const mapped_type& /*value*/) {
+        return is_deleted(key);
+    });
+
+    STAT_BENCH_MEASURE() {
+        mapped_type sum = 0;
+        map.for_all([&sum](const key_type& /*key*/, const mapped_type& value) {
+            sum += value;
+        });
+        stat_bench::do_not_optimize(sum);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    iterate_pairs_fixture, "iterate_pairs", "dense_open_address_st") {
+    hash_tables::maps::dense_open_address_map_st<key_type, mapped_type> map;
+    for (const auto& key : keys_) {
+        map.emplace(key, key);
+    }
+    map.erase_if([](const key_type& key, const mapped_type& /*value*/) {
+        return is_deleted(key);
+    });
+
+    STAT_BENCH_MEASURE() {
+        mapped_type sum = 0;
+        map.for_all([&sum](const key_type& /*key*/, const mapped_type& value) {
+            sum += value;
+        });
+        stat_bench::do_not_optimize(sum);
+    };
+}
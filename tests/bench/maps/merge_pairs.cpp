@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to move pairs between maps.
+ */
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/maps/open_address_map_st.h"
+#include "hash_tables_test/create_random_int_vector.h"
+#include "hash_tables_test/create_random_string_vector.h"
+
+using key_type = std::string;
+using mapped_type = int;
+
+class merge_pairs_fixture : public stat_bench::FixtureBase {
+public:
+    merge_pairs_fixture() {
+        add_param<std::size_t>("size")
+            ->add(1000)   // NOLINT
+            ->add(10000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)   // NOLINT
+            ->add(1000000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_string_vector(size_);
+        second_values_ =
+            hash_tables_test::create_random_int_vector<mapped_type>(size_);
+    }
+
+protected:
+    /*!
+     * \brief Create a map.
+     *
+     * \tparam Map Type of the map.
+     * \return Map.
+     */
+    template <typename Map>
+    [[nodiscard]] auto create_map() const -> Map {
+        Map map;
+        for (std::size_t i = 0; i < size_; ++i) {
+            map.emplace(keys_[i], second_values_[i]);
+        }
+        return map;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<mapped_type> second_values_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(merge_pairs_fixture, "merge_pairs", "unordered_map") {
+    using map_type = std::unordered_map<key_type, mapped_type>;
+    auto source = create_map<map_type>();
+    map_type destination;
+
+    STAT_BENCH_MEASURE() {
+        destination.merge(source);
+        source.merge(destination);
+        assert(source.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(source);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    merge_pairs_fixture, "merge_pairs", "open_address_st_reinsert") {
+    using map_type =
+        hash_tables::maps::open_address_map_st<key_type, mapped_type>;
+    auto source = create_map<map_type>();
+    map_type destination;
+
+    const auto move_all = [](map_type& from, map_type& to) {
+        from.for_all([&to](const key_type& key, mapped_type& mapped) {
+            to.emplace(key, std::move(mapped));
+        });
+        from.clear();
+    };
+
+    STAT_BENCH_MEASURE() {
+        move_all(source, destination);
+        move_all(destination, source);
+        assert(source.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(source);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(merge_pairs_fixture, "merge_pairs", "open_address_st") {
+    using map_type =
+        hash_tables::maps::open_address_map_st<key_type, mapped_type>;
+    auto source = create_map<map_type>();
+    map_type destination;
+
+    STAT_BENCH_MEASURE() {
+        destination.merge(source);
+        source.merge(destination);
+        assert(source.size() == size_);  // NOLINT
+        stat_bench::do_not_optimize(source);
+    };
+}
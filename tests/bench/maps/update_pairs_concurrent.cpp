@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to read and update pairs of integers in maps from multiple
+ * threads with different policies of locks.
+ */
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/maps/multi_open_address_map_mt.h"
+#include "hash_tables/maps/separate_shared_chain_map_mt.h"
+#include "hash_tables/tables/lock_policies.h"
+#include "hash_tables_test/create_random_int_vector.h"
+
+using key_type = int;
+using mapped_type = int;
+
+//! Number of operations per thread.
+constexpr std::size_t num_operations = 10000;
+
+//! Interval of updates in operations. (Other operations read values.)
+constexpr std::size_t update_interval = 4;
+
+class update_pairs_concurrent_fixture : public stat_bench::FixtureBase {
+public:
+    update_pairs_concurrent_fixture() {
+        // Fewer keys make more threads access the same locks at once.
+        add_param<std::size_t>("size")
+            ->add(16)    // NOLINT
+            ->add(1000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(100000)  // NOLINT
+#endif
+            ;
+        add_threads_param()
+            ->add(1)
+            ->add(2)
+            ->add(4)
+            ->add(8)    // NOLINT
+            ->add(16)   // NOLINT
+            ->add(32);  // NOLINT
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+        keys_ = hash_tables_test::create_random_int_vector<key_type>(size_);
+        second_values_ =
+            hash_tables_test::create_random_int_vector<mapped_type>(size_);
+
+        std::mt19937 engine;  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+        std::uniform_int_distribution<std::size_t> dist(0, size_ - 1U);
+        const std::size_t num_indices = num_operations * context.threads();
+        indices_.clear();
+        indices_.reserve(num_indices);
+        for (std::size_t i = 0; i < num_indices; ++i) {
+            indices_.push_back(dist(engine));
+        }
+    }
+
+protected:
+    /*!
+     * \brief Benchmark a map.
+     *
+     * Each thread executes num_operations operations, one in update_interval
+     * of which updates a value and others read values.
+     *
+     * \tparam Map Type of the map.
+     */
+    template <typename Map>
+    void bench_map() {
+        Map map;
+        for (std::size_t i = 0; i < size_; ++i) {
+            map.emplace(keys_.at(i), second_values_.at(i));
+        }
+        assert(map.size() == size_);  // NOLINT
+
+        STAT_BENCH_MEASURE_INDEXED(
+            thread_ind, /*sample_ind*/, /*iteration_ind*/) {
+            const std::size_t begin_ind = thread_ind * num_operations;
+            const std::size_t end_ind = begin_ind + num_operations;
+            for (std::size_t i = begin_ind; i < end_ind; ++i) {
+                const std::size_t index = indices_[i];
+                if (i % update_interval == 0U) {
+                    map.assign(keys_[index], second_values_[index]);
+                } else {
+                    stat_bench::do_not_optimize(map.at(keys_[index]));
+                }
+            }
+        };
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<key_type> keys_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<mapped_type> second_values_{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::vector<std::size_t> indices_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "multi_open_address_mt_mutex") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::mutex_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "multi_open_address_mt_shared_mutex") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::shared_mutex_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "multi_open_address_mt_spin") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::spin_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "multi_open_address_mt_adaptive") {
+    bench_map<hash_tables::maps::multi_open_address_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::adaptive_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "shared_chain_mt_mutex") {
+    bench_map<hash_tables::maps::separate_shared_chain_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::mutex_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "shared_chain_mt_shared_mutex") {
+    bench_map<hash_tables::maps::separate_shared_chain_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::shared_mutex_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "shared_chain_mt_spin") {
+    bench_map<hash_tables::maps::separate_shared_chain_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::spin_lock_policy>>();
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(update_pairs_concurrent_fixture, "update_pairs_concurrent",
+    "shared_chain_mt_adaptive") {
+    bench_map<hash_tables::maps::separate_shared_chain_map_mt<key_type,
+        mapped_type, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::adaptive_lock_policy>>();
+}
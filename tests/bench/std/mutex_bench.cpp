@@ -27,6 +27,10 @@
 #include <stat_bench/fixture_base.h>
 #include <stat_bench/param/parameter_value_vector.h>
 
+#include "hash_tables/utility/adaptive_mutex.h"
+#include "hash_tables/utility/shared_spin_mutex.h"
+#include "hash_tables/utility/spin_mutex.h"
+
 class fixture : public stat_bench::FixtureBase {
 public:
     fixture() {
@@ -62,4 +66,40 @@ STAT_BENCH_CASE_F(fixture, "lock", "std::shared_mutex (shared)") {
     };
 }
 
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(fixture, "lock", "spin_mutex") {
+    hash_tables::utility::spin_mutex mutex;
+    STAT_BENCH_MEASURE() {
+        mutex.lock();
+        mutex.unlock();
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(fixture, "lock", "adaptive_mutex") {
+    hash_tables::utility::adaptive_mutex mutex;
+    STAT_BENCH_MEASURE() {
+        mutex.lock();
+        mutex.unlock();
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(fixture, "lock", "shared_spin_mutex (unique)") {
+    hash_tables::utility::shared_spin_mutex mutex;
+    STAT_BENCH_MEASURE() {
+        mutex.lock();
+        mutex.unlock();
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(fixture, "lock", "shared_spin_mutex (shared)") {
+    hash_tables::utility::shared_spin_mutex mutex;
+    STAT_BENCH_MEASURE() {
+        mutex.lock_shared();
+        mutex.unlock_shared();
+    };
+}
+
 STAT_BENCH_MAIN
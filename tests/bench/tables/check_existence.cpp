@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -35,8 +36,11 @@
 #include <stat_bench/param/parameter_value_vector.h>
 
 #include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/hashes/default_hash.h"
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/group_probing_table_st.h"
 #include "hash_tables/tables/multi_open_address_table_mt.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
 #include "hash_tables_test/create_random_int_vector.h"
 #include "hash_tables_test/create_random_string_vector.h"
@@ -107,7 +111,49 @@ STAT_BENCH_CASE_F(
 
     STAT_BENCH_MEASURE() {
         for (std::size_t i = 0; i < size_; ++i) {
-            stat_bench::do_not_optimize(table.try_get(keys_.at(i)));
+            stat_bench::do_not_optimize(table.try_get(keys_search_.at(i)));
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    check_existence_fixture, "check_existence", "open_address_st_robin_hood") {
+    hash_tables::tables::open_address_table_st<value_type, key_type,
+        extract_key, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>, std::allocator<value_type>,
+        hash_tables::tables::policies::robin_hood_policy>
+        table;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        table.emplace(key, key, second_value);
+    }
+    assert(table.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            stat_bench::do_not_optimize(table.try_get(keys_search_.at(i)));
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    check_existence_fixture, "check_existence", "group_probing_st") {
+    hash_tables::tables::group_probing_table_st<value_type, key_type,
+        extract_key>
+        table;
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        table.emplace(key, key, second_value);
+    }
+    assert(table.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            stat_bench::do_not_optimize(table.try_get(keys_search_.at(i)));
         }
     };
 }
@@ -127,7 +173,7 @@ STAT_BENCH_CASE_F(
 
     STAT_BENCH_MEASURE() {
         for (std::size_t i = 0; i < size_; ++i) {
-            stat_bench::do_not_optimize(table.try_get(keys_.at(i)));
+            stat_bench::do_not_optimize(table.try_get(keys_search_.at(i)));
         }
     };
 }
@@ -82,10 +82,13 @@ protected:
 // NOLINTNEXTLINE
 STAT_BENCH_CASE_F(create_pairs_multi_tables_fixture,
     "create_pairs_multi_tables", "multi_open_address_st") {
-    STAT_BENCH_MEASURE() {
+    using table_type =
         hash_tables::tables::multi_open_address_table_st<value_type, key_type,
-            extract_key>
-            table{num_tables_};
+            extract_key>;
+    STAT_BENCH_MEASURE() {
+        table_type table{table_type::default_num_internal_nodes, extract_key(),
+            table_type::hash_type(), table_type::key_equal_type(),
+            table_type::allocator_type(), num_tables_};
         for (std::size_t i = 0; i < size_; ++i) {
             const auto& key = keys_.at(i);
             const auto& second_value = second_values_.at(i);
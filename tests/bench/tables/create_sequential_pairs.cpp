@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to create tables of pairs with sequential integer keys.
+ */
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/do_not_optimize.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+
+#include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/tables/group_probing_table_st.h"
+#include "hash_tables/tables/open_address_table_st.h"
+
+using key_type = int;
+using value_type = std::pair<int, std::string>;
+using extract_key =
+    hash_tables::extract_key_functions::extract_first_from_pair<value_type>;
+
+class create_sequential_pairs_fixture : public stat_bench::FixtureBase {
+public:
+    create_sequential_pairs_fixture() {
+        add_param<std::size_t>("size")
+            ->add(100)   // NOLINT
+            ->add(1000)  // NOLINT
+#ifdef HASH_TABLES_ENABLE_HEAVY_BENCH
+            ->add(10000)   // NOLINT
+            ->add(100000)  // NOLINT
+#endif
+            ;
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        size_ = context.get_param<std::size_t>("size");
+    }
+
+protected:
+    /*!
+     * \brief Insert pairs with keys 0, 1, 2, ... and find them.
+     *
+     * \tparam Table Type of the table.
+     * \param[in,out] table Table.
+     */
+    template <typename Table>
+    void create_and_find(Table& table) {
+        const auto size = static_cast<key_type>(size_);
+        for (key_type key = 0; key < size; ++key) {
+            table.emplace(key, key, std::string());
+        }
+        assert(table.size() == size_);  // NOLINT
+        for (key_type key = 0; key < size; ++key) {
+            stat_bench::do_not_optimize(table.at(key));
+        }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::size_t size_{};
+};
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_sequential_pairs_fixture, "create_sequential_pairs",
+    "open_address_st") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::tables::open_address_table_st<value_type, key_type,
+            extract_key>
+            table;
+        create_and_find(table);
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(create_sequential_pairs_fixture, "create_sequential_pairs",
+    "group_probing_st") {
+    STAT_BENCH_MEASURE() {
+        hash_tables::tables::group_probing_table_st<value_type, key_type,
+            extract_key>
+            table;
+        create_and_find(table);
+    };
+}
@@ -20,6 +20,7 @@
 #include <cassert>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -34,8 +35,11 @@
 #include <stat_bench/param/parameter_value_vector.h>
 
 #include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/hashes/default_hash.h"
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/group_probing_table_st.h"
 #include "hash_tables/tables/multi_open_address_table_st.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
 #include "hash_tables_test/create_random_int_vector.h"
 #include "hash_tables_test/create_random_string_vector.h"
@@ -101,6 +105,49 @@ STAT_BENCH_CASE_F(find_pairs_fixture, "find_pairs", "open_address_st") {
     };
 }
 
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(
+    find_pairs_fixture, "find_pairs", "open_address_st_robin_hood") {
+    hash_tables::tables::open_address_table_st<value_type, key_type,
+        extract_key, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>, std::allocator<value_type>,
+        hash_tables::tables::policies::robin_hood_policy>
+        table;
+    table.max_load_factor(max_load_factor_);
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        table.emplace(key, key, second_value);
+    }
+    assert(table.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            stat_bench::do_not_optimize(table.at(keys_.at(i)));
+        }
+    };
+}
+
+// NOLINTNEXTLINE
+STAT_BENCH_CASE_F(find_pairs_fixture, "find_pairs", "group_probing_st") {
+    hash_tables::tables::group_probing_table_st<value_type, key_type,
+        extract_key>
+        table;
+    table.max_load_factor(max_load_factor_);
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& key = keys_.at(i);
+        const auto& second_value = second_values_.at(i);
+        table.emplace(key, key, second_value);
+    }
+    assert(table.size() == size_);  // NOLINT
+
+    STAT_BENCH_MEASURE() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            stat_bench::do_not_optimize(table.at(keys_.at(i)));
+        }
+    };
+}
+
 // NOLINTNEXTLINE
 STAT_BENCH_CASE_F(find_pairs_fixture, "find_pairs", "multi_open_address_st") {
     hash_tables::tables::multi_open_address_table_st<value_type, key_type,
@@ -2,4 +2,5 @@ set(SOURCE_FILES
     maps/create_and_delete_many.cpp
     sets/create_and_delete_many.cpp
     tables/create_and_delete_many_pairs.cpp
+    tables/read_and_write_concurrently.cpp
 )
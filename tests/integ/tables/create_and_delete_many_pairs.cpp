@@ -18,6 +18,8 @@
  * \brief Test to create and delete many pairs in tables.
  */
 #include <cstddef>
+#include <functional>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -28,8 +30,11 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/group_probing_table_st.h"
 #include "hash_tables/tables/multi_open_address_table_mt.h"
 #include "hash_tables/tables/multi_open_address_table_st.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables/tables/open_address_table_st.h"
 #include "hash_tables/tables/separate_shared_chain_table_mt.h"
 #include "hash_tables_test/create_random_int_vector.h"
@@ -43,6 +48,12 @@ using extract_key =
 TEMPLATE_TEST_CASE("create and delete many pairs in tables", "",
     (hash_tables::tables::open_address_table_st<value_type, key_type,
         extract_key>),
+    (hash_tables::tables::open_address_table_st<value_type, key_type,
+        extract_key, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>, std::allocator<value_type>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (hash_tables::tables::group_probing_table_st<value_type, key_type,
+        extract_key>),
     (hash_tables::tables::multi_open_address_table_st<value_type, key_type,
         extract_key>),
     (hash_tables::tables::separate_shared_chain_table_mt<value_type, key_type,
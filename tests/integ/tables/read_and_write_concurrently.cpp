@@ -0,0 +1,282 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test to read and write pairs in tables concurrently.
+ */
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/hashes/default_hash.h"
+#include "hash_tables/tables/lock_policies.h"
+#include "hash_tables/tables/multi_open_address_table_mt.h"
+#include "hash_tables/tables/separate_shared_chain_table_mt.h"
+
+using key_type = int;
+using value_type = std::pair<int, std::string>;
+using extract_key =
+    hash_tables::extract_key_functions::extract_first_from_pair<value_type>;
+
+template <typename LockPolicy>
+using multi_open_address_table_mt =
+    hash_tables::tables::multi_open_address_table_mt<value_type, key_type,
+        extract_key, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>, std::allocator<value_type>,
+        hash_tables::tables::internal::
+            multi_open_address_table_mt_default_min_num_tables,
+        LockPolicy>;
+
+template <typename LockPolicy>
+using separate_shared_chain_table_mt =
+    hash_tables::tables::separate_shared_chain_table_mt<value_type, key_type,
+        extract_key, hash_tables::hashes::default_hash<key_type>,
+        std::equal_to<key_type>, std::allocator<value_type>, LockPolicy>;
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("read and write pairs in tables concurrently", "",
+    multi_open_address_table_mt<
+        hash_tables::tables::policies::mutex_lock_policy>,
+    multi_open_address_table_mt<
+        hash_tables::tables::policies::shared_mutex_lock_policy>,
+    multi_open_address_table_mt<
+        hash_tables::tables::policies::shared_spin_lock_policy>,
+    multi_open_address_table_mt<
+        hash_tables::tables::policies::spin_lock_policy>,
+    multi_open_address_table_mt<
+        hash_tables::tables::policies::adaptive_lock_policy>,
+    separate_shared_chain_table_mt<
+        hash_tables::tables::policies::mutex_lock_policy>,
+    separate_shared_chain_table_mt<
+        hash_tables::tables::policies::shared_mutex_lock_policy>,
+    separate_shared_chain_table_mt<
+        hash_tables::tables::policies::spin_lock_policy>,
+    separate_shared_chain_table_mt<
+        hash_tables::tables::policies::adaptive_lock_policy>) {
+    using table_type = TestType;
+
+    SECTION("test") {
+        constexpr int num_keys = 1000;
+        constexpr std::size_t num_readers = 4;
+        constexpr std::size_t num_writers = 2;
+        constexpr int num_repetitions = 20;
+
+        table_type table;
+        for (int key = 0; key < num_keys; key += 2) {
+            table.emplace(key, key, std::to_string(key));
+        }
+
+        std::vector<std::size_t> num_errors(num_readers, 0U);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < num_writers; ++i) {
+            threads.emplace_back([&table, i] {
+                for (int rep = 0; rep < num_repetitions; ++rep) {
+                    for (int key = 1 + static_cast<int>(i) * 2; key < num_keys;
+                         key += static_cast<int>(num_writers) * 2) {
+                        table.emplace(key, key, std::to_string(key));
+                    }
+                    for (int key = 1 + static_cast<int>(i) * 2; key < num_keys;
+                         key += static_cast<int>(num_writers) * 2) {
+                        table.erase(key);
+                    }
+                }
+            });
+        }
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            threads.emplace_back([&table, &num_errors, i] {
+                for (int rep = 0; rep < num_repetitions; ++rep) {
+                    for (int key = 0; key < num_keys; ++key) {
+                        const auto value = table.try_get(key);
+                        if (key % 2 == 0 &&
+                            (!value || value->second != std::to_string(key))) {
+                            ++num_errors[i];
+                        }
+                        if (value && value->second != std::to_string(key)) {
+                            ++num_errors[i];
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            CHECK(num_errors[i] == 0U);
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_keys / 2));
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE(
+    "read and write pairs of integers in tables concurrently", "",
+    hash_tables::tables::policies::mutex_lock_policy,
+    hash_tables::tables::policies::shared_mutex_lock_policy,
+    hash_tables::tables::policies::shared_spin_lock_policy,
+    hash_tables::tables::policies::optimistic_read_lock_policy) {
+    using int_value_type = std::pair<int, long>;
+    using table_type = hash_tables::tables::multi_open_address_table_mt<
+        int_value_type, key_type,
+        hash_tables::extract_key_functions::extract_first_from_pair<
+            int_value_type>,
+        hash_tables::hashes::default_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<int_value_type>,
+        hash_tables::tables::internal::
+            multi_open_address_table_mt_default_min_num_tables,
+        TestType>;
+
+    SECTION("test") {
+        constexpr int num_keys = 1000;
+        constexpr long generation_unit = 1000000;
+        constexpr std::size_t num_readers = 4;
+        constexpr std::size_t num_writers = 2;
+        constexpr int num_repetitions = 20;
+
+        table_type table;
+        for (int key = 0; key < num_keys; key += 2) {
+            table.emplace(key, key, key);
+        }
+
+        // Values are the key plus a multiple of generation_unit, so that
+        // broken values can be detected.
+        const auto is_valid = [](const int_value_type& value, int key) {
+            return value.first == key && value.second % generation_unit == key;
+        };
+
+        std::vector<std::size_t> num_errors(num_readers, 0U);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < num_writers; ++i) {
+            threads.emplace_back([&table, i] {
+                const int first_key = 1 + static_cast<int>(i) * 2;
+                const int key_step = static_cast<int>(num_writers) * 2;
+                for (int rep = 0; rep < num_repetitions; ++rep) {
+                    const long generation = generation_unit * rep;
+                    for (int key = first_key; key < num_keys;
+                         key += key_step) {
+                        table.emplace(key, key, key + generation);
+                    }
+                    for (int key = first_key - 1; key < num_keys;
+                         key += key_step) {
+                        table.emplace_or_assign(key, key, key + generation);
+                    }
+                    for (int key = first_key; key < num_keys;
+                         key += key_step) {
+                        table.erase(key);
+                    }
+                }
+            });
+        }
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            threads.emplace_back([&table, &num_errors, &is_valid, i] {
+                for (int rep = 0; rep < num_repetitions; ++rep) {
+                    for (int key = 0; key < num_keys; ++key) {
+                        const auto value = table.try_get(key);
+                        if (key % 2 == 0 && !value) {
+                            ++num_errors[i];
+                        }
+                        if (value && !is_valid(*value, key)) {
+                            ++num_errors[i];
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            CHECK(num_errors[i] == 0U);
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_keys / 2));
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("read the number of values in tables concurrently", "",
+    hash_tables::tables::policies::mutex_lock_policy,
+    hash_tables::tables::policies::shared_mutex_lock_policy,
+    hash_tables::tables::policies::shared_spin_lock_policy) {
+    using table_type = multi_open_address_table_mt<TestType>;
+
+    SECTION("test") {
+        constexpr int num_keys = 1000;
+        constexpr std::size_t num_readers = 2;
+        constexpr std::size_t num_writers = 2;
+        constexpr int num_repetitions = 20;
+        constexpr int num_reads = 10000;
+
+        table_type table;
+        for (int key = 0; key < num_keys; key += 2) {
+            table.emplace(key, key, std::to_string(key));
+        }
+
+        // Keys with even numbers always exist, and keys with odd numbers
+        // are inserted and erased by writers.
+        const auto is_valid = [](std::size_t size) {
+            return size >= static_cast<std::size_t>(num_keys / 2) &&
+                size <= static_cast<std::size_t>(num_keys);
+        };
+
+        std::vector<std::size_t> num_errors(num_readers, 0U);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < num_writers; ++i) {
+            threads.emplace_back([&table, i] {
+                for (int rep = 0; rep < num_repetitions; ++rep) {
+                    for (int key = 1 + static_cast<int>(i) * 2; key < num_keys;
+                         key += static_cast<int>(num_writers) * 2) {
+                        table.emplace(key, key, std::to_string(key));
+                    }
+                    for (int key = 1 + static_cast<int>(i) * 2; key < num_keys;
+                         key += static_cast<int>(num_writers) * 2) {
+                        table.erase(key);
+                    }
+                }
+            });
+        }
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            threads.emplace_back([&table, &num_errors, &is_valid, i] {
+                for (int rep = 0; rep < num_reads; ++rep) {
+                    if (!is_valid(table.size()) || table.empty()) {
+                        ++num_errors[i];
+                    }
+                    if (rep % 100 == 0 && !is_valid(table.exact_size())) {
+                        ++num_errors[i];
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < num_readers; ++i) {
+            CHECK(num_errors[i] == 0U);
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_keys / 2));
+        CHECK(table.exact_size() == static_cast<std::size_t>(num_keys / 2));
+    }
+}
@@ -1,3 +1,4 @@
 #include "maps/create_and_delete_many.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "sets/create_and_delete_many.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "tables/create_and_delete_many_pairs.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "tables/read_and_write_concurrently.cpp"  // NOLINT(bugprone-suspicious-include)
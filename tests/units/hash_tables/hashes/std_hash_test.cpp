@@ -20,6 +20,7 @@
 #include "hash_tables/hashes/std_hash.h"
 
 #include <string>
+#include <string_view>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -31,4 +32,11 @@ TEST_CASE("hash_tables::hashes::std_hash") {
         const auto hash = std_hash<std::string>();
         CHECK(hash("abc") != hash("abd"));
     }
+
+    SECTION("calculate hash numbers of views of strings") {
+        const auto hash = std_hash<std::string>();
+        const auto str = std::string("abc");
+        CHECK(hash(std::string_view(str)) == hash(str));
+        CHECK(hash(str.c_str()) == hash(str));
+    }
 }
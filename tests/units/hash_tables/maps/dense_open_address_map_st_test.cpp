@@ -0,0 +1,429 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of dense_open_address_map_st class.
+ */
+#include "hash_tables/maps/dense_open_address_map_st.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "hash_tables/exceptions.h"
+#include "hash_tables/hashes/std_hash.h"
+#include "hash_tables_test/hashes/fixed_hash.h"
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::maps::dense_open_address_map_st", "",
+    (std::tuple<hash_tables::hashes::std_hash<std::string>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>>)) {
+    using hash_tables::maps::dense_open_address_map_st;
+
+    using key_type = std::string;
+    using mapped_type = int;
+    using hash_type = std::tuple_element_t<0, TestType>;
+    using map_type =
+        dense_open_address_map_st<key_type, mapped_type, hash_type>;
+
+    SECTION("default constructor") {
+        map_type map;
+        CHECK(map.size() == 0);  // NOLINT
+        CHECK(map.empty());
+        CHECK(map.num_slots() == map_type::default_num_slots);
+        CHECK(map.uses_short_index());
+    }
+
+    SECTION("constructor with an argument") {
+        map_type map{5U};        // NOLINT
+        CHECK(map.size() == 0);  // NOLINT
+        CHECK(map.empty());
+        CHECK(map.num_slots() == 8U);  // NOLINT
+    }
+
+    SECTION("copy constructor") {
+        map_type orig;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(orig.emplace(key, mapped));
+
+        const map_type copy{orig};  // NOLINT
+        CHECK(copy.size() == 1);
+        CHECK(copy.at(key) == mapped);
+    }
+
+    SECTION("move constructor") {
+        map_type orig;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(orig.emplace(key, mapped));
+
+        const map_type copy{std::move(orig)};  // NOLINT
+        CHECK(copy.size() == 1);
+        CHECK(copy.at(key) == mapped);
+    }
+
+    SECTION("insert") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        const typename map_type::value_type value = std::make_pair(key, mapped);
+        CHECK(map.insert(value));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        CHECK_FALSE(map.insert(std::make_pair(key, mapped2)));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("emplace") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.emplace(key, mapped));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        CHECK_FALSE(map.emplace(std::string(key), mapped2));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("try_emplace") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        {
+            const auto [value, inserted] = map.try_emplace(key, mapped);
+            CHECK(inserted);
+            CHECK(value == mapped);
+        }
+        {
+            constexpr int mapped2 = 12345;
+            const auto [value, inserted] =
+                map.try_emplace(std::string(key), mapped2);
+            CHECK_FALSE(inserted);
+            CHECK(value == mapped);
+        }
+        CHECK(map.size() == 1);
+    }
+
+    SECTION("emplace_or_assign") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.emplace_or_assign(key, mapped));
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        CHECK_FALSE(map.emplace_or_assign(key, mapped2));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped2);
+    }
+
+    SECTION("assign") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK_FALSE(map.assign(key, mapped));
+        CHECK(map.empty());
+
+        CHECK(map.emplace(key, mapped));
+        constexpr int mapped2 = 12345;
+        CHECK(map.assign(key, mapped2));
+        CHECK(map.at(key) == mapped2);
+    }
+
+    SECTION("insert many values") {
+        map_type map;
+
+        constexpr int num_values = 1000;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        CHECK(map.size() == static_cast<std::size_t>(num_values));
+        CHECK(map.load_factor() <= map.max_load_factor());
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.at(std::to_string(i)) == i);
+        }
+    }
+
+    SECTION("get values") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        const auto key2 = std::to_string(mapped + 1);
+        CHECK(map.emplace(key, mapped));
+
+        CHECK(map.at(key) == mapped);
+        CHECK_THROWS_AS((void)map.at(key2), hash_tables::key_not_found);
+        const auto& const_map = map;
+        CHECK(const_map.at(key) == mapped);
+        CHECK_THROWS_AS(
+            (void)const_map.at(key2), hash_tables::key_not_found);
+
+        REQUIRE(map.try_get(key) != nullptr);
+        CHECK(*map.try_get(key) == mapped);
+        CHECK(map.try_get(key2) == nullptr);
+        REQUIRE(const_map.try_get(key) != nullptr);
+        CHECK(*const_map.try_get(key) == mapped);
+        CHECK(const_map.try_get(key2) == nullptr);
+
+        CHECK(map.has(key));
+        CHECK_FALSE(map.has(key2));
+    }
+
+    SECTION("get or create values") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.get_or_create(key, mapped) == mapped);
+        CHECK(map.get_or_create(key, mapped + 1) == mapped);
+        CHECK(map[key] == mapped);
+        CHECK(map[std::to_string(mapped + 1)] == 0);
+        CHECK(map.size() == 2);
+    }
+
+    SECTION("iterate over values in the order of insertion") {
+        map_type map;
+
+        constexpr int num_values = 100;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+
+        int expected = 0;
+        for (const auto& [key, value] : map) {
+            CHECK(key == std::to_string(expected));
+            CHECK(value == expected);
+            ++expected;
+        }
+        CHECK(expected == num_values);
+
+        std::vector<int> values;
+        map.for_all([&values](const std::string& /*key*/, int& value) {
+            values.push_back(value);
+        });
+        REQUIRE(values.size() == static_cast<std::size_t>(num_values));
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(values[static_cast<std::size_t>(i)] == i);
+        }
+    }
+
+    SECTION("erase values") {
+        map_type map;
+
+        constexpr int num_values = 100;
+        std::vector<int> expected;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+            expected.push_back(i);
+        }
+        for (int i = 0; i < num_values; i += 3) {
+            CHECK(map.erase(std::to_string(i)));
+            // The last value is moved to the position of the deleted value.
+            const auto iter = std::find(expected.begin(), expected.end(), i);
+            REQUIRE(iter != expected.end());
+            *iter = expected.back();
+            expected.pop_back();
+        }
+        CHECK_FALSE(map.erase(std::to_string(0)));
+        CHECK(map.size() == expected.size());
+
+        std::vector<int> values;
+        std::as_const(map).for_all(
+            [&values](const std::string& key, const int& value) {
+                CHECK(key == std::to_string(value));
+                values.push_back(value);
+            });
+        CHECK(values == expected);
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.has(std::to_string(i)) == (i % 3 != 0));
+        }
+
+        CHECK(map.emplace(std::to_string(0), 0));
+        CHECK((map.end() - 1)->first == std::to_string(0));
+    }
+
+    SECTION("erase many values one by one") {
+        map_type map;
+
+        constexpr int num_values = 1000;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        for (int i = 0; i < num_values; i += 2) {
+            CHECK(map.erase(std::to_string(i)));
+        }
+        CHECK(map.size() == static_cast<std::size_t>(num_values / 2));
+        for (int i = 0; i < num_values; ++i) {
+            const int* value = map.try_get(std::to_string(i));
+            if (i % 2 == 0) {
+                CHECK(value == nullptr);
+            } else {
+                REQUIRE(value != nullptr);
+                CHECK(*value == i);
+            }
+        }
+        for (int i = 1; i < num_values; i += 2) {
+            CHECK(map.erase(std::to_string(i)));
+        }
+        CHECK(map.empty());
+    }
+
+    SECTION("erase values with a condition") {
+        map_type map;
+
+        constexpr int num_values = 100;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        CHECK(map.erase_if([](const std::string& /*key*/, const int& value) {
+            return value % 2 == 0;
+        }) == static_cast<std::size_t>(num_values / 2));
+
+        int expected = 1;
+        for (const auto& [key, value] : map) {
+            CHECK(value == expected);
+            expected += 2;
+        }
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.has(std::to_string(i)) == (i % 2 != 0));
+        }
+    }
+
+    SECTION("clear") {
+        map_type map;
+
+        constexpr int num_values = 100;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        const std::size_t num_slots = map.num_slots();
+        map.clear();
+        CHECK(map.empty());
+        CHECK(map.num_slots() == num_slots);
+        CHECK_FALSE(map.has(std::to_string(1)));
+        CHECK(map.emplace(std::to_string(1), 1));
+        CHECK(map.at(std::to_string(1)) == 1);
+    }
+
+    SECTION("reserve and shrink") {
+        map_type map;
+
+        constexpr std::size_t size = 1000;
+        map.reserve(size);
+        const std::size_t num_slots = map.num_slots();
+        CHECK(static_cast<float>(size) <=
+            static_cast<float>(num_slots) * map.max_load_factor());
+
+        CHECK(map.emplace(std::to_string(1), 1));
+        map.shrink_to_fit();
+        CHECK(map.num_slots() < num_slots);
+        CHECK(map.at(std::to_string(1)) == 1);
+
+        map.rehash(num_slots);
+        CHECK(map.num_slots() == num_slots);
+        CHECK(map.at(std::to_string(1)) == 1);
+    }
+
+    SECTION("set maximum load factor") {
+        map_type map;
+
+        map.max_load_factor(0.8F);  // NOLINT
+        CHECK(map.max_load_factor() == 0.8F);
+        CHECK_THROWS_AS(map.max_load_factor(0.0F), std::invalid_argument);
+        CHECK_THROWS_AS(map.max_load_factor(1.0F), std::invalid_argument);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::maps::dense_open_address_map_st (32-bit index)") {
+    using map_type = hash_tables::maps::dense_open_address_map_st<int, int>;
+
+    map_type map;
+
+    constexpr int num_values = 40000;
+    for (int i = 0; i < num_values; ++i) {
+        REQUIRE(map.emplace(i, i));
+    }
+    CHECK_FALSE(map.uses_short_index());
+
+    CHECK(map.erase(0));
+    CHECK(map.erase(num_values - 1));
+    CHECK(map.erase_if([](const int& key, const int& /*value*/) {
+        return key % 4 != 1;
+    }) == static_cast<std::size_t>(num_values / 4 * 3 - 2));
+    for (int i = 0; i < num_values; ++i) {
+        const int* value = map.try_get(i);
+        if (i % 4 != 1) {
+            CHECK(value == nullptr);
+        } else {
+            REQUIRE(value != nullptr);
+            CHECK(*value == i);
+        }
+    }
+
+    map.shrink_to_fit();
+    CHECK(map.uses_short_index());
+    int expected = 1;
+    for (const auto& [key, value] : map) {
+        CHECK(key == expected);
+        expected += 4;
+    }
+    CHECK(expected == num_values + 1);
+}
+
+// NOLINTNEXTLINE
+TEST_CASE(
+    "hash_tables::maps::dense_open_address_map_st (heterogeneous lookup)") {
+    using map_type = hash_tables::maps::dense_open_address_map_st<std::string,
+        int, hash_tables::hashes::std_hash<std::string>, std::equal_to<>>;
+
+    map_type map;
+    CHECK(map.emplace(std::string("abc"), 1));
+
+    const std::string_view key = "abc";
+    const std::string_view key2 = "def";
+    CHECK(map.has(key));
+    CHECK_FALSE(map.has(key2));
+    REQUIRE(map.try_get(key) != nullptr);
+    CHECK(*map.try_get(key) == 1);
+    CHECK(map.erase(key));
+    CHECK(map.empty());
+}
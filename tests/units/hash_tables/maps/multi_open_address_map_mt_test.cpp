@@ -19,7 +19,10 @@
  */
 #include "hash_tables/maps/multi_open_address_map_mt.h"
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -28,6 +31,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables/tables/multi_open_address_table_mt.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
 
@@ -118,6 +122,94 @@ TEMPLATE_TEST_CASE("hash_tables::maps::multi_open_address_map_mt", "",
         CHECK(map.at(key) == mapped);
     }
 
+    SECTION("try_emplace (const reference)") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.try_emplace(key, mapped));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        CHECK_FALSE(map.try_emplace(key, mapped2));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("try_emplace (rvalue reference)") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.try_emplace(std::string(key), mapped));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        auto key_to_move = key;
+        CHECK_FALSE(map.try_emplace(std::move(key_to_move), mapped2));
+        // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved): not moved for existing keys
+        CHECK(key_to_move == key);
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("try_emplace_with_factory") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        int num_calls = 0;
+        const auto factory = [&num_calls] {
+            ++num_calls;
+            return mapped;
+        };
+        CHECK(map.try_emplace_with_factory(key, factory));
+        CHECK(num_calls == 1);
+        CHECK(map.size() == 1);
+
+        CHECK_FALSE(map.try_emplace_with_factory(key, factory));
+        CHECK(num_calls == 1);
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("update") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.emplace(key, mapped));
+
+        CHECK(map.update(key, [](int& value) { ++value; }));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped + 1);
+
+        const auto key2 = std::to_string(mapped + 1);
+        CHECK_FALSE(map.update(key2, [](int& value) { ++value; }));
+        CHECK(map.size() == 1);
+        CHECK_FALSE(map.has(key2));
+    }
+
+    SECTION("upsert") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        const auto factory = [] { return 1; };
+        const auto function = [](int& value) { ++value; };
+
+        CHECK(map.upsert(key, factory, function));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == 1);
+
+        CHECK_FALSE(map.upsert(key, factory, function));
+        CHECK_FALSE(map.upsert(key, factory, function));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == 3);
+    }
+
     SECTION("emplace_of_assign (const reference)") {
         map_type map;
 
@@ -315,8 +407,11 @@ TEMPLATE_TEST_CASE("hash_tables::maps::multi_open_address_map_mt", "",
         CHECK(map.emplace(key2, mapped2));
 
         CHECK(map.size() == 2);
+        CHECK(map.exact_size() == 2);
         CHECK_NOTHROW(map.clear());
-        CHECK(map.size() == 0);  // NOLINT
+        CHECK(map.size() == 0);        // NOLINT
+        CHECK(map.exact_size() == 0);  // NOLINT
+        CHECK(map.empty());
         CHECK_THROWS(map.at(key1));
         CHECK_THROWS(map.at(key2));
     }
@@ -434,8 +529,7 @@ TEMPLATE_TEST_CASE("hash_tables::maps::multi_open_address_map_mt", "",
 
         CHECK(map.size() == 1);
         CHECK(map.num_nodes() ==
-            hash_tables::tables::internal::
-                    multi_open_address_table_mt_default_min_num_tables *
+            map.num_tables() *
                 map_type::table_type::default_num_internal_nodes);
 
         SECTION("to larger size") {
@@ -451,8 +545,7 @@ TEMPLATE_TEST_CASE("hash_tables::maps::multi_open_address_map_mt", "",
             CHECK_NOTHROW(map.reserve(size));
             CHECK(map.size() == 1);
             CHECK(map.num_nodes() ==
-                hash_tables::tables::internal::
-                        multi_open_address_table_mt_default_min_num_tables *
+                map.num_tables() *
                     map_type::table_type::default_num_internal_nodes);
             CHECK(map.at(key) == mapped);
         }
@@ -469,4 +562,108 @@ TEMPLATE_TEST_CASE("hash_tables::maps::multi_open_address_map_mt", "",
         CHECK_NOTHROW(map.max_load_factor(0.99F));  // NOLINT
         CHECK_THROWS(map.max_load_factor(1.0F));    // NOLINT
     }
+
+    SECTION("functions with hash numbers") {
+        map_type map;
+        const auto key1 = std::string("abc");
+        const auto hash1 = map.hash()(key1);
+        const auto key2 = std::string("def");
+        const auto hash2 = map.hash()(key2);
+        constexpr int mapped1 = 123;
+        constexpr int mapped2 = 234;
+
+        CHECK(map.insert_with_hash(std::make_pair(key1, mapped1), hash1));
+        CHECK(map.emplace_with_hash(key2, hash2, mapped2));
+        CHECK_FALSE(map.emplace_with_hash(key2, hash2, mapped1));
+        CHECK(map.size() == 2);
+
+        CHECK(map.has_with_hash(key1, hash1));
+        CHECK(map.at(key2) == mapped2);
+        CHECK(map.try_get_with_hash(key2, hash2).value() == mapped2);
+
+        CHECK(map.erase_with_hash(key1, hash1));
+        CHECK_FALSE(map.has(key1));
+        CHECK(map.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE(
+    "hash_tables::maps::multi_open_address_map_mt (heterogeneous lookup)") {
+    using hash_tables::maps::multi_open_address_map_mt;
+
+    using key_type = std::string;
+    using mapped_type = int;
+    using map_type = multi_open_address_map_mt<key_type, mapped_type,
+        hash_tables::hashes::std_hash<key_type>, std::equal_to<>>;
+
+    map_type map;
+    constexpr int mapped = 123;
+    CHECK(map.emplace(std::string("abc"), mapped));
+
+    SECTION("get values") {
+        CHECK(map.at(std::string_view("abc")) == mapped);
+        CHECK_THROWS((void)map.at(std::string_view("def")));
+    }
+
+    SECTION("get values constructing it if not found") {
+        constexpr int another_mapped = 234;
+        CHECK(map.get_or_create(std::string_view("abc"), another_mapped) ==
+            mapped);
+        CHECK(map.get_or_create(std::string_view("def"), another_mapped) ==
+            another_mapped);
+        CHECK(map.size() == 2);
+        CHECK(map.at(std::string("def")) == another_mapped);
+    }
+
+    SECTION("get values if found") {
+        CHECK(map.try_get(std::string_view("abc")) == mapped);
+        CHECK_FALSE(map.try_get(std::string_view("def")));
+    }
+
+    SECTION("check whether keys exist") {
+        CHECK(map.has(std::string_view("abc")));
+        CHECK(map.has("abc"));
+        CHECK_FALSE(map.has(std::string_view("def")));
+    }
+
+    SECTION("erase values") {
+        CHECK_FALSE(map.erase(std::string_view("def")));
+        CHECK(map.erase(std::string_view("abc")));
+        CHECK(map.empty());
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::maps::multi_open_address_map_mt (optimistic reads)") {
+    using hash_tables::maps::multi_open_address_map_mt;
+
+    using key_type = int;
+    using mapped_type = int;
+    using map_type = multi_open_address_map_mt<key_type, mapped_type,
+        hash_tables::hashes::std_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>,
+        hash_tables::tables::policies::optimistic_read_lock_policy>;
+
+    map_type map;
+    constexpr int size = 100;
+    for (int key = 0; key < size; ++key) {
+        CHECK(map.emplace(key, key * 3));
+    }
+
+    SECTION("get values") {
+        CHECK(map.at(2) == 6);  // NOLINT
+        CHECK_THROWS((void)map.at(size));
+        CHECK(map.try_get(4) == 12);  // NOLINT
+        CHECK_FALSE(map.try_get(size));
+        CHECK(map.has(size - 1));
+        CHECK_FALSE(map.has(size));
+    }
+
+    SECTION("update values") {
+        CHECK_FALSE(map.emplace_or_assign(2, 7));  // NOLINT
+        CHECK(map.at(2) == 7);                     // NOLINT
+        CHECK(map.erase(2));
+        CHECK_FALSE(map.has(2));
+    }
 }
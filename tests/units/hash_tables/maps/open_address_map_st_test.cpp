@@ -19,7 +19,13 @@
  */
 #include "hash_tables/maps/open_address_map_st.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -28,18 +34,36 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
-    (std::tuple<hash_tables::hashes::std_hash<std::string>>),
-    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>>)) {
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::small_table_policy<>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::small_table_policy<4>>),
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::separate_values_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::separate_values_policy>)) {
     using hash_tables::maps::open_address_map_st;
 
     using key_type = std::string;
     using mapped_type = int;
     using hash_type = std::tuple_element_t<0, TestType>;
-    using map_type = open_address_map_st<key_type, mapped_type, hash_type>;
+    using policy_type = std::tuple_element_t<1, TestType>;
+    using map_type = open_address_map_st<key_type, mapped_type, hash_type,
+        std::equal_to<key_type>,
+        std::allocator<std::pair<key_type, mapped_type>>, policy_type>;
 
     SECTION("default constructor") {
         map_type map;
@@ -164,6 +188,112 @@ TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
         CHECK(map.at(key) == mapped);
     }
 
+    SECTION("try_emplace (const reference)") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        {
+            const auto [value, inserted] = map.try_emplace(key, mapped);
+            CHECK(inserted);
+            CHECK(value == mapped);
+        }
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        {
+            const auto [value, inserted] = map.try_emplace(key, mapped2);
+            CHECK_FALSE(inserted);
+            CHECK(value == mapped);
+        }
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("try_emplace (rvalue reference)") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.try_emplace(std::string(key), mapped).second);
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+
+        constexpr int mapped2 = 12345;
+        auto key_to_move = key;
+        CHECK_FALSE(map.try_emplace(std::move(key_to_move), mapped2).second);
+        // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved): not moved for existing keys
+        CHECK(key_to_move == key);
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("try_emplace_with_factory") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        int num_calls = 0;
+        const auto factory = [&num_calls] {
+            ++num_calls;
+            return mapped;
+        };
+        {
+            const auto [value, inserted] =
+                map.try_emplace_with_factory(key, factory);
+            CHECK(inserted);
+            CHECK(value == mapped);
+        }
+        CHECK(num_calls == 1);
+        CHECK(map.size() == 1);
+
+        {
+            const auto [value, inserted] =
+                map.try_emplace_with_factory(key, factory);
+            CHECK_FALSE(inserted);
+            CHECK(value == mapped);
+        }
+        CHECK(num_calls == 1);
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("update") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.emplace(key, mapped));
+
+        CHECK(map.update(key, [](int& value) { ++value; }));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == mapped + 1);
+
+        const auto key2 = std::to_string(mapped + 1);
+        CHECK_FALSE(map.update(key2, [](int& value) { ++value; }));
+        CHECK(map.size() == 1);
+        CHECK_FALSE(map.has(key2));
+    }
+
+    SECTION("upsert") {
+        map_type map;
+
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        const auto factory = [] { return 1; };
+        const auto function = [](int& value) { ++value; };
+
+        CHECK(map.upsert(key, factory, function));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == 1);
+
+        CHECK_FALSE(map.upsert(key, factory, function));
+        CHECK_FALSE(map.upsert(key, factory, function));
+        CHECK(map.size() == 1);
+        CHECK(map.at(key) == 3);
+    }
+
     SECTION("emplace_of_assign (const reference)") {
         map_type map;
 
@@ -356,6 +486,58 @@ TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
         CHECK_FALSE(const_map.has(key2));
     }
 
+    SECTION("find_batch") {
+        map_type map;
+        constexpr int num_keys = 40;
+        for (int i = 0; i < num_keys; i += 2) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        std::vector<key_type> keys;
+        for (int i = 0; i < num_keys; ++i) {
+            keys.push_back(std::to_string(i));
+        }
+
+        std::vector<mapped_type*> outputs(keys.size());
+        map.find_batch(keys, outputs);
+        for (int i = 0; i < num_keys; ++i) {
+            INFO("key = " << i);
+            if (i % 2 == 0) {
+                REQUIRE(static_cast<const void*>(outputs[i]) != nullptr);
+                CHECK(*outputs[i] == i);
+            } else {
+                CHECK(static_cast<const void*>(outputs[i]) == nullptr);
+            }
+        }
+
+        const auto& const_map = map;
+        std::vector<const mapped_type*> const_outputs(keys.size());
+        const_map.find_batch(keys, const_outputs);
+        for (int i = 0; i < num_keys; ++i) {
+            INFO("key = " << i);
+            CHECK(static_cast<const void*>(const_outputs[i]) ==
+                static_cast<const void*>(const_map.try_get(keys[i])));
+        }
+    }
+
+    SECTION("has_batch") {
+        map_type map;
+        constexpr int num_keys = 40;
+        for (int i = 0; i < num_keys; i += 2) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        std::vector<key_type> keys;
+        for (int i = 0; i < num_keys; ++i) {
+            keys.push_back(std::to_string(i));
+        }
+
+        std::vector<bool> outputs(keys.size());
+        map.has_batch(keys, outputs);
+        for (int i = 0; i < num_keys; ++i) {
+            INFO("key = " << i);
+            CHECK(outputs[i] == (i % 2 == 0));
+        }
+    }
+
     SECTION("for_all (non const)") {
         map_type map;
 
@@ -394,6 +576,116 @@ TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
         CHECK(keys == std::unordered_set<key_type>{key1, key2});
     }
 
+    SECTION("iterators") {
+        map_type map;
+        CHECK(map.begin() == map.end());
+
+        constexpr int mapped1 = 123;
+        const auto key1 = std::to_string(mapped1);
+        CHECK(map.emplace(key1, mapped1));
+        constexpr int mapped2 = 12345;
+        const auto key2 = std::to_string(mapped2);
+        CHECK(map.emplace(key2, mapped2));
+
+        std::unordered_set<key_type> keys;
+        for (auto& [key, mapped] : map) {
+            CHECK(keys.insert(key).second);
+            CHECK(key == std::to_string(mapped));
+            ++mapped;
+        }
+        CHECK(keys == std::unordered_set<key_type>{key1, key2});
+        CHECK(map.at(key1) == mapped1 + 1);
+
+        const auto& const_map = map;
+        CHECK(std::distance(const_map.begin(), const_map.end()) == 2);
+        const auto iter = std::find_if(map.cbegin(), map.cend(),
+            [&key2](const auto& pair) { return pair.first == key2; });
+        REQUIRE(iter != map.cend());
+        CHECK(iter->second == mapped2 + 1);
+    }
+
+    SECTION("scan") {
+        map_type map;
+
+        constexpr int num_pairs = 50;
+        for (int i = 0; i < num_pairs; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+
+        std::unordered_set<key_type> keys;
+        std::size_t cursor = 0;
+        do {
+            std::size_t num_visited = 0;
+            cursor = map.scan(cursor, 7,  // NOLINT
+                [&](const key_type& key, mapped_type& mapped) {
+                    CHECK(keys.insert(key).second);
+                    CHECK(key == std::to_string(mapped));
+                    ++num_visited;
+                });
+            CHECK(num_visited <= 7);  // NOLINT
+        } while (cursor != 0);
+        CHECK(keys.size() == static_cast<std::size_t>(num_pairs));
+
+        const auto& const_map = map;
+        std::size_t num_visited = 0;
+        CHECK(const_map.scan(0, 100,
+                  [&](const key_type& /*key*/, const mapped_type& /*mapped*/) {
+                      ++num_visited;
+                  }) == 0);
+        CHECK(num_visited == static_cast<std::size_t>(num_pairs));
+    }
+
+    SECTION("extract and insert") {
+        map_type map;
+        CHECK(map.emplace("abc", 1));
+        CHECK(map.emplace("bcd", 2));
+
+        auto node = map.extract("abc");
+        REQUIRE_FALSE(node.empty());
+        CHECK(node.value().first == "abc");
+        CHECK(node.value().second == 1);
+        CHECK_FALSE(map.has("abc"));
+        CHECK(map.extract("abc").empty());
+
+        map_type other;
+        CHECK(other.insert(std::move(node)));
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(other.at("abc") == 1);
+
+        auto duplicate = map.extract("bcd");
+        CHECK(other.emplace("bcd", 3));
+        CHECK_FALSE(other.insert(std::move(duplicate)));
+        CHECK(duplicate.value().second == 2);  // NOLINT(bugprone-use-after-move)
+        CHECK(other.at("bcd") == 3);
+    }
+
+    SECTION("merge") {
+        map_type map;
+        map_type other;
+        constexpr int num_pairs = 60;
+        constexpr int first_other = 20;
+        constexpr int last_map = 40;
+        for (int i = 0; i < last_map; ++i) {
+            CHECK(map.emplace(std::to_string(i), i));
+        }
+        for (int i = first_other; i < num_pairs; ++i) {
+            CHECK(other.emplace(std::to_string(i), -i));
+        }
+
+        map.merge(other);
+        CHECK(map.size() == static_cast<std::size_t>(num_pairs));
+        CHECK(other.size() == static_cast<std::size_t>(last_map - first_other));
+        for (int i = 0; i < num_pairs; ++i) {
+            INFO("i = " << i);
+            CHECK(map.at(std::to_string(i)) == (i < last_map ? i : -i));
+            CHECK(other.has(std::to_string(i)) ==
+                (first_other <= i && i < last_map));
+        }
+
+        map.merge(map_type(other));
+        CHECK(map.size() == static_cast<std::size_t>(num_pairs));
+    }
+
     SECTION("clear") {
         map_type map;
 
@@ -542,6 +834,30 @@ TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
         }
     }
 
+    SECTION("shrink_to_fit") {
+        map_type map;
+        constexpr std::size_t size = 100;
+        map.reserve(size);
+        CHECK(map.num_nodes() > size);
+        constexpr int mapped = 123;
+        const auto key = std::to_string(mapped);
+        CHECK(map.emplace(key, mapped));
+
+        CHECK_NOTHROW(map.shrink_to_fit());
+        CHECK(map.size() == 1);
+        CHECK(map.num_nodes() == map_type::table_type::default_num_nodes);
+        CHECK(map.at(key) == mapped);
+    }
+
+    SECTION("min_load_factor") {
+        map_type map;
+
+        constexpr float value = 0.1F;
+        CHECK_NOTHROW(map.min_load_factor(value));
+        CHECK(map.min_load_factor() == value);
+        CHECK_THROWS(map.min_load_factor(0.4F));  // NOLINT
+    }
+
     SECTION("rehash") {
         map_type map;
 
@@ -607,4 +923,83 @@ TEMPLATE_TEST_CASE("hash_tables::maps::open_address_map_st", "",
         CHECK_NOTHROW(map.max_load_factor(0.99F));  // NOLINT
         CHECK_THROWS(map.max_load_factor(1.0F));    // NOLINT
     }
+
+    SECTION("functions with hash numbers") {
+        map_type map;
+        const auto key1 = std::string("abc");
+        const auto hash1 = map.hash()(key1);
+        const auto key2 = std::string("def");
+        const auto hash2 = map.hash()(key2);
+        constexpr int mapped1 = 123;
+        constexpr int mapped2 = 234;
+
+        CHECK(map.insert_with_hash(std::make_pair(key1, mapped1), hash1));
+        CHECK(map.emplace_with_hash(key2, hash2, mapped2));
+        CHECK_FALSE(map.emplace_with_hash(key2, hash2, mapped1));
+        CHECK(map.size() == 2);
+
+        CHECK(map.has_with_hash(key1, hash1));
+        CHECK(map.at(key2) == mapped2);
+        const mapped_type* res = map.try_get_with_hash(key2, hash2);
+        REQUIRE(static_cast<const void*>(res) != nullptr);
+        CHECK(*res == mapped2);
+
+        CHECK(map.erase_with_hash(key1, hash1));
+        CHECK_FALSE(map.has(key1));
+        CHECK(map.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE(
+    "hash_tables::maps::open_address_map_st (heterogeneous lookup)", "",
+    hash_tables::tables::policies::default_open_address_policy,
+    hash_tables::tables::policies::robin_hood_policy,
+    hash_tables::tables::policies::small_table_policy<>,
+    hash_tables::tables::policies::separate_values_policy) {
+    using hash_tables::maps::open_address_map_st;
+
+    using key_type = std::string;
+    using mapped_type = int;
+    using map_type = open_address_map_st<key_type, mapped_type,
+        hash_tables::hashes::std_hash<key_type>, std::equal_to<>,
+        std::allocator<std::pair<key_type, mapped_type>>, TestType>;
+
+    map_type map;
+    constexpr int mapped = 123;
+    CHECK(map.emplace(std::string("abc"), mapped));
+
+    SECTION("get values") {
+        CHECK(map.at(std::string_view("abc")) == mapped);
+        CHECK(std::as_const(map).at(std::string_view("abc")) == mapped);
+        CHECK_THROWS((void)map.at(std::string_view("def")));
+    }
+
+    SECTION("get values constructing it if not found") {
+        constexpr int another_mapped = 234;
+        CHECK(map.get_or_create(std::string_view("abc"), another_mapped) ==
+            mapped);
+        CHECK(map.get_or_create(std::string_view("def"), another_mapped) ==
+            another_mapped);
+        CHECK(map.size() == 2);
+        CHECK(map.at(std::string("def")) == another_mapped);
+    }
+
+    SECTION("get values if found") {
+        CHECK(map.try_get(std::string_view("abc")) != nullptr);
+        CHECK(std::as_const(map).try_get(std::string_view("abc")) != nullptr);
+        CHECK(map.try_get(std::string_view("def")) == nullptr);
+    }
+
+    SECTION("check whether keys exist") {
+        CHECK(map.has(std::string_view("abc")));
+        CHECK(map.has("abc"));
+        CHECK_FALSE(map.has(std::string_view("def")));
+    }
+
+    SECTION("erase values") {
+        CHECK_FALSE(map.erase(std::string_view("def")));
+        CHECK(map.erase(std::string_view("abc")));
+        CHECK(map.empty());
+    }
 }
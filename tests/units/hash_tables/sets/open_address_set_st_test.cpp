@@ -19,7 +19,12 @@
  */
 #include "hash_tables/sets/open_address_set_st.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_set>
 #include <utility>
@@ -29,17 +34,30 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/open_address_policies.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::sets::open_address_set_st", "",
-    (std::tuple<hash_tables::hashes::std_hash<std::string>>),
-    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>>)) {
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<std::string>,
+        hash_tables::tables::policies::small_table_policy<>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<std::string>,
+        hash_tables::tables::policies::small_table_policy<4>>)) {
     using hash_tables::sets::open_address_set_st;
 
     using key_type = std::string;
     using hash_type = std::tuple_element_t<0, TestType>;
-    using set_type = open_address_set_st<key_type, hash_type>;
+    using policy_type = std::tuple_element_t<1, TestType>;
+    using set_type = open_address_set_st<key_type, hash_type,
+        std::equal_to<key_type>, std::allocator<key_type>, policy_type>;
 
     SECTION("default constructor") {
         set_type set;
@@ -145,6 +163,55 @@ TEMPLATE_TEST_CASE("hash_tables::sets::open_address_set_st", "",
         CHECK(keys == std::unordered_set<key_type>{key1, key2});
     }
 
+    SECTION("iterators") {
+        set_type set;
+        CHECK(set.begin() == set.end());
+
+        const auto key1 = std::string("abc");
+        CHECK(set.insert(key1));
+        const auto key2 = std::string("def");
+        CHECK(set.insert(key2));
+
+        const std::unordered_set<key_type> keys(set.begin(), set.end());
+        CHECK(keys == std::unordered_set<key_type>{key1, key2});
+        CHECK(std::count(set.cbegin(), set.cend(), key2) == 1);
+    }
+
+    SECTION("scan") {
+        set_type set;
+
+        constexpr int num_keys = 50;
+        for (int i = 0; i < num_keys; ++i) {
+            CHECK(set.insert(std::to_string(i)));
+        }
+
+        std::unordered_set<key_type> keys;
+        std::size_t cursor = 0;
+        do {
+            cursor = set.scan(cursor, 7,  // NOLINT
+                [&keys](const key_type& key) {
+                    CHECK(keys.insert(key).second);
+                });
+        } while (cursor != 0);
+        CHECK(keys.size() == static_cast<std::size_t>(num_keys));
+    }
+
+    SECTION("extract and insert") {
+        set_type set;
+        CHECK(set.insert(std::string("abc")));
+
+        auto node = set.extract("abc");
+        REQUIRE_FALSE(node.empty());
+        CHECK(node.value() == "abc");
+        CHECK_FALSE(set.has("abc"));
+        CHECK(set.extract("abc").empty());
+
+        set_type other;
+        CHECK(other.insert(std::move(node)));
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(other.has("abc"));
+    }
+
     SECTION("clear") {
         set_type set;
 
@@ -253,6 +320,22 @@ TEMPLATE_TEST_CASE("hash_tables::sets::open_address_set_st", "",
         CHECK(set1.has("ghi"));
     }
 
+    SECTION("merge moving values") {
+        set_type set1;
+        set_type set2;
+        set1.insert("abc");
+        set1.insert("def");
+        set2.insert("def");
+        set2.insert("ghi");
+
+        set1.merge(std::move(set2));
+
+        CHECK(set1.size() == 3U);
+        CHECK(set1.has("abc"));
+        CHECK(set1.has("def"));
+        CHECK(set1.has("ghi"));
+    }
+
     SECTION("operator+=") {
         set_type set1;
         set_type set2;
@@ -383,6 +466,29 @@ TEMPLATE_TEST_CASE("hash_tables::sets::open_address_set_st", "",
         }
     }
 
+    SECTION("shrink_to_fit") {
+        set_type set;
+        constexpr std::size_t size = 100;
+        set.reserve(size);
+        CHECK(set.num_nodes() > size);
+        const auto key = std::string("abc");
+        CHECK(set.insert(key));
+
+        CHECK_NOTHROW(set.shrink_to_fit());
+        CHECK(set.size() == 1);
+        CHECK(set.num_nodes() == set_type::table_type::default_num_nodes);
+        CHECK(set.has(key));
+    }
+
+    SECTION("min_load_factor") {
+        set_type set;
+
+        constexpr float value = 0.1F;
+        CHECK_NOTHROW(set.min_load_factor(value));
+        CHECK(set.min_load_factor() == value);
+        CHECK_THROWS(set.min_load_factor(0.4F));  // NOLINT
+    }
+
     SECTION("rehash") {
         set_type set;
 
@@ -447,4 +553,53 @@ TEMPLATE_TEST_CASE("hash_tables::sets::open_address_set_st", "",
         CHECK_NOTHROW(set.max_load_factor(0.99F));  // NOLINT
         CHECK_THROWS(set.max_load_factor(1.0F));    // NOLINT
     }
+
+    SECTION("functions with hash numbers") {
+        set_type set;
+        const auto key1 = std::string("abc");
+        const auto hash1 = set.hash()(key1);
+        const auto key2 = std::string("def");
+        const auto hash2 = set.hash()(key2);
+
+        CHECK(set.insert_with_hash(key1, hash1));
+        CHECK_FALSE(set.insert_with_hash(key1, hash1));
+        CHECK(set.insert_with_hash(std::string(key2), hash2));
+        CHECK(set.size() == 2);
+
+        CHECK(set.has_with_hash(key1, hash1));
+        CHECK(set.has(key2));
+
+        CHECK(set.erase_with_hash(key1, hash1));
+        CHECK_FALSE(set.has_with_hash(key1, hash1));
+        CHECK(set.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE(
+    "hash_tables::sets::open_address_set_st (heterogeneous lookup)", "",
+    hash_tables::tables::policies::default_open_address_policy,
+    hash_tables::tables::policies::robin_hood_policy,
+    hash_tables::tables::policies::small_table_policy<>) {
+    using hash_tables::sets::open_address_set_st;
+
+    using key_type = std::string;
+    using set_type = open_address_set_st<key_type,
+        hash_tables::hashes::std_hash<key_type>, std::equal_to<>,
+        std::allocator<key_type>, TestType>;
+
+    set_type set;
+    CHECK(set.insert(std::string("abc")));
+
+    SECTION("check whether keys exist") {
+        CHECK(set.has(std::string_view("abc")));
+        CHECK(set.has("abc"));
+        CHECK_FALSE(set.has(std::string_view("def")));
+    }
+
+    SECTION("erase keys") {
+        CHECK_FALSE(set.erase(std::string_view("def")));
+        CHECK(set.erase(std::string_view("abc")));
+        CHECK(set.empty());
+    }
 }
@@ -0,0 +1,917 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of group_probing_table_st class.
+ */
+#include "hash_tables/tables/group_probing_table_st.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/extract_key_functions/identity.h"
+#include "hash_tables/hashes/std_hash.h"
+#include "hash_tables_test/extract_key_functions/extract_first_element.h"
+#include "hash_tables_test/hashes/fixed_hash.h"
+
+namespace {
+
+/*!
+ * \brief Function to check whether integers are equal counting comparisons.
+ */
+struct counting_equal_to {
+    //! Number of comparisons.
+    std::size_t* num_comparisons;
+
+    /*!
+     * \brief Check whether integers are equal.
+     *
+     * \param[in] left Left-hand-side integer.
+     * \param[in] right Right-hand-side integer.
+     * \return Whether integers are equal.
+     */
+    auto operator()(int left, int right) const -> bool {
+        ++(*num_comparisons);
+        return left == right;
+    }
+};
+
+/*!
+ * \brief Hash function which may throw when moved.
+ */
+struct throwing_move_hash {
+    throwing_move_hash() = default;
+    throwing_move_hash(const throwing_move_hash&) = default;
+    throwing_move_hash(throwing_move_hash&& /*obj*/) noexcept(false) {}
+    auto operator=(const throwing_move_hash&) -> throwing_move_hash& = default;
+    // NOLINTNEXTLINE(performance-noexcept-move-constructor)
+    auto operator=(throwing_move_hash&& /*obj*/) noexcept(false)
+        -> throwing_move_hash& {
+        return *this;
+    }
+    ~throwing_move_hash() = default;
+
+    /*!
+     * \brief Calculate the hash number.
+     *
+     * \param[in] key Key.
+     * \return Hash number.
+     */
+    auto operator()(int key) const -> std::size_t {
+        return static_cast<std::size_t>(key);
+    }
+};
+
+}  // namespace
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::group_probing_table_st", "",
+    (std::tuple<hash_tables::hashes::std_hash<char>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>>)) {
+    using hash_tables::tables::group_probing_table_st;
+
+    using key_type = char;
+    using value_type = std::string;
+    using extract_key_type =
+        hash_tables_test::extract_key_functions::extract_first_element<
+            value_type>;
+    using hash_type = std::tuple_element_t<0, TestType>;
+    using table_type = group_probing_table_st<value_type, key_type,
+        extract_key_type, hash_type>;
+
+    SECTION("default constructor") {
+        table_type table;
+        CHECK(table.size() == 0);  // NOLINT
+        CHECK(table.empty());
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+    }
+
+    SECTION("copy constructor") {
+        table_type orig;
+        const auto value = std::string("abc");
+        orig.insert(value);
+
+        table_type copy{orig};  // NOLINT
+        CHECK(copy.at(extract_key_type()(value)) == value);
+    }
+
+    SECTION("move constructor") {
+        table_type orig;
+        const auto value = std::string("abc");
+        orig.insert(value);
+
+        table_type copy{std::move(orig)};  // NOLINT
+        CHECK(copy.at(extract_key_type()(value)) == value);
+    }
+
+    SECTION("copy assignment operator") {
+        table_type orig;
+        const auto value = std::string("abc");
+        orig.insert(value);
+
+        table_type copy;
+        copy = orig;  // NOLINT
+        CHECK(copy.at(extract_key_type()(value)) == value);
+    }
+
+    SECTION("move assignment operator") {
+        table_type orig;
+        const auto value = std::string("abc");
+        orig.insert(value);
+
+        table_type copy;
+        copy = std::move(orig);  // NOLINT
+        CHECK(copy.at(extract_key_type()(value)) == value);
+    }
+
+    SECTION("insert (const reference)") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value = std::string("abc");
+            const char key = extract_key_type()(value);
+            CHECK(table.insert(value));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("multiple") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.insert(value1));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.insert(value2));
+            CHECK(table.size() == 2);
+            CHECK(table.at(key2) == value2);
+        }
+
+        SECTION("duplicate") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.insert(value1));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("ab");
+            CHECK_FALSE(table.insert(value2));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+        }
+    }
+
+    SECTION("insert (rvalue reference)") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value = std::string("abc");
+            const char key = extract_key_type()(value);
+            CHECK(table.insert(std::string(value)));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("multiple") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.insert(std::string(value1)));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.insert(std::string(value2)));
+            CHECK(table.size() == 2);
+            CHECK(table.at(key2) == value2);
+        }
+
+        SECTION("duplicate") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.insert(std::string(value1)));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("ab");
+            CHECK_FALSE(table.insert(std::string(value2)));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+        }
+    }
+
+    SECTION("emplace") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value = std::string("abc");
+            const char key = extract_key_type()(value);
+            CHECK(table.emplace(key, value.c_str()));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("multiple") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.emplace(key1, value1.c_str()));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.emplace(key2, value2.c_str()));
+            CHECK(table.size() == 2);
+            CHECK(table.at(key2) == value2);
+        }
+
+        SECTION("duplicate") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.emplace(key1, value1));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("ab");
+            CHECK_FALSE(table.emplace(key1, value2));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+        }
+    }
+
+    SECTION("update") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        const auto function = [](std::string& value) { value += "x"; };
+        CHECK(table.emplace(key1, value1));
+
+        CHECK(table.update(key1, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+
+        CHECK_FALSE(table.update(key2, function));
+        CHECK(table.size() == 1);
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("upsert") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto factory = [&value1] { return value1; };
+        const auto function = [](std::string& value) { value += "x"; };
+
+        CHECK(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == value1);
+
+        CHECK_FALSE(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+    }
+
+    SECTION("emplace_or_assign") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value = std::string("abc");
+            const char key = extract_key_type()(value);
+            CHECK(table.emplace_or_assign(key, value.c_str()));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("multiple") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.emplace_or_assign(key1, value1.c_str()));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.emplace_or_assign(key2, value2.c_str()));
+            CHECK(table.size() == 2);
+            CHECK(table.at(key2) == value2);
+        }
+
+        SECTION("duplicate") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.emplace_or_assign(key1, value1));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("ab");
+            CHECK_FALSE(table.emplace_or_assign(key1, value2));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value2);
+        }
+    }
+
+    SECTION("assign") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.emplace(key1, value1));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value1);
+
+            const auto value2 = std::string("ab");
+            CHECK(table.assign(key1, value2));
+            CHECK(table.size() == 1);
+            CHECK(table.at(key1) == value2);
+        }
+
+        SECTION("non-existing key") {
+            table_type table;
+
+            const auto value = std::string("abc");
+            const char key = extract_key_type()(value);
+            CHECK_FALSE(table.assign(key, value.c_str()));
+            CHECK(table.size() == 0);  // NOLINT
+            CHECK_THROWS(table.at(key));
+        }
+    }
+
+    // cSpell:ignore bcdef
+
+    SECTION("at (non const)") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+        CHECK_NOTHROW(table.emplace(key2, value2));
+
+        CHECK(table.at(key1) == value1);
+        CHECK(table.at(key2) == value2);
+    }
+
+    SECTION("at (const)") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+        CHECK_NOTHROW(table.emplace(key2, value2));
+
+        const auto& const_table = table;
+        CHECK(const_table.at(key1) == value1);
+        CHECK(const_table.at(key2) == value2);
+    }
+
+    SECTION("get_or_create") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+        CHECK(table.size() == 1);
+
+        CHECK(table.get_or_create(key1, "af") == value1);
+        CHECK(table.size() == 1);
+        CHECK(table.get_or_create(key2, value2.c_str()) == value2);
+        CHECK(table.size() == 2);
+    }
+
+    SECTION("get_or_create_with_factory") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+        CHECK(table.size() == 1);
+
+        CHECK(table.get_or_create_with_factory(
+                  key1, [] { return std::string("af"); }) == value1);
+        CHECK(table.size() == 1);
+        CHECK(table.get_or_create_with_factory(
+                  key2, [&value2] { return std::string(value2); }) == value2);
+        CHECK(table.size() == 2);
+    }
+
+    SECTION("try_get (non const)") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+
+        std::string* res1 = table.try_get(key1);
+        REQUIRE(static_cast<const void*>(res1) != nullptr);
+        CHECK(*res1 == value1);
+        std::string* res2 = table.try_get(key2);
+        CHECK(static_cast<const void*>(res2) == nullptr);
+    }
+
+    SECTION("try_get (const)") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+
+        const auto& const_table = table;
+        const std::string* res1 = const_table.try_get(key1);
+        REQUIRE(static_cast<const void*>(res1) != nullptr);
+        CHECK(*res1 == value1);
+        const std::string* res2 = const_table.try_get(key2);
+        CHECK(static_cast<const void*>(res2) == nullptr);
+    }
+
+    SECTION("has") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK_NOTHROW(table.emplace(key1, value1));
+
+        CHECK(table.has(key1));
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("for_all (non const)") {
+        table_type table;
+
+        const auto value1 = std::string("abc");
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        CHECK(table.insert(value2));
+
+        std::unordered_set<std::string> args;
+        table.for_all([&args](std::string& val) {
+            INFO(val);
+            const auto res = args.insert(val);
+            CHECK(res.second);
+        });
+        CHECK(args == std::unordered_set<std::string>{value1, value2});
+    }
+
+    SECTION("for_all (const)") {
+        table_type table;
+
+        const auto value1 = std::string("abc");
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        CHECK(table.insert(value2));
+
+        const auto& const_table = table;
+        std::unordered_set<std::string> args;
+        const_table.for_all([&args](const std::string& val) {
+            INFO(val);
+            const auto res = args.insert(val);
+            CHECK(res.second);
+        });
+        CHECK(args == std::unordered_set<std::string>{value1, value2});
+    }
+
+    SECTION("clear") {
+        table_type table;
+
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        CHECK(table.insert(value2));
+
+        CHECK(table.has(key1));
+        CHECK(table.has(key2));
+        CHECK(table.size() == 2);
+
+        CHECK_NOTHROW(table.clear());
+
+        CHECK_FALSE(table.has(key1));
+        CHECK_FALSE(table.has(key2));
+        CHECK(table.size() == 0);  // NOLINT
+    }
+
+    SECTION("erase") {
+        SECTION("successful") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            CHECK(table.insert(value1));
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.insert(value2));
+
+            CHECK(table.has(key1));
+            CHECK(table.has(key2));
+            CHECK(table.size() == 2);
+
+            CHECK(table.erase(key1));
+
+            CHECK_FALSE(table.has(key1));
+            CHECK(table.has(key2));
+            CHECK(table.size() == 1);
+        }
+
+        SECTION("key not found") {
+            table_type table;
+
+            const auto value1 = std::string("abc");
+            const char key1 = extract_key_type()(value1);
+            const auto value2 = std::string("bcd");
+            const char key2 = extract_key_type()(value2);
+            CHECK(table.insert(value2));
+
+            CHECK_FALSE(table.has(key1));
+            CHECK(table.has(key2));
+            CHECK(table.size() == 1);
+
+            CHECK_FALSE(table.erase(key1));
+
+            CHECK_FALSE(table.has(key1));
+            CHECK(table.has(key2));
+            CHECK(table.size() == 1);
+        }
+    }
+
+    SECTION("erase_if") {
+        table_type table;
+
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        CHECK(table.insert(value2));
+
+        CHECK(table.has(key1));
+        CHECK(table.has(key2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.erase_if([&value1](const std::string& val) {
+            return val == value1;
+        }) == 1);
+
+        CHECK_FALSE(table.has(key1));
+        CHECK(table.has(key2));
+        CHECK(table.size() == 1);
+    }
+
+    SECTION("check_all_satisfy") {
+        table_type table;
+        CHECK(table.insert("abc"));
+        CHECK(table.insert("bcd"));
+
+        CHECK(table.check_all_satisfy(
+            [](const std::string& val) { return !val.empty(); }));
+        CHECK_FALSE(table.check_all_satisfy(
+            [](const std::string& val) { return val == "abc"; }));
+        CHECK_FALSE(table.check_all_satisfy(
+            [](const std::string& val) { return val.empty(); }));
+    }
+
+    SECTION("check_any_satisfy") {
+        table_type table;
+        CHECK(table.insert("abc"));
+        CHECK(table.insert("bcd"));
+
+        CHECK(table.check_any_satisfy(
+            [](const std::string& val) { return !val.empty(); }));
+        CHECK(table.check_any_satisfy(
+            [](const std::string& val) { return val == "abc"; }));
+        CHECK_FALSE(table.check_any_satisfy(
+            [](const std::string& val) { return val.empty(); }));
+    }
+
+    SECTION("check_none_satisfy") {
+        table_type table;
+        CHECK(table.insert("abc"));
+        CHECK(table.insert("bcd"));
+
+        CHECK_FALSE(table.check_none_satisfy(
+            [](const std::string& val) { return !val.empty(); }));
+        CHECK_FALSE(table.check_none_satisfy(
+            [](const std::string& val) { return val == "abc"; }));
+        CHECK(table.check_none_satisfy(
+            [](const std::string& val) { return val.empty(); }));
+    }
+
+    SECTION("max_size") {
+        table_type table;
+
+        CHECK(table.max_size() > 0U);
+    }
+
+    SECTION("reserve") {
+        table_type table;
+
+        const auto value = std::string("abc");
+        const char key = extract_key_type()(value);
+        CHECK(table.insert(value));
+        CHECK(table.at(key) == value);
+
+        CHECK(table.size() == 1);
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+
+        SECTION("to larger size") {
+            constexpr std::size_t size = 128;
+            CHECK_NOTHROW(table.reserve(size));
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() > size);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("to smaller size") {
+            constexpr std::size_t size = 1;
+            CHECK_NOTHROW(table.reserve(size));
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() == table_type::default_num_nodes);
+            CHECK(table.at(key) == value);
+        }
+    }
+
+    SECTION("rehash") {
+        table_type table;
+
+        const auto value = std::string("abc");
+        const char key = extract_key_type()(value);
+        CHECK(table.insert(value));
+        CHECK(table.at(key) == value);
+
+        CHECK(table.size() == 1);
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+
+        SECTION("to larger size") {
+            constexpr std::size_t min_num_nodes = 200;
+            constexpr std::size_t expected_num_nodes = 256;
+            CHECK_NOTHROW(table.rehash(min_num_nodes));
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() == expected_num_nodes);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("to larger size (power of two)") {
+            constexpr std::size_t min_num_nodes = 128;
+            CHECK_NOTHROW(table.rehash(min_num_nodes));
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() == min_num_nodes);
+            CHECK(table.at(key) == value);
+        }
+
+        SECTION("to smaller size") {
+            constexpr std::size_t min_num_nodes = 1;
+            CHECK_NOTHROW(table.rehash(min_num_nodes));
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() == table_type::default_num_nodes);
+            CHECK(table.at(key) == value);
+        }
+    }
+
+    SECTION("load_factor") {
+        table_type table;
+        CHECK(table.load_factor() == 0.0F);
+
+        CHECK(table.insert("abc"));
+        CHECK(table.size() == 1);
+        CHECK(table.load_factor() ==
+            static_cast<float>(table.size()) /
+                static_cast<float>(table.num_nodes()));
+
+        CHECK(table.insert("def"));
+        CHECK(table.size() == 2);
+        CHECK(table.load_factor() ==
+            static_cast<float>(table.size()) /
+                static_cast<float>(table.num_nodes()));
+    }
+
+    SECTION("max_load_factor") {
+        table_type table;
+
+        constexpr float value = 0.1F;
+        CHECK_NOTHROW(table.max_load_factor(value));
+        CHECK(table.max_load_factor() == value);
+
+        CHECK_THROWS(table.max_load_factor(0.0F));    // NOLINT
+        CHECK_NOTHROW(table.max_load_factor(0.01F));  // NOLINT
+        CHECK_NOTHROW(table.max_load_factor(0.99F));  // NOLINT
+        CHECK_THROWS(table.max_load_factor(1.0F));    // NOLINT
+    }
+
+    SECTION("insert and erase many values") {
+        table_type table;
+
+        constexpr char num_values = 100;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        for (char i = 0; i < num_values; i += 2) {
+            CHECK(table.erase(i));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values / 2));
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.has(i) == (i % 2 == 1));
+        }
+
+        // Repeated insertion and deletion reuses erased nodes.
+        const std::size_t num_nodes = table.num_nodes();
+        constexpr int repetition = 10;
+        for (int j = 0; j < repetition; ++j) {
+            for (char i = 0; i < num_values; i += 2) {
+                CHECK(table.insert(std::string(1, i) + "value"));
+            }
+            for (char i = 0; i < num_values; i += 2) {
+                CHECK(table.erase(i));
+            }
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values / 2));
+        CHECK(table.num_nodes() == num_nodes);
+        for (char i = 1; i < num_values; i += 2) {
+            CHECK(table.at(i) == std::string(1, i) + "value");
+        }
+    }
+
+    SECTION("functions with hash numbers") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto hash1 = table.hash()(key1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        const auto hash2 = table.hash()(key2);
+
+        CHECK(table.insert_with_hash(value1, hash1));
+        CHECK_FALSE(table.insert_with_hash(value1, hash1));
+        CHECK(table.emplace_with_hash(key2, hash2, value2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.has_with_hash(key1, hash1));
+        CHECK(table.has(key2));
+        const std::string* res = table.try_get_with_hash(key2, hash2);
+        REQUIRE(static_cast<const void*>(res) != nullptr);
+        CHECK(*res == value2);
+
+        CHECK(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.has_with_hash(key1, hash1));
+        CHECK(table.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE(
+    "hash_tables::tables::group_probing_table_st (heterogeneous lookup)") {
+    using hash_tables::tables::group_probing_table_st;
+
+    using key_type = std::string;
+    using value_type = std::pair<key_type, int>;
+    using extract_key_type =
+        hash_tables::extract_key_functions::extract_first_from_pair<
+            value_type>;
+    using table_type = group_probing_table_st<value_type, key_type,
+        extract_key_type, hash_tables::hashes::std_hash<key_type>,
+        std::equal_to<>>;
+
+    table_type table;
+    constexpr int mapped = 123;
+    CHECK(table.insert(value_type("abc", mapped)));
+
+    SECTION("get values") {
+        CHECK(table.at(std::string_view("abc")).second == mapped);
+        CHECK(std::as_const(table).at(std::string_view("abc")).second ==
+            mapped);
+        CHECK_THROWS((void)table.at(std::string_view("def")));
+    }
+
+    SECTION("get values constructing it if not found") {
+        constexpr int another_mapped = 234;
+        CHECK(table
+                  .get_or_create(std::string_view("abc"), "abc", another_mapped)
+                  .second == mapped);
+        CHECK(table
+                  .get_or_create(std::string_view("def"), "def", another_mapped)
+                  .second == another_mapped);
+        CHECK(table.size() == 2);
+    }
+
+    SECTION("get values if found") {
+        CHECK(table.try_get(std::string_view("abc")) != nullptr);
+        CHECK(std::as_const(table).try_get(std::string_view("abc")) != nullptr);
+        CHECK(table.try_get(std::string_view("def")) == nullptr);
+    }
+
+    SECTION("check whether keys exist") {
+        CHECK(table.has(std::string_view("abc")));
+        CHECK(table.has("abc"));
+        CHECK_FALSE(table.has(std::string_view("def")));
+    }
+
+    SECTION("erase values") {
+        CHECK_FALSE(table.erase(std::string_view("def")));
+        CHECK(table.erase(std::string_view("abc")));
+        CHECK(table.empty());
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::group_probing_table_st (sequential keys)") {
+    using hash_tables::tables::group_probing_table_st;
+
+    using key_type = int;
+    using value_type = int;
+    using extract_key_type =
+        hash_tables::extract_key_functions::identity<value_type>;
+    using table_type = group_probing_table_st<value_type, key_type,
+        extract_key_type, hash_tables::hashes::std_hash<key_type>,
+        counting_equal_to>;
+
+    std::size_t num_comparisons = 0;
+    table_type table{0U, extract_key_type(),
+        hash_tables::hashes::std_hash<key_type>(),
+        counting_equal_to{&num_comparisons}};
+
+    constexpr int num_values = 10000;
+    for (int i = 0; i < num_values; ++i) {
+        REQUIRE(table.insert(i));
+    }
+    for (int i = 0; i < num_values; ++i) {
+        INFO("i = " << i);
+        REQUIRE(table.has(i));
+    }
+
+    // Misses compare keys only when fragments of hash numbers match, so
+    // comparisons are rare unless keys are clustered in a few groups.
+    num_comparisons = 0;
+    for (int i = num_values; i < 2 * num_values; ++i) {
+        CHECK_FALSE(table.has(i));
+    }
+    CHECK(num_comparisons < static_cast<std::size_t>(num_values / 4));
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::group_probing_table_st (noexcept)") {
+    using hash_tables::tables::group_probing_table_st;
+
+    using extract_key_type = hash_tables::extract_key_functions::identity<int>;
+
+    STATIC_CHECK(std::is_nothrow_move_constructible_v<
+        group_probing_table_st<int, int, extract_key_type>>);
+    STATIC_CHECK(std::is_nothrow_move_assignable_v<
+        group_probing_table_st<int, int, extract_key_type>>);
+    STATIC_CHECK_FALSE(std::is_nothrow_move_constructible_v<
+        group_probing_table_st<int, int, extract_key_type,
+            throwing_move_hash>>);
+    STATIC_CHECK_FALSE(std::is_nothrow_move_assignable_v<
+        group_probing_table_st<int, int, extract_key_type,
+            throwing_move_hash>>);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of classes of groups of control bytes.
+ */
+#include "hash_tables/tables/internal/control_byte_group.h"
+
+#include <array>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::internal::control_byte_group", "",
+    hash_tables::tables::internal::scalar_control_byte_group,
+    hash_tables::tables::internal::control_byte_group) {
+    using hash_tables::tables::internal::control_byte;
+    using hash_tables::tables::internal::control_byte_empty;
+    using hash_tables::tables::internal::control_byte_erased;
+    using hash_tables::tables::internal::control_byte_group_size;
+    using hash_tables::tables::internal::control_byte_mask;
+    using group_type = TestType;
+
+    std::array<control_byte, control_byte_group_size> bytes{};
+    bytes.fill(control_byte_empty);
+    bytes[0] = 3;                    // NOLINT
+    bytes[2] = control_byte_erased;  // NOLINT
+    bytes[5] = 3;                    // NOLINT
+    bytes[7] = 0;                    // NOLINT
+    bytes[15] = 127;                 // NOLINT
+    const auto group = group_type(bytes.data());
+
+    SECTION("match a fragment") {
+        CHECK(group.match(3) == 0b0000000000100001U);
+        CHECK(group.match(0) == 0b0000000010000000U);
+        CHECK(group.match(127) == 0b1000000000000000U);  // NOLINT
+        CHECK(group.match(1) == 0U);
+    }
+
+    SECTION("match empty nodes") {
+        CHECK(group.match_empty() == 0b0111111101011010U);
+    }
+
+    SECTION("match empty or erased nodes") {
+        CHECK(group.match_empty_or_erased() == 0b0111111101011110U);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::internal::lowest_bit_index") {
+    using hash_tables::tables::internal::lowest_bit_index;
+
+    CHECK(lowest_bit_index(0b1U) == 0U);
+    CHECK(lowest_bit_index(0b1010000U) == 4U);
+    CHECK(lowest_bit_index(0b1000000000000000U) == 15U);  // NOLINT
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of retaining_allocator class.
+ */
+#include "hash_tables/tables/internal/retaining_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+/*!
+ * \brief Class of allocators counting allocated memory.
+ *
+ * \tparam T Type of objects.
+ */
+template <typename T>
+class counting_allocator {
+public:
+    using value_type = T;
+
+    explicit counting_allocator(std::ptrdiff_t& num_blocks) noexcept
+        : num_blocks_(&num_blocks) {}
+
+    template <typename U>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+    counting_allocator(const counting_allocator<U>& other) noexcept
+        : num_blocks_(&other.num_blocks()) {}
+
+    [[nodiscard]] auto allocate(std::size_t size) -> T* {
+        ++*num_blocks_;
+        return std::allocator<T>().allocate(size);
+    }
+
+    void deallocate(T* ptr, std::size_t size) noexcept {
+        --*num_blocks_;
+        std::allocator<T>().deallocate(ptr, size);
+    }
+
+    [[nodiscard]] auto num_blocks() const noexcept -> std::ptrdiff_t& {
+        return *num_blocks_;
+    }
+
+    template <typename U>
+    [[nodiscard]] auto operator==(
+        const counting_allocator<U>& right) const noexcept -> bool {
+        return num_blocks_ == &right.num_blocks();
+    }
+
+    template <typename U>
+    [[nodiscard]] auto operator!=(
+        const counting_allocator<U>& right) const noexcept -> bool {
+        return !operator==(right);
+    }
+
+private:
+    std::ptrdiff_t* num_blocks_;
+};
+
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::internal::retaining_allocator") {
+    using hash_tables::tables::internal::retained_memory_pool;
+    using hash_tables::tables::internal::retaining_allocator;
+
+    using base_allocator_type = counting_allocator<char>;
+    using pool_type = retained_memory_pool<base_allocator_type>;
+    using allocator_type =
+        retaining_allocator<std::uint64_t, base_allocator_type>;
+
+    std::ptrdiff_t num_blocks = 0;
+
+    SECTION("reuse memory of the same size") {
+        pool_type pool{base_allocator_type(num_blocks)};
+        allocator_type allocator(pool);
+
+        constexpr std::size_t size = 16;
+        std::uint64_t* ptr1 = allocator.allocate(size);
+        allocator.deallocate(ptr1, size);
+        CHECK(num_blocks == 1);
+
+        std::uint64_t* ptr2 = allocator.allocate(size);
+        CHECK(ptr2 == ptr1);
+        CHECK(num_blocks == 1);
+
+        std::uint64_t* ptr3 = allocator.allocate(size * 2U);
+        CHECK(ptr3 != ptr1);
+        CHECK(num_blocks == 2);
+
+        allocator.deallocate(ptr2, size);
+        allocator.deallocate(ptr3, size * 2U);
+        CHECK(allocator.allocate(size * 2U) == ptr3);
+        CHECK(allocator.allocate(size) == ptr2);
+        allocator.deallocate(ptr2, size);
+        allocator.deallocate(ptr3, size * 2U);
+    }
+
+    SECTION("don't reuse memory of other types") {
+        pool_type pool{base_allocator_type(num_blocks)};
+        allocator_type allocator(pool);
+        retaining_allocator<std::uint32_t, base_allocator_type>
+            another_allocator(allocator);
+        CHECK(another_allocator == allocator);
+
+        constexpr std::size_t size = 16;
+        std::uint64_t* ptr1 = allocator.allocate(size);
+        allocator.deallocate(ptr1, size);
+        std::uint32_t* ptr2 = another_allocator.allocate(size * 2U);
+        CHECK(static_cast<void*>(ptr2) != static_cast<void*>(ptr1));
+        another_allocator.deallocate(ptr2, size * 2U);
+        CHECK(num_blocks == 2);
+    }
+
+    SECTION("allocate small memory") {
+        pool_type pool{base_allocator_type(num_blocks)};
+        retaining_allocator<char, base_allocator_type> allocator(pool);
+
+        char* ptr1 = allocator.allocate(1);
+        allocator.deallocate(ptr1, 1);
+        CHECK(allocator.allocate(1) == ptr1);
+        allocator.deallocate(ptr1, 1);
+    }
+
+    SECTION("use in containers") {
+        pool_type pool{base_allocator_type(num_blocks)};
+        std::vector<std::uint64_t, allocator_type> vector{
+            allocator_type(pool)};
+        constexpr std::size_t size = 1000;
+        for (std::size_t i = 0; i < size; ++i) {
+            vector.push_back(i);
+        }
+        CHECK(vector.size() == size);
+        CHECK(vector.back() == size - 1U);
+    }
+
+    SECTION("compare allocators") {
+        pool_type pool1{base_allocator_type(num_blocks)};
+        pool_type pool2{base_allocator_type(num_blocks)};
+        CHECK(allocator_type(pool1) == allocator_type(pool1));
+        CHECK(allocator_type(pool1) != allocator_type(pool2));
+    }
+
+    CHECK(num_blocks == 0);
+}
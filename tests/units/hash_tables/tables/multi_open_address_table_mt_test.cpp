@@ -19,24 +19,42 @@
  */
 #include "hash_tables/tables/multi_open_address_table_mt.h"
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <type_traits>  // IWYU pragma: keep
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "hash_tables/extract_key_functions/extract_first_from_pair.h"
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables_test/extract_key_functions/extract_first_element.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
-    (std::tuple<hash_tables::hashes::std_hash<char>>),
-    (std::tuple<hash_tables_test::hashes::fixed_hash<char>>)) {
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::default_lock_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::default_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::mutex_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::shared_spin_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::spin_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::adaptive_lock_policy>)) {
     using hash_tables::tables::multi_open_address_table_mt;
 
     using key_type = char;
@@ -45,8 +63,13 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
         hash_tables_test::extract_key_functions::extract_first_element<
             value_type>;
     using hash_type = std::tuple_element_t<0, TestType>;
+    using lock_policy_type = std::tuple_element_t<1, TestType>;
     using table_type = multi_open_address_table_mt<value_type, key_type,
-        extract_key_type, hash_type>;
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>,
+        hash_tables::tables::internal::
+            multi_open_address_table_mt_default_min_num_tables,
+        lock_policy_type>;
 
     SECTION("prevent copy and move") {
         STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<table_type>);
@@ -59,6 +82,29 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
         table_type table;
         CHECK(table.size() == 0);  // NOLINT
         CHECK(table.empty());
+        CHECK(table.num_tables() >= table_type::default_min_num_tables());
+        CHECK(table_type::default_min_num_tables() >=
+            hash_tables::tables::internal::
+                multi_open_address_table_mt_default_min_num_tables);
+    }
+
+    SECTION("constructor with the number of tables") {
+        constexpr std::size_t min_num_tables = 5;
+        table_type table(table_type::default_num_internal_nodes,
+            extract_key_type(), hash_type(), std::equal_to<key_type>(),
+            std::allocator<value_type>(), min_num_tables);
+        CHECK(table.num_tables() == 8U);
+        CHECK(table.num_nodes() ==
+            table.num_tables() * table_type::default_num_internal_nodes);
+
+        const auto values = std::vector<std::string>{"abc", "bcd", "cde"};
+        for (const auto& value : values) {
+            CHECK(table.insert(value));
+        }
+        CHECK(table.size() == values.size());
+        for (const auto& value : values) {
+            CHECK(table.at(extract_key_type()(value)) == value);
+        }
     }
 
     SECTION("insert (const reference)") {
@@ -190,6 +236,57 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
         }
     }
 
+    SECTION("try_emplace") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK(table.emplace(key1, value1));
+        CHECK(table.size() == 1);
+
+        CHECK_FALSE(table.try_emplace(key1, "af"));
+        CHECK(table.size() == 1);
+        CHECK(table.try_emplace(key2, value2.c_str()));
+        CHECK(table.size() == 2);
+        CHECK(table.at(key1) == value1);
+        CHECK(table.at(key2) == value2);
+    }
+
+    SECTION("update") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        const auto function = [](std::string& value) { value += "x"; };
+        CHECK(table.emplace(key1, value1));
+
+        CHECK(table.update(key1, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+
+        CHECK_FALSE(table.update(key2, function));
+        CHECK(table.size() == 1);
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("upsert") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto factory = [&value1] { return value1; };
+        const auto function = [](std::string& value) { value += "x"; };
+
+        CHECK(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == value1);
+
+        CHECK_FALSE(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+    }
+
     SECTION("emplace_or_assign") {
         SECTION("successful") {
             table_type table;
@@ -565,6 +662,31 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
             [](const std::string& val) { return val.empty(); }));
     }
 
+    SECTION("size") {
+        table_type table;
+        CHECK(table.size() == 0);        // NOLINT
+        CHECK(table.exact_size() == 0);  // NOLINT
+        CHECK(table.empty());
+
+        const auto values = std::vector<std::string>{"abc", "bcd", "cde"};
+        for (const auto& value : values) {
+            CHECK(table.insert(value));
+        }
+        CHECK(table.size() == values.size());
+        CHECK(table.exact_size() == values.size());
+        CHECK_FALSE(table.empty());
+
+        CHECK(table.erase(extract_key_type()(values[0])));
+        CHECK(table.size() == values.size() - 1U);
+        CHECK(table.exact_size() == values.size() - 1U);
+        CHECK_FALSE(table.empty());
+
+        table.clear();
+        CHECK(table.size() == 0);        // NOLINT
+        CHECK(table.exact_size() == 0);  // NOLINT
+        CHECK(table.empty());
+    }
+
     SECTION("max_size") {
         table_type table;
 
@@ -581,9 +703,7 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
 
         CHECK(table.size() == 1);
         CHECK(table.num_nodes() ==
-            hash_tables::tables::internal::
-                    multi_open_address_table_mt_default_min_num_tables *
-                table_type::default_num_internal_nodes);
+            table.num_tables() * table_type::default_num_internal_nodes);
 
         SECTION("to larger size") {
             constexpr std::size_t size = 128;
@@ -598,9 +718,7 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
             CHECK_NOTHROW(table.reserve(size));
             CHECK(table.size() == 1);
             CHECK(table.num_nodes() ==
-                hash_tables::tables::internal::
-                        multi_open_address_table_mt_default_min_num_tables *
-                    table_type::default_num_internal_nodes);
+                table.num_tables() * table_type::default_num_internal_nodes);
             CHECK(table.at(key) == value);
         }
     }
@@ -611,4 +729,107 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_mt", "",
         constexpr std::size_t size = 128;
         CHECK_NOTHROW(table.reserve_approx(size));
     }
+
+    SECTION("functions with hash numbers") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto hash1 = table.hash()(key1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        const auto hash2 = table.hash()(key2);
+
+        CHECK(table.insert_with_hash(value1, hash1));
+        CHECK_FALSE(table.insert_with_hash(value1, hash1));
+        CHECK(table.emplace_with_hash(key2, hash2, value2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.has_with_hash(key1, hash1));
+        CHECK(table.has(key2));
+        CHECK(table.try_get_with_hash(key2, hash2).value() == value2);
+
+        CHECK(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.has_with_hash(key1, hash1));
+        CHECK(table.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE(
+    "hash_tables::tables::multi_open_address_table_mt (optimistic reads)") {
+    using hash_tables::tables::multi_open_address_table_mt;
+
+    using key_type = int;
+    using value_type = std::pair<int, int>;
+    using extract_key_type =
+        hash_tables::extract_key_functions::extract_first_from_pair<
+            value_type>;
+    using hash_type = hash_tables::hashes::std_hash<key_type>;
+    using table_type = multi_open_address_table_mt<value_type, key_type,
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>,
+        hash_tables::tables::internal::
+            multi_open_address_table_mt_default_min_num_tables,
+        hash_tables::tables::policies::optimistic_read_lock_policy>;
+
+    SECTION("read values") {
+        table_type table;
+        CHECK(table.emplace(1, 1, 2));  // NOLINT
+        CHECK(table.emplace(3, 3, 4));  // NOLINT
+
+        const auto& const_table = table;
+        CHECK(const_table.at(1) == value_type(1, 2));
+        CHECK_THROWS((void)const_table.at(2));
+
+        value_type res{};
+        CHECK_NOTHROW(const_table.get_to(res, 3));
+        CHECK(res == value_type(3, 4));  // NOLINT
+        CHECK_THROWS(const_table.get_to(res, 2));
+
+        CHECK(const_table.try_get(3) == value_type(3, 4));  // NOLINT
+        CHECK(const_table.try_get(2) == std::nullopt);
+
+        CHECK(const_table.try_get_to(res, 1));
+        CHECK(res == value_type(1, 2));
+        CHECK_FALSE(const_table.try_get_to(res, 2));
+
+        CHECK(const_table.has(1));
+        CHECK_FALSE(const_table.has(2));
+
+        const auto hash3 = table.hash()(3);
+        CHECK(const_table.try_get_with_hash(3, hash3) ==
+            value_type(3, 4));  // NOLINT
+        CHECK(const_table.has_with_hash(3, hash3));
+    }
+
+    SECTION("read values after rehashing and deletion") {
+        table_type table;
+        constexpr int size = 1000;
+        for (int key = 0; key < size; ++key) {
+            CHECK(table.emplace(key, key, key * 2));
+        }
+        for (int key = 0; key < size; key += 2) {
+            CHECK(table.erase(key));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(size / 2));
+
+        for (int key = 0; key < size; ++key) {
+            INFO("key = " << key);
+            if (key % 2 == 0) {
+                CHECK_FALSE(table.has(key));
+            } else {
+                CHECK(table.try_get(key) == value_type(key, key * 2));
+            }
+        }
+
+        table.clear();
+        CHECK(table.empty());
+        CHECK_FALSE(table.has(1));
+    }
+
+    SECTION("get allocator") {
+        table_type table;
+        CHECK(table.allocator() == std::allocator<value_type>());
+    }
 }
@@ -19,16 +19,25 @@
  */
 #include "hash_tables/tables/multi_open_address_table_st.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "hash_tables/extract_key_functions/identity.h"
 #include "hash_tables/hashes/std_hash.h"
 #include "hash_tables_test/extract_key_functions/extract_first_element.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
+#include "hash_tables_test/hashes/seeded_hash.h"
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
@@ -49,6 +58,46 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
         table_type table;
         CHECK(table.size() == 0);  // NOLINT
         CHECK(table.empty());
+        CHECK(table.num_tables() ==
+            hash_tables::tables::internal::
+                multi_open_address_table_st_default_min_num_tables);
+    }
+
+    SECTION("constructor with the number of tables") {
+        constexpr std::size_t min_num_tables = 3;
+        table_type table(table_type::default_num_internal_nodes,
+            extract_key_type(), hash_type(), std::equal_to<key_type>(),
+            std::allocator<value_type>(), min_num_tables);
+        CHECK(table.num_tables() == 4U);
+        CHECK(table.num_nodes() ==
+            table.num_tables() * table_type::default_num_internal_nodes);
+
+        const auto values = std::vector<std::string>{"abc", "bcd", "cde"};
+        for (const auto& value : values) {
+            CHECK(table.insert(value));
+        }
+        for (const auto& value : values) {
+            CHECK(table.at(extract_key_type()(value)) == value);
+        }
+
+        std::size_t num_visited = 0;
+        for ([[maybe_unused]] const auto& value : table) {
+            ++num_visited;
+        }
+        CHECK(num_visited == values.size());
+
+        table_type copy{table};  // NOLINT
+        CHECK(copy.num_tables() == table.num_tables());
+        for (const auto& value : values) {
+            CHECK(copy.at(extract_key_type()(value)) == value);
+        }
+
+        table_type moved;
+        moved = std::move(copy);
+        CHECK(moved.num_tables() == table.num_tables());
+        for (const auto& value : values) {
+            CHECK(moved.at(extract_key_type()(value)) == value);
+        }
     }
 
     SECTION("copy constructor") {
@@ -218,6 +267,66 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
         }
     }
 
+    SECTION("try_emplace") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK(table.emplace(key1, value1));
+        CHECK(table.size() == 1);
+
+        {
+            const auto [value, inserted] = table.try_emplace(key1, "af");
+            CHECK_FALSE(inserted);
+            CHECK(value == value1);
+        }
+        CHECK(table.size() == 1);
+        {
+            const auto [value, inserted] =
+                table.try_emplace(key2, value2.c_str());
+            CHECK(inserted);
+            CHECK(value == value2);
+        }
+        CHECK(table.size() == 2);
+        CHECK(table.at(key1) == value1);
+        CHECK(table.at(key2) == value2);
+    }
+
+    SECTION("update") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        const auto function = [](std::string& value) { value += "x"; };
+        CHECK(table.emplace(key1, value1));
+
+        CHECK(table.update(key1, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+
+        CHECK_FALSE(table.update(key2, function));
+        CHECK(table.size() == 1);
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("upsert") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto factory = [&value1] { return value1; };
+        const auto function = [](std::string& value) { value += "x"; };
+
+        CHECK(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == value1);
+
+        CHECK_FALSE(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+    }
+
     SECTION("emplace_or_assign") {
         SECTION("successful") {
             table_type table;
@@ -392,6 +501,54 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
         CHECK_FALSE(table.has(key2));
     }
 
+    SECTION("find_batch") {
+        table_type table;
+        constexpr char num_keys = 40;
+        for (char i = 0; i < num_keys; i += 2) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        std::vector<char> keys;
+        for (char i = 0; i < num_keys; ++i) {
+            keys.push_back(i);
+        }
+
+        std::vector<std::string*> outputs(keys.size());
+        table.find_batch(keys, outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(static_cast<const void*>(outputs[i]) ==
+                static_cast<const void*>(table.try_get(keys[i])));
+        }
+
+        const auto& const_table = table;
+        std::vector<const std::string*> const_outputs(keys.size());
+        const_table.find_batch(keys, const_outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(static_cast<const void*>(const_outputs[i]) ==
+                static_cast<const void*>(const_table.try_get(keys[i])));
+        }
+    }
+
+    SECTION("has_batch") {
+        table_type table;
+        constexpr char num_keys = 40;
+        for (char i = 0; i < num_keys; i += 2) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        std::vector<char> keys;
+        for (char i = 0; i < num_keys; ++i) {
+            keys.push_back(i);
+        }
+
+        std::vector<bool> outputs(keys.size());
+        table.has_batch(keys, outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(outputs[i] == (keys[i] % 2 == 0));
+        }
+    }
+
     SECTION("for_all (non const)") {
         table_type table;
 
@@ -427,6 +584,122 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
         CHECK(args == std::unordered_set<std::string>{value1, value2});
     }
 
+    SECTION("iterators") {
+        table_type table;
+        CHECK(table.begin() == table.end());
+
+        const auto value1 = std::string("abc");
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        CHECK(table.insert(value2));
+
+        std::unordered_set<std::string> values;
+        for (auto& value : table) {
+            INFO(value);
+            CHECK(values.insert(value).second);
+            value += "x";
+        }
+        CHECK(values == std::unordered_set<std::string>{value1, value2});
+        CHECK(table.at('a') == "abcx");
+
+        const auto& const_table = table;
+        CHECK(std::distance(const_table.begin(), const_table.end()) == 2);
+        const auto iter = std::find_if(table.cbegin(), table.cend(),
+            [](const std::string& value) { return value[0] == 'b'; });
+        REQUIRE(iter != table.cend());
+        CHECK(*iter == "bcdx");
+        CHECK(iter->size() == 4);
+        typename table_type::const_iterator converted = table.begin();
+        CHECK(converted == table.cbegin());
+    }
+
+    SECTION("scan") {
+        table_type table;
+
+        constexpr char num_values = 50;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+
+        std::unordered_set<std::string> values;
+        std::size_t cursor = 0;
+        std::size_t num_calls = 0;
+        do {
+            std::size_t num_visited = 0;
+            cursor = table.scan(cursor, 7, [&](std::string& value) {  // NOLINT
+                CHECK(values.insert(value).second);
+                ++num_visited;
+            });
+            CHECK(num_visited <= 7);  // NOLINT
+            ++num_calls;
+        } while (cursor != 0);
+        CHECK(values.size() == static_cast<std::size_t>(num_values));
+        CHECK(num_calls >= 8);  // NOLINT
+
+        const auto& const_table = table;
+        std::size_t num_visited = 0;
+        CHECK(const_table.scan(0, 100, [&](const std::string& /*value*/) {
+            ++num_visited;
+        }) == 0);
+        CHECK(num_visited == static_cast<std::size_t>(num_values));
+    }
+
+    SECTION("extract and insert") {
+        table_type table;
+        CHECK(table.insert(std::string("abc")));
+        CHECK(table.insert(std::string("bcd")));
+
+        auto node = table.extract('a');
+        REQUIRE_FALSE(node.empty());
+        CHECK(node.value() == "abc");
+        CHECK_FALSE(table.has('a'));
+        CHECK(table.size() == 1);
+        CHECK(table.extract('a').empty());
+
+        table_type other;
+        CHECK(other.insert(std::move(node)));
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(other.at('a') == "abc");
+
+        auto duplicate = table.extract('b');
+        CHECK(other.insert(std::string("bxx")));
+        CHECK_FALSE(other.insert(std::move(duplicate)));
+        CHECK(duplicate.value() == "bcd");  // NOLINT(bugprone-use-after-move)
+        CHECK_FALSE(other.insert(typename table_type::node_handle_type()));
+        CHECK(other.size() == 2);
+    }
+
+    SECTION("merge") {
+        table_type table;
+        table_type other;
+        constexpr char num_values = 60;
+        constexpr char first_other = 20;
+        constexpr char last_table = 40;
+        for (char i = 0; i < last_table; ++i) {
+            CHECK(table.insert(std::string(1, i) + "table"));
+        }
+        for (char i = first_other; i < num_values; ++i) {
+            CHECK(other.insert(std::string(1, i) + "other"));
+        }
+
+        table.merge(other);
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        CHECK(other.size() ==
+            static_cast<std::size_t>(last_table - first_other));
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            if (i < last_table) {
+                CHECK(table.at(i) == std::string(1, i) + "table");
+            } else {
+                CHECK(table.at(i) == std::string(1, i) + "other");
+            }
+            CHECK(other.has(i) == (first_other <= i && i < last_table));
+        }
+
+        table.merge(table);
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+    }
+
     SECTION("clear") {
         table_type table;
 
@@ -599,4 +872,88 @@ TEMPLATE_TEST_CASE("hash_tables::tables::multi_open_address_table_st", "",
         constexpr std::size_t size = 128;
         CHECK_NOTHROW(table.reserve_approx(size));
     }
+
+    SECTION("functions with hash numbers") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto hash1 = table.hash()(key1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        const auto hash2 = table.hash()(key2);
+
+        CHECK(table.insert_with_hash(value1, hash1));
+        CHECK_FALSE(table.insert_with_hash(value1, hash1));
+        CHECK(table.emplace_with_hash(key2, hash2, value2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.has_with_hash(key1, hash1));
+        CHECK(table.has(key2));
+        const std::string* res = table.try_get_with_hash(key2, hash2);
+        REQUIRE(static_cast<const void*>(res) != nullptr);
+        CHECK(*res == value2);
+
+        CHECK(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.has_with_hash(key1, hash1));
+        CHECK(table.size() == 1);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::multi_open_address_table_st (merge)") {
+    using hash_tables::tables::multi_open_address_table_st;
+
+    using key_type = int;
+    using value_type = int;
+    using extract_key_type =
+        hash_tables::extract_key_functions::identity<value_type>;
+
+    constexpr int num_values = 100;
+    constexpr int first_other = 30;
+    constexpr int last_table = 60;
+    const auto fill_and_merge = [](auto& table, auto& other) {
+        for (int i = 0; i < last_table; ++i) {
+            CHECK(table.insert(i));
+        }
+        for (int i = first_other; i < num_values; ++i) {
+            CHECK(other.insert(i));
+        }
+
+        table.merge(other);
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        CHECK(other.size() ==
+            static_cast<std::size_t>(last_table - first_other));
+        for (int i = 0; i < num_values; ++i) {
+            INFO("i = " << i);
+            CHECK(table.has(i));
+            CHECK(other.has(i) == (first_other <= i && i < last_table));
+        }
+    };
+
+    constexpr std::size_t min_num_nodes = 16;
+
+    SECTION("different numbers of internal tables") {
+        using table_type = multi_open_address_table_st<value_type, key_type,
+            extract_key_type, hash_tables::hashes::std_hash<key_type>>;
+        constexpr std::size_t num_tables = 2;
+        constexpr std::size_t num_other_tables = 8;
+        table_type table{min_num_nodes, extract_key_type(),
+            hash_tables::hashes::std_hash<key_type>(), std::equal_to<key_type>(),
+            std::allocator<value_type>(), num_tables};
+        table_type other{min_num_nodes, extract_key_type(),
+            hash_tables::hashes::std_hash<key_type>(), std::equal_to<key_type>(),
+            std::allocator<value_type>(), num_other_tables};
+        fill_and_merge(table, other);
+    }
+
+    SECTION("stateful hash functions") {
+        using hash_type = hash_tables_test::hashes::seeded_hash<key_type>;
+        using table_type = multi_open_address_table_st<value_type, key_type,
+            extract_key_type, hash_type>;
+        constexpr std::size_t seed = 12345;
+        table_type table{min_num_nodes, extract_key_type(), hash_type(0)};
+        table_type other{min_num_nodes, extract_key_type(), hash_type(seed)};
+        fill_and_merge(table, other);
+    }
 }
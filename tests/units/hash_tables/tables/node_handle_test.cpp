@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of node_handle class.
+ */
+#include "hash_tables/tables/node_handle.h"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::node_handle") {
+    using hash_tables::tables::node_handle;
+
+    SECTION("copy is prohibited") {
+        STATIC_CHECK(!std::is_copy_constructible_v<node_handle<int>>);
+        STATIC_CHECK(!std::is_copy_assignable_v<node_handle<int>>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<node_handle<int>>);
+    }
+
+    SECTION("create an empty handle") {
+        const node_handle<std::string> node;
+        CHECK(node.empty());
+        CHECK_FALSE(static_cast<bool>(node));
+    }
+
+    SECTION("construct a value") {
+        constexpr std::size_t hash_number = 12345;
+        node_handle<std::string> node;
+        node.emplace(hash_number, "abc");
+        CHECK_FALSE(node.empty());
+        CHECK(static_cast<bool>(node));
+        CHECK(node.value() == "abc");
+        CHECK(std::as_const(node).value() == "abc");
+        CHECK(node.hash_number() == hash_number);
+
+        node.clear();
+        CHECK(node.empty());
+    }
+
+    SECTION("move a handle") {
+        constexpr std::size_t hash_number = 12345;
+        node_handle<std::string> node;
+        node.emplace(hash_number, "abc");
+
+        node_handle<std::string> moved{std::move(node)};
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(moved.value() == "abc");
+        CHECK(moved.hash_number() == hash_number);
+
+        node_handle<std::string> assigned;
+        assigned.emplace(hash_number + 1U, "def");
+        assigned = std::move(moved);
+        CHECK(moved.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(assigned.value() == "abc");
+        CHECK(assigned.hash_number() == hash_number);
+    }
+
+    SECTION("move a handle of trivially relocatable values") {
+        constexpr std::size_t hash_number = 12345;
+        constexpr int value = 123;
+        node_handle<int> node;
+        node.emplace(hash_number, value);
+
+        node_handle<int> moved{std::move(node)};
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(moved.value() == value);
+        CHECK(moved.hash_number() == hash_number);
+    }
+}
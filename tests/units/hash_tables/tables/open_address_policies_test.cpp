@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of policies of hash tables using open addressing.
+ */
+#include "hash_tables/tables/open_address_policies.h"
+
+#include <cstddef>
+#include <unordered_set>
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::policies (probing)", "",
+    hash_tables::tables::policies::linear_probing,
+    hash_tables::tables::policies::quadratic_probing,
+    hash_tables::tables::policies::triangular_probing) {
+    using probing_type = TestType;
+
+    SECTION("reach all nodes") {
+        for (std::size_t num_nodes : {32U, 45U, 64U}) {  // NOLINT
+            INFO("num_nodes = " << num_nodes);
+            std::unordered_set<std::size_t> node_inds;
+            for (std::size_t dist = 0; dist < 2U * num_nodes; ++dist) {
+                node_inds.insert(
+                    probing_type::offset(dist, num_nodes) % num_nodes);
+            }
+            CHECK(node_inds.size() == num_nodes);
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::policies (slot mapping)", "",
+    hash_tables::tables::policies::mask_slot_mapping,
+    hash_tables::tables::policies::fibonacci_slot_mapping,
+    hash_tables::tables::policies::fastrange_slot_mapping) {
+    using slot_mapping_type = TestType;
+
+    constexpr std::size_t num_nodes = 64;
+    const slot_mapping_type mapping{num_nodes};
+
+    SECTION("map hash numbers to nodes") {
+        std::unordered_set<std::size_t> node_inds;
+        for (std::size_t hash_number = 0; hash_number < 1000U;  // NOLINT
+             ++hash_number) {
+            const std::size_t node_ind = mapping.node_ind_of(hash_number);
+            CHECK(node_ind < num_nodes);
+            node_inds.insert(node_ind);
+        }
+        CHECK(node_inds.size() == num_nodes);
+    }
+
+    SECTION("add and subtract offsets") {
+        constexpr std::size_t node_ind = 60;
+        constexpr std::size_t offset = 10;
+        constexpr std::size_t expected = 6;
+        CHECK(mapping.add(node_ind, offset) == expected);
+        CHECK(mapping.subtract(expected, offset) == node_ind);
+        CHECK(mapping.add(node_ind, 0) == node_ind);
+        CHECK(mapping.subtract(node_ind, 0) == node_ind);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::policies::fastrange_slot_mapping") {
+    using hash_tables::tables::policies::fastrange_slot_mapping;
+
+    constexpr std::size_t num_nodes = 45;
+    const fastrange_slot_mapping mapping{num_nodes};
+
+    SECTION("map hash numbers to nodes") {
+        std::unordered_set<std::size_t> node_inds;
+        for (std::size_t hash_number = 0; hash_number < 1000U;  // NOLINT
+             ++hash_number) {
+            const std::size_t node_ind = mapping.node_ind_of(hash_number);
+            CHECK(node_ind < num_nodes);
+            node_inds.insert(node_ind);
+        }
+        CHECK(node_inds.size() == num_nodes);
+    }
+
+    SECTION("add and subtract offsets") {
+        constexpr std::size_t node_ind = 40;
+        constexpr std::size_t offset = 100;
+        constexpr std::size_t expected = 5;
+        CHECK(mapping.add(node_ind, offset) == expected);
+        CHECK(mapping.subtract(expected, offset) == node_ind);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::policies (growth)") {
+    using hash_tables::tables::policies::double_growth;
+    using hash_tables::tables::policies::one_and_half_growth;
+
+    constexpr std::size_t num_nodes = 32;
+    CHECK(double_growth::grow(num_nodes) == 64U);
+    CHECK(one_and_half_growth::grow(num_nodes) == 48U);
+}
@@ -19,21 +19,98 @@
  */
 #include "hash_tables/tables/open_address_table_st.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "hash_tables/extract_key_functions/extract_first_from_pair.h"
+#include "hash_tables/extract_key_functions/identity.h"
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables/utility/is_trivially_relocatable.h"
+#include "hash_tables/utility/round_up_to_power_of_two.h"
 #include "hash_tables_test/extract_key_functions/extract_first_element.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
+#include "hash_tables_test/hashes/seeded_hash.h"
+
+namespace {
+
+template <typename Table, typename KeyLike, typename = void>
+struct is_prefetch_enabled : public std::false_type {};
+
+template <typename Table, typename KeyLike>
+struct is_prefetch_enabled<Table, KeyLike,
+    std::void_t<decltype(std::declval<const Table&>().prefetch(
+        std::declval<const KeyLike&>()))>> : public std::true_type {};
+
+}  // namespace
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
-    (std::tuple<hash_tables::hashes::std_hash<char>>),
-    (std::tuple<hash_tables_test::hashes::fixed_hash<char>>)) {
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::default_open_address_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::robin_hood_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::tombstone_strategy,
+            hash_tables::tables::policies::quadratic_probing>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::tombstone_strategy,
+            hash_tables::tables::policies::triangular_probing,
+            hash_tables::tables::policies::fibonacci_slot_mapping>>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::tombstone_strategy,
+            hash_tables::tables::policies::quadratic_probing,
+            hash_tables::tables::policies::fastrange_slot_mapping,
+            hash_tables::tables::policies::one_and_half_growth>>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::robin_hood_strategy,
+            hash_tables::tables::policies::linear_probing,
+            hash_tables::tables::policies::fastrange_slot_mapping,
+            hash_tables::tables::policies::one_and_half_growth>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::tombstone_strategy,
+            hash_tables::tables::policies::linear_probing,
+            hash_tables::tables::policies::mask_slot_mapping,
+            hash_tables::tables::policies::double_growth, true>>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::robin_hood_strategy,
+            hash_tables::tables::policies::linear_probing,
+            hash_tables::tables::policies::mask_slot_mapping,
+            hash_tables::tables::policies::double_growth, true>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::separate_values_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::open_address_policy<
+            hash_tables::tables::policies::robin_hood_strategy,
+            hash_tables::tables::policies::linear_probing,
+            hash_tables::tables::policies::fastrange_slot_mapping,
+            hash_tables::tables::policies::one_and_half_growth, false,
+            true>>)) {
     using hash_tables::tables::open_address_table_st;
 
     using key_type = char;
@@ -42,8 +119,10 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         hash_tables_test::extract_key_functions::extract_first_element<
             value_type>;
     using hash_type = std::tuple_element_t<0, TestType>;
+    using policy_type = std::tuple_element_t<1, TestType>;
     using table_type = open_address_table_st<value_type, key_type,
-        extract_key_type, hash_type>;
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>, policy_type>;
 
     SECTION("default constructor") {
         table_type table;
@@ -219,6 +298,66 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         }
     }
 
+    SECTION("try_emplace") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        CHECK(table.emplace(key1, value1));
+        CHECK(table.size() == 1);
+
+        {
+            const auto [value, inserted] = table.try_emplace(key1, "af");
+            CHECK_FALSE(inserted);
+            CHECK(value == value1);
+        }
+        CHECK(table.size() == 1);
+        {
+            const auto [value, inserted] =
+                table.try_emplace(key2, value2.c_str());
+            CHECK(inserted);
+            CHECK(value == value2);
+        }
+        CHECK(table.size() == 2);
+        CHECK(table.at(key1) == value1);
+        CHECK(table.at(key2) == value2);
+    }
+
+    SECTION("update") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        const auto function = [](std::string& value) { value += "x"; };
+        CHECK(table.emplace(key1, value1));
+
+        CHECK(table.update(key1, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+
+        CHECK_FALSE(table.update(key2, function));
+        CHECK(table.size() == 1);
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("upsert") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto factory = [&value1] { return value1; };
+        const auto function = [](std::string& value) { value += "x"; };
+
+        CHECK(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == value1);
+
+        CHECK_FALSE(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+    }
+
     SECTION("emplace_or_assign") {
         SECTION("successful") {
             table_type table;
@@ -393,6 +532,54 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         CHECK_FALSE(table.has(key2));
     }
 
+    SECTION("find_batch") {
+        table_type table;
+        constexpr char num_keys = 40;
+        for (char i = 0; i < num_keys; i += 2) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        std::vector<char> keys;
+        for (char i = 0; i < num_keys; ++i) {
+            keys.push_back(i);
+        }
+
+        std::vector<std::string*> outputs(keys.size());
+        table.find_batch(keys, outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(static_cast<const void*>(outputs[i]) ==
+                static_cast<const void*>(table.try_get(keys[i])));
+        }
+
+        const auto& const_table = table;
+        std::vector<const std::string*> const_outputs(keys.size());
+        const_table.find_batch(keys, const_outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(static_cast<const void*>(const_outputs[i]) ==
+                static_cast<const void*>(const_table.try_get(keys[i])));
+        }
+    }
+
+    SECTION("has_batch") {
+        table_type table;
+        constexpr char num_keys = 40;
+        for (char i = 0; i < num_keys; i += 2) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        std::vector<char> keys;
+        for (char i = 0; i < num_keys; ++i) {
+            keys.push_back(i);
+        }
+
+        std::vector<bool> outputs(keys.size());
+        table.has_batch(keys, outputs);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("key = " << static_cast<int>(keys[i]));
+            CHECK(outputs[i] == (keys[i] % 2 == 0));
+        }
+    }
+
     SECTION("for_all (non const)") {
         table_type table;
 
@@ -428,6 +615,122 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         CHECK(args == std::unordered_set<std::string>{value1, value2});
     }
 
+    SECTION("iterators") {
+        table_type table;
+        CHECK(table.begin() == table.end());
+
+        const auto value1 = std::string("abc");
+        CHECK(table.insert(value1));
+        const auto value2 = std::string("bcd");
+        CHECK(table.insert(value2));
+
+        std::unordered_set<std::string> values;
+        for (auto& value : table) {
+            INFO(value);
+            CHECK(values.insert(value).second);
+            value += "x";
+        }
+        CHECK(values == std::unordered_set<std::string>{value1, value2});
+        CHECK(table.at('a') == "abcx");
+
+        const auto& const_table = table;
+        CHECK(std::distance(const_table.begin(), const_table.end()) == 2);
+        const auto iter = std::find_if(table.cbegin(), table.cend(),
+            [](const std::string& value) { return value[0] == 'b'; });
+        REQUIRE(iter != table.cend());
+        CHECK(*iter == "bcdx");
+        CHECK(iter->size() == 4);
+        typename table_type::const_iterator converted = table.begin();
+        CHECK(converted == table.cbegin());
+    }
+
+    SECTION("scan") {
+        table_type table;
+
+        constexpr char num_values = 50;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+
+        std::unordered_set<std::string> values;
+        std::size_t cursor = 0;
+        std::size_t num_calls = 0;
+        do {
+            std::size_t num_visited = 0;
+            cursor = table.scan(cursor, 7, [&](std::string& value) {  // NOLINT
+                CHECK(values.insert(value).second);
+                ++num_visited;
+            });
+            CHECK(num_visited <= 7);  // NOLINT
+            ++num_calls;
+        } while (cursor != 0);
+        CHECK(values.size() == static_cast<std::size_t>(num_values));
+        CHECK(num_calls >= 8);  // NOLINT
+
+        const auto& const_table = table;
+        std::size_t num_visited = 0;
+        CHECK(const_table.scan(0, 100, [&](const std::string& /*value*/) {
+            ++num_visited;
+        }) == 0);
+        CHECK(num_visited == static_cast<std::size_t>(num_values));
+    }
+
+    SECTION("extract and insert") {
+        table_type table;
+        CHECK(table.insert(std::string("abc")));
+        CHECK(table.insert(std::string("bcd")));
+
+        auto node = table.extract('a');
+        REQUIRE_FALSE(node.empty());
+        CHECK(node.value() == "abc");
+        CHECK_FALSE(table.has('a'));
+        CHECK(table.size() == 1);
+        CHECK(table.extract('a').empty());
+
+        table_type other;
+        CHECK(other.insert(std::move(node)));
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(other.at('a') == "abc");
+
+        auto duplicate = table.extract('b');
+        CHECK(other.insert(std::string("bxx")));
+        CHECK_FALSE(other.insert(std::move(duplicate)));
+        CHECK(duplicate.value() == "bcd");  // NOLINT(bugprone-use-after-move)
+        CHECK_FALSE(other.insert(typename table_type::node_handle_type()));
+        CHECK(other.size() == 2);
+    }
+
+    SECTION("merge") {
+        table_type table;
+        table_type other;
+        constexpr char num_values = 60;
+        constexpr char first_other = 20;
+        constexpr char last_table = 40;
+        for (char i = 0; i < last_table; ++i) {
+            CHECK(table.insert(std::string(1, i) + "table"));
+        }
+        for (char i = first_other; i < num_values; ++i) {
+            CHECK(other.insert(std::string(1, i) + "other"));
+        }
+
+        table.merge(other);
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        CHECK(other.size() ==
+            static_cast<std::size_t>(last_table - first_other));
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            if (i < last_table) {
+                CHECK(table.at(i) == std::string(1, i) + "table");
+            } else {
+                CHECK(table.at(i) == std::string(1, i) + "other");
+            }
+            CHECK(other.has(i) == (first_other <= i && i < last_table));
+        }
+
+        table.merge(table);
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+    }
+
     SECTION("clear") {
         table_type table;
 
@@ -442,11 +745,25 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         CHECK(table.has(key2));
         CHECK(table.size() == 2);
 
+        CHECK(table.erase(key2));
+        CHECK(table.insert(value2));
+        const std::size_t num_nodes = table.num_nodes();
+
         CHECK_NOTHROW(table.clear());
 
         CHECK_FALSE(table.has(key1));
         CHECK_FALSE(table.has(key2));
         CHECK(table.size() == 0);  // NOLINT
+        CHECK(table.num_erased() == 0);
+        CHECK(table.num_nodes() == num_nodes);
+        CHECK_NOTHROW(table.clear());
+        CHECK(table.size() == 0);  // NOLINT
+
+        CHECK(table.insert(value2));
+        CHECK(table.insert(value1));
+        CHECK(table.at(key1) == value1);
+        CHECK(table.at(key2) == value2);
+        CHECK(table.size() == 2);
     }
 
     SECTION("erase") {
@@ -588,6 +905,57 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         }
     }
 
+    SECTION("shrink_to_fit") {
+        table_type table;
+        constexpr std::size_t size = 100;
+        table.reserve(size);
+        CHECK(table.num_nodes() > size);
+        const auto value = std::string("abc");
+        const char key = extract_key_type()(value);
+        CHECK(table.insert(value));
+
+        CHECK_NOTHROW(table.shrink_to_fit());
+        CHECK(table.size() == 1);
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+        CHECK(table.at(key) == value);
+    }
+
+    SECTION("min_load_factor") {
+        table_type table;
+        CHECK(table.min_load_factor() == 0.0F);
+
+        constexpr float value = 0.1F;
+        CHECK_NOTHROW(table.min_load_factor(value));
+        CHECK(table.min_load_factor() == value);
+
+        CHECK_NOTHROW(table.min_load_factor(0.0F));
+        CHECK_THROWS(table.min_load_factor(-0.1F));  // NOLINT
+        CHECK_THROWS(table.min_load_factor(0.4F));   // NOLINT
+
+        SECTION("keep the maximum load factor larger than twice of it") {
+            CHECK_NOTHROW(table.min_load_factor(value));
+            CHECK_THROWS(table.max_load_factor(0.2F));    // NOLINT
+            CHECK_NOTHROW(table.max_load_factor(0.21F));  // NOLINT
+            CHECK(table.min_load_factor() == value);
+        }
+
+        SECTION("shrink automatically") {
+            CHECK_NOTHROW(table.min_load_factor(value));
+            constexpr char num_values = 100;
+            for (char i = 0; i < num_values; ++i) {
+                CHECK(table.insert(std::string(1, i)));
+            }
+            const std::size_t max_num_nodes = table.num_nodes();
+
+            for (char i = 1; i < num_values; ++i) {
+                CHECK(table.erase(i));
+            }
+            CHECK(table.size() == 1);
+            CHECK(table.num_nodes() < max_num_nodes);
+            CHECK(table.at(0) == std::string(1, 0));
+        }
+    }
+
     SECTION("rehash") {
         table_type table;
 
@@ -601,7 +969,10 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
 
         SECTION("to larger size") {
             constexpr std::size_t min_num_nodes = 200;
-            constexpr std::size_t expected_num_nodes = 256;
+            constexpr std::size_t expected_num_nodes =
+                policy_type::slot_mapping_type::requires_power_of_two
+                ? 256
+                : min_num_nodes;
             CHECK_NOTHROW(table.rehash(min_num_nodes));
             CHECK(table.size() == 1);
             CHECK(table.num_nodes() == expected_num_nodes);
@@ -625,6 +996,52 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         }
     }
 
+    SECTION("compact") {
+        table_type table;
+        CHECK(table.insert("abc"));
+        CHECK(table.insert("bcd"));
+        CHECK(table.insert("cde"));
+        CHECK(table.erase('a'));
+        CHECK(table.erase('c'));
+        if constexpr (table_type::use_robin_hood) {
+            CHECK(table.num_erased() == 0);
+        } else {
+            CHECK(table.num_erased() == 2);
+        }
+
+        CHECK_NOTHROW(table.compact());
+        CHECK(table.num_erased() == 0);
+        CHECK(table.size() == 1);
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+        CHECK_FALSE(table.has('a'));
+        CHECK(table.at('b') == "bcd");
+        CHECK_FALSE(table.has('c'));
+    }
+
+    SECTION("remove tombstones automatically") {
+        table_type table;
+        constexpr char num_values = 10;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i)));
+        }
+
+        constexpr int repetition = 100;
+        for (int j = 0; j < repetition; ++j) {
+            CHECK(table.erase(static_cast<char>(j % num_values)));
+            CHECK(table.insert(std::string(1, static_cast<char>(j + 'A'))));
+            CHECK(table.erase(static_cast<char>(j + 'A')));
+            CHECK(table.insert(
+                std::string(1, static_cast<char>(j % num_values))));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+        CHECK(static_cast<float>(table.size() + table.num_erased()) <=
+            static_cast<float>(table.num_nodes()) * table.max_load_factor());
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.at(i) == std::string(1, i));
+        }
+    }
+
     SECTION("load_factor") {
         table_type table;
         CHECK(table.load_factor() == 0.0F);
@@ -654,4 +1071,552 @@ TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st", "",
         CHECK_NOTHROW(table.max_load_factor(0.99F));  // NOLINT
         CHECK_THROWS(table.max_load_factor(1.0F));    // NOLINT
     }
+
+    SECTION("insert and erase many values") {
+        table_type table;
+
+        constexpr char num_values = 100;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        for (char i = 0; i < num_values; i += 2) {
+            CHECK(table.erase(i));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values / 2));
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.has(i) == (i % 2 == 1));
+        }
+
+        CHECK(table.erase_if([](const value_type& value) {
+            return value[0] % 4 == 1;  // NOLINT
+        }) == static_cast<std::size_t>(num_values / 4));
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.has(i) == (i % 4 == 3));
+        }
+
+        for (char i = 0; i < num_values; i += 2) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+        }
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.has(i) == (i % 4 != 1));
+        }
+    }
+
+    SECTION("functions with hash numbers") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto hash1 = table.hash()(key1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        const auto hash2 = table.hash()(key2);
+
+        CHECK(table.insert_with_hash(value1, hash1));
+        CHECK_FALSE(table.insert_with_hash(value1, hash1));
+        CHECK(table.emplace_with_hash(key2, hash2, value2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.has_with_hash(key1, hash1));
+        CHECK(table.has(key2));
+        const std::string* res = table.try_get_with_hash(key2, hash2);
+        REQUIRE(static_cast<const void*>(res) != nullptr);
+        CHECK(*res == value2);
+
+        CHECK(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.has_with_hash(key1, hash1));
+        CHECK(table.size() == 1);
+    }
+
+    SECTION("incremental rehashing") {
+        table_type table;
+        CHECK(table.incremental_rehash_step() == 0);
+        CHECK_FALSE(table.is_rehashing());
+
+        std::size_t step = 0;
+        SECTION("one node in each step") { step = 1; }
+        SECTION("three nodes in each step") { step = 3; }  // NOLINT
+        table.incremental_rehash_step(step);
+        CHECK(table.incremental_rehash_step() == step);
+
+        constexpr char num_values = 100;
+        bool rehashed_incrementally = false;
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.insert(std::string(1, i) + "value"));
+            CHECK_FALSE(table.insert(std::string(1, i) + "value"));
+            rehashed_incrementally =
+                rehashed_incrementally || table.is_rehashing();
+            CHECK(table.size() == static_cast<std::size_t>(i + 1));
+            CHECK(static_cast<std::size_t>(std::distance(
+                      table.begin(), table.end())) == table.size());
+            CHECK(table.has(0));
+            CHECK(table.has(i));
+        }
+        CHECK(rehashed_incrementally);
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.at(i) == std::string(1, i) + "value");
+        }
+
+        for (char i = 0; i < num_values; i += 2) {
+            CHECK(table.erase(i));
+            CHECK_FALSE(table.erase(i));
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values / 2));
+
+        std::size_t num_visited = 0;
+        table.for_all([&num_visited](const value_type& /*value*/) {
+            ++num_visited;
+        });
+        CHECK(num_visited == table.size());
+
+        std::unordered_set<std::string> scanned;
+        std::size_t cursor = 0;
+        do {
+            cursor = table.scan(cursor, 3, [&scanned](std::string& value) {
+                CHECK(scanned.insert(value).second);
+            });
+        } while (cursor != 0);
+        CHECK(scanned.size() == table.size());
+
+        const table_type copy{table};
+        for (char i = 0; i < num_values; ++i) {
+            INFO("i = " << static_cast<int>(i));
+            CHECK(table.has(i) == (i % 2 == 1));
+            CHECK(copy.has(i) == (i % 2 == 1));
+        }
+
+        table.incremental_rehash_step(0);
+        CHECK_FALSE(table.is_rehashing());
+        CHECK(table.size() == static_cast<std::size_t>(num_values / 2));
+        for (char i = 1; i < num_values; i += 2) {
+            CHECK(table.has(i));
+        }
+    }
+
+    SECTION("finish incremental rehashing before the next growth") {
+        table_type table;
+        table.incremental_rehash_step(1);
+
+        constexpr char num_values = 100;
+        std::size_t num_growths = 0;
+        for (char i = 0; i < num_values; ++i) {
+            const std::size_t num_nodes = table.num_nodes();
+            const bool rehashing = table.is_rehashing();
+            CHECK(table.insert(std::string(1, i) + "value"));
+            if (table.num_nodes() != num_nodes) {
+                ++num_growths;
+                CHECK_FALSE(rehashing);
+            }
+        }
+        CHECK(num_growths > 1);
+        for (char i = 0; i < num_values; ++i) {
+            CHECK(table.has(i));
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::open_address_table_st (growth)", "",
+    (std::tuple<hash_tables::tables::policies::mask_slot_mapping,
+        hash_tables::tables::policies::double_growth>),
+    (std::tuple<hash_tables::tables::policies::mask_slot_mapping,
+        hash_tables::tables::policies::one_and_half_growth>),
+    (std::tuple<hash_tables::tables::policies::fastrange_slot_mapping,
+        hash_tables::tables::policies::double_growth>),
+    (std::tuple<hash_tables::tables::policies::fastrange_slot_mapping,
+        hash_tables::tables::policies::one_and_half_growth>)) {
+    using hash_tables::tables::open_address_table_st;
+
+    using key_type = int;
+    using value_type = int;
+    using slot_mapping_type = std::tuple_element_t<0, TestType>;
+    using growth_type = std::tuple_element_t<1, TestType>;
+    using policy_type = hash_tables::tables::policies::open_address_policy<
+        hash_tables::tables::policies::tombstone_strategy,
+        hash_tables::tables::policies::linear_probing, slot_mapping_type,
+        growth_type>;
+    using table_type = open_address_table_st<value_type, key_type,
+        hash_tables::extract_key_functions::identity<value_type>,
+        hash_tables::hashes::std_hash<key_type>, std::equal_to<key_type>,
+        std::allocator<value_type>, policy_type>;
+
+    SECTION("grow") {
+        table_type table;
+        CHECK(table.num_nodes() == table_type::default_num_nodes);
+
+        std::size_t expected_num_nodes =
+            growth_type::grow(table_type::default_num_nodes);
+        if constexpr (slot_mapping_type::requires_power_of_two) {
+            expected_num_nodes =
+                hash_tables::utility::round_up_to_power_of_two(
+                    expected_num_nodes);
+        }
+
+        int num_values = 0;
+        while (table.num_nodes() == table_type::default_num_nodes) {
+            CHECK(table.insert(num_values));
+            ++num_values;
+        }
+        CHECK(table.num_nodes() == expected_num_nodes);
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(table.has(i));
+        }
+    }
+}
+
+namespace {
+
+/*!
+ * \brief Class of move-only values declared to be trivially relocatable.
+ */
+struct relocatable_value {
+    //! Key.
+    int key;
+
+    //! Payload.
+    std::unique_ptr<int> payload;
+};
+
+/*!
+ * \brief Class to extract keys from relocatable_value objects.
+ */
+struct extract_key_from_relocatable_value {
+    /*!
+     * \brief Extract the key.
+     *
+     * \param[in] value Value.
+     * \return Key.
+     */
+    [[nodiscard]] auto operator()(const relocatable_value& value) const
+        -> const int& {
+        return value.key;
+    }
+};
+
+/*!
+ * \brief Class of hash functions using keys divided by 100 as hash numbers.
+ *
+ * Keys in the same hundred share the node determined by hash number.
+ */
+struct hundreds_hash {
+    /*!
+     * \brief Calculate a hash number.
+     *
+     * \param[in] key Key.
+     * \return Hash number.
+     */
+    [[nodiscard]] auto operator()(int key) const -> std::size_t {
+        constexpr int divisor = 100;
+        return static_cast<std::size_t>(key / divisor);
+    }
+};
+
+/*!
+ * \brief Class of functions to compare keys counting the comparisons.
+ */
+struct counting_equal_to {
+    //! Number of comparisons.
+    std::size_t* num_comparisons;
+
+    /*!
+     * \brief Compare keys.
+     *
+     * \param[in] left Key.
+     * \param[in] right Key.
+     * \return Whether the keys are equal.
+     */
+    [[nodiscard]] auto operator()(int left, int right) const -> bool {
+        ++(*num_comparisons);
+        return left == right;
+    }
+};
+
+}  // namespace
+
+namespace hash_tables::utility {
+
+template <>
+struct is_trivially_relocatable<relocatable_value> : public std::true_type {};
+
+}  // namespace hash_tables::utility
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE(
+    "hash_tables::tables::open_address_table_st (trivially relocatable values)",
+    "", hash_tables::tables::policies::default_open_address_policy,
+    hash_tables::tables::policies::robin_hood_policy,
+    (hash_tables::tables::policies::open_address_policy<
+        hash_tables::tables::policies::robin_hood_strategy,
+        hash_tables::tables::policies::linear_probing,
+        hash_tables::tables::policies::fastrange_slot_mapping,
+        hash_tables::tables::policies::one_and_half_growth, true>),
+    hash_tables::tables::policies::separate_values_policy) {
+    using hash_tables::tables::open_address_table_st;
+
+    using policy_type = TestType;
+    using key_type = int;
+
+    SECTION("copy and rehash pairs of integers") {
+        using value_type = std::pair<const key_type, int>;
+        using table_type = open_address_table_st<value_type, key_type,
+            hash_tables::extract_key_functions::extract_first_from_pair<
+                value_type>,
+            hash_tables::hashes::std_hash<key_type>, std::equal_to<key_type>,
+            std::allocator<value_type>, policy_type>;
+        STATIC_CHECK(
+            hash_tables::utility::is_trivially_relocatable_v<value_type>);
+        STATIC_CHECK(hash_tables::utility::is_bytewise_copyable_v<value_type>);
+
+        table_type table;
+        constexpr int num_values = 100;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(table.emplace(i, i, i * 2));
+        }
+        for (int i = 0; i < num_values; i += 2) {
+            CHECK(table.erase(i));
+        }
+
+        const table_type copy{table};  // NOLINT
+        CHECK(copy.size() == table.size());
+        CHECK(copy.num_nodes() == table.num_nodes());
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(copy.has(i) == (i % 2 == 1));
+        }
+
+        constexpr std::size_t min_num_nodes = 1000;
+        table.rehash(min_num_nodes);
+        CHECK(table.num_nodes() >= min_num_nodes);
+        CHECK(table.size() == copy.size());
+        for (int i = 1; i < num_values; i += 2) {
+            CHECK(table.at(i).second == i * 2);
+        }
+    }
+
+    SECTION("clear and refill pairs of integers") {
+        using value_type = std::pair<const key_type, int>;
+        using table_type = open_address_table_st<value_type, key_type,
+            hash_tables::extract_key_functions::extract_first_from_pair<
+                value_type>,
+            hash_tables::hashes::std_hash<key_type>, std::equal_to<key_type>,
+            std::allocator<value_type>, policy_type>;
+
+        table_type table;
+        constexpr int num_values = 100;
+        for (int repetition = 0; repetition < 3; ++repetition) {
+            for (int i = 0; i < num_values; ++i) {
+                CHECK(table.emplace(i + repetition, i + repetition, i));
+            }
+            for (int i = 0; i < num_values; i += 2) {
+                CHECK(table.erase(i + repetition));
+            }
+            const std::size_t num_nodes = table.num_nodes();
+
+            table.clear();
+            CHECK(table.empty());
+            CHECK(table.num_erased() == 0);
+            CHECK(table.num_nodes() == num_nodes);
+            for (int i = 0; i < num_values; ++i) {
+                CHECK_FALSE(table.has(i + repetition));
+            }
+        }
+    }
+
+    SECTION("rehash values declared to be trivially relocatable") {
+        using value_type = relocatable_value;
+        using table_type = open_address_table_st<value_type, key_type,
+            extract_key_from_relocatable_value,
+            hash_tables::hashes::std_hash<key_type>, std::equal_to<key_type>,
+            std::allocator<value_type>, policy_type>;
+
+        table_type table;
+        constexpr int num_values = 100;
+        for (int i = 0; i < num_values; ++i) {
+            CHECK(table.insert(
+                value_type{i, std::make_unique<int>(i * 3)}));  // NOLINT
+        }
+        CHECK(table.size() == static_cast<std::size_t>(num_values));
+        for (int i = 0; i < num_values; ++i) {
+            const value_type* value = table.try_get(i);
+            REQUIRE(value != nullptr);
+            REQUIRE(value->payload != nullptr);
+            CHECK(*value->payload == i * 3);  // NOLINT
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::open_address_table_st (probe bounds)") {
+    using hash_tables::tables::open_address_table_st;
+
+    using key_type = int;
+    using value_type = int;
+    using table_type = open_address_table_st<value_type, key_type,
+        hash_tables::extract_key_functions::identity<value_type>,
+        hundreds_hash, counting_equal_to, std::allocator<value_type>,
+        hash_tables::tables::policies::default_open_address_policy>;
+
+    std::size_t num_comparisons = 0;
+    constexpr std::size_t min_num_nodes = 64;
+    table_type table{min_num_nodes,
+        hash_tables::extract_key_functions::identity<value_type>(),
+        hundreds_hash(), counting_equal_to{&num_comparisons}};
+
+    SECTION("stop a miss at the bound of its own node") {
+        // Build one cluster filling nodes 0 to 9 from node 0.
+        constexpr int cluster_size = 10;
+        for (int key = 0; key < cluster_size; ++key) {
+            CHECK(table.insert(key));
+        }
+        // Fill node 10 so that the cluster is not followed by an empty node.
+        constexpr int key_from_node10 = 1000;
+        CHECK(table.insert(key_from_node10));
+
+        // Node 1 is inside the cluster, but no value has node 1 as its
+        // desired node, so a miss from node 1 checks node 1 only.
+        constexpr int key_from_node1 = 100;
+        num_comparisons = 0;
+        CHECK_FALSE(table.has(key_from_node1));
+        CHECK(num_comparisons == 1);
+
+        // A miss from node 0 still walks the whole cluster.
+        num_comparisons = 0;
+        CHECK_FALSE(table.has(cluster_size));
+        CHECK(num_comparisons == static_cast<std::size_t>(cluster_size));
+
+        for (int key = 0; key < cluster_size; ++key) {
+            CHECK(table.has(key));
+        }
+        CHECK(table.has(key_from_node10));
+    }
+
+    SECTION("search values farther than the maximum distance in nodes") {
+        // Keys 0 to 99 have the same desired node.
+        constexpr int num_keys = 99;
+        STATIC_CHECK(static_cast<std::uint32_t>(num_keys) >
+            hash_tables::tables::internal::open_address_table_st_node<
+                value_type>::max_dist);
+        for (int key = 0; key < num_keys; ++key) {
+            CHECK(table.insert(key));
+        }
+        for (int key = 0; key < num_keys; ++key) {
+            INFO("key = " << key);
+            CHECK(table.has(key));
+        }
+        CHECK_FALSE(table.has(num_keys));
+
+        for (int key = 0; key < num_keys; key += 2) {
+            CHECK(table.erase(key));
+        }
+        for (int key = 0; key < num_keys; ++key) {
+            INFO("key = " << key);
+            CHECK(table.has(key) == (key % 2 == 1));
+        }
+        CHECK(table.insert(num_keys));
+        CHECK(table.has(num_keys));
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::open_address_table_st (sizes of nodes)") {
+    using hash_tables::tables::internal::open_address_table_st_node;
+
+    // Without Robin Hood hashing, distances share a byte with states.
+    STATIC_CHECK(sizeof(open_address_table_st_node<char>) == 2U);
+    STATIC_CHECK(sizeof(open_address_table_st_node<std::uint32_t>) == 8U);
+    STATIC_CHECK(sizeof(open_address_table_st_node<std::uint64_t>) == 16U);
+
+    // Robin Hood hashing requires exact distances in 32-bit integers.
+    STATIC_CHECK(sizeof(open_address_table_st_node<char, false, true>) == 8U);
+    STATIC_CHECK(
+        sizeof(open_address_table_st_node<std::uint64_t, false, true>) == 16U);
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE(
+    "hash_tables::tables::open_address_table_st (merge with stateful hashes)",
+    "", hash_tables::tables::policies::default_open_address_policy,
+    hash_tables::tables::policies::robin_hood_policy,
+    (hash_tables::tables::policies::open_address_policy<
+        hash_tables::tables::policies::tombstone_strategy,
+        hash_tables::tables::policies::linear_probing,
+        hash_tables::tables::policies::mask_slot_mapping,
+        hash_tables::tables::policies::double_growth, true>)) {
+    using hash_tables::tables::open_address_table_st;
+
+    using policy_type = TestType;
+    using key_type = int;
+    using value_type = int;
+    using hash_type = hash_tables_test::hashes::seeded_hash<key_type>;
+    using extract_key_type =
+        hash_tables::extract_key_functions::identity<value_type>;
+    using table_type = open_address_table_st<value_type, key_type,
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>, policy_type>;
+
+    constexpr std::size_t min_num_nodes = 16;
+    constexpr std::size_t seed = 12345;
+    table_type table{min_num_nodes, extract_key_type(), hash_type(0)};
+    table_type other{min_num_nodes, extract_key_type(), hash_type(seed)};
+
+    constexpr int num_values = 100;
+    constexpr int first_other = 30;
+    constexpr int last_table = 60;
+    for (int i = 0; i < last_table; ++i) {
+        CHECK(table.insert(i));
+    }
+    for (int i = first_other; i < num_values; ++i) {
+        CHECK(other.insert(i));
+    }
+
+    table.merge(other);
+    CHECK(table.size() == static_cast<std::size_t>(num_values));
+    CHECK(other.size() == static_cast<std::size_t>(last_table - first_other));
+    for (int i = 0; i < num_values; ++i) {
+        INFO("i = " << i);
+        CHECK(table.has(i));
+        CHECK(other.has(i) == (first_other <= i && i < last_table));
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::open_address_table_st (prefetch)") {
+    using hash_tables::tables::open_address_table_st;
+
+    using value_type = std::string;
+    using key_type = std::string;
+    using hash_type = hash_tables::hashes::std_hash<key_type>;
+    using extract_key_type =
+        hash_tables::extract_key_functions::identity<value_type>;
+    using transparent_table_type = open_address_table_st<value_type, key_type,
+        extract_key_type, hash_type, std::equal_to<>>;
+    using table_type = open_address_table_st<value_type, key_type,
+        extract_key_type, hash_type, std::equal_to<key_type>>;
+
+    SECTION("check enabled key types") {
+        STATIC_CHECK(is_prefetch_enabled<table_type, key_type>::value);
+        STATIC_CHECK_FALSE(
+            is_prefetch_enabled<table_type, std::string_view>::value);
+        STATIC_CHECK_FALSE(is_prefetch_enabled<table_type, int>::value);
+        STATIC_CHECK(
+            is_prefetch_enabled<transparent_table_type, key_type>::value);
+        STATIC_CHECK(is_prefetch_enabled<transparent_table_type,
+            std::string_view>::value);
+        STATIC_CHECK_FALSE(
+            is_prefetch_enabled<transparent_table_type, int>::value);
+    }
+
+    SECTION("prefetch and search keys") {
+        transparent_table_type table;
+        CHECK(table.insert(std::string("abc")));
+
+        table.prefetch(std::string_view("abc"));
+        CHECK(table.has(std::string_view("abc")));
+        table.prefetch(std::string("def"));
+        CHECK_FALSE(table.has(std::string("def")));
+    }
 }
@@ -19,6 +19,8 @@
  */
 #include "hash_tables/tables/separate_shared_chain_table_mt.h"
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -30,13 +32,22 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/lock_policies.h"
 #include "hash_tables_test/extract_key_functions/extract_first_element.h"
 #include "hash_tables_test/hashes/fixed_hash.h"
 
 // NOLINTNEXTLINE
 TEMPLATE_TEST_CASE("hash_tables::tables::separate_shared_chain_table_mt", "",
-    (std::tuple<hash_tables::hashes::std_hash<char>>),
-    (std::tuple<hash_tables_test::hashes::fixed_hash<char>>)) {
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::mutex_lock_policy>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::mutex_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::shared_mutex_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::spin_lock_policy>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::adaptive_lock_policy>)) {
     using hash_tables::tables::separate_shared_chain_table_mt;
 
     using key_type = char;
@@ -45,8 +56,10 @@ TEMPLATE_TEST_CASE("hash_tables::tables::separate_shared_chain_table_mt", "",
         hash_tables_test::extract_key_functions::extract_first_element<
             value_type>;
     using hash_type = std::tuple_element_t<0, TestType>;
+    using lock_policy_type = std::tuple_element_t<1, TestType>;
     using table_type = separate_shared_chain_table_mt<value_type, key_type,
-        extract_key_type, hash_type>;
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>, lock_policy_type>;
 
     SECTION("default constructor") {
         table_type table;
@@ -184,6 +197,40 @@ TEMPLATE_TEST_CASE("hash_tables::tables::separate_shared_chain_table_mt", "",
         }
     }
 
+    SECTION("update") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto value2 = std::string("bcd");
+        const char key2 = extract_key_type()(value2);
+        const auto function = [](std::string& value) { value += "x"; };
+        CHECK(table.emplace(key1, value1));
+
+        CHECK(table.update(key1, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+
+        CHECK_FALSE(table.update(key2, function));
+        CHECK(table.size() == 1);
+        CHECK_FALSE(table.has(key2));
+    }
+
+    SECTION("upsert") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto factory = [&value1] { return value1; };
+        const auto function = [](std::string& value) { value += "x"; };
+
+        CHECK(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == value1);
+
+        CHECK_FALSE(table.upsert(key1, factory, function));
+        CHECK(table.size() == 1);
+        CHECK(table.at(key1) == "abcx");
+    }
+
     SECTION("emplace_or_assign") {
         SECTION("successful") {
             table_type table;
@@ -581,4 +628,28 @@ TEMPLATE_TEST_CASE("hash_tables::tables::separate_shared_chain_table_mt", "",
             static_cast<float>(table.size()) /
                 static_cast<float>(table.num_buckets()));
     }
+
+    SECTION("functions with hash numbers") {
+        table_type table;
+        const auto value1 = std::string("abc");
+        const char key1 = extract_key_type()(value1);
+        const auto hash1 = table.hash()(key1);
+        const auto value2 = std::string("bcdef");
+        const char key2 = extract_key_type()(value2);
+        const auto hash2 = table.hash()(key2);
+
+        CHECK(table.insert_with_hash(value1, hash1));
+        CHECK_FALSE(table.insert_with_hash(value1, hash1));
+        CHECK(table.emplace_with_hash(key2, hash2, value2));
+        CHECK(table.size() == 2);
+
+        CHECK(table.has_with_hash(key1, hash1));
+        CHECK(table.has(key2));
+        CHECK(table.try_get_with_hash(key2, hash2).value() == value2);
+
+        CHECK(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.erase_with_hash(key1, hash1));
+        CHECK_FALSE(table.has_with_hash(key1, hash1));
+        CHECK(table.size() == 1);
+    }
 }
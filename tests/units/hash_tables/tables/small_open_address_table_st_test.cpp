@@ -0,0 +1,513 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of small_open_address_table_st class.
+ */
+#include "hash_tables/tables/small_open_address_table_st.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "hash_tables/exceptions.h"
+#include "hash_tables/extract_key_functions/identity.h"
+#include "hash_tables/hashes/std_hash.h"
+#include "hash_tables/tables/open_address_policies.h"
+#include "hash_tables_test/extract_key_functions/extract_first_element.h"
+#include "hash_tables_test/hashes/fixed_hash.h"
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("hash_tables::tables::small_open_address_table_st", "",
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::small_table_policy<>>),
+    (std::tuple<hash_tables_test::hashes::fixed_hash<char>,
+        hash_tables::tables::policies::small_table_policy<>>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::small_table_policy<1>>),
+    (std::tuple<hash_tables::hashes::std_hash<char>,
+        hash_tables::tables::policies::small_table_policy<64,
+            hash_tables::tables::policies::robin_hood_policy>>)) {
+    using hash_tables::tables::small_open_address_table_st;
+
+    using key_type = char;
+    using value_type = std::string;
+    using extract_key_type =
+        hash_tables_test::extract_key_functions::extract_first_element<
+            value_type>;
+    using hash_type = std::tuple_element_t<0, TestType>;
+    using policy_type = std::tuple_element_t<1, TestType>;
+    using table_type = small_open_address_table_st<value_type, key_type,
+        extract_key_type, hash_type, std::equal_to<key_type>,
+        std::allocator<value_type>, policy_type>;
+
+    constexpr std::size_t inline_capacity = table_type::inline_capacity;
+
+    // Values with different keys.
+    const auto create_value = [](std::size_t i) {
+        return std::string(1, static_cast<char>('!' + i)) + "value";
+    };
+    const auto key_of = [](const std::string& value) { return value.at(0); };
+
+    SECTION("default constructor") {
+        table_type table;
+        CHECK(table.size() == 0);  // NOLINT
+        CHECK(table.empty());
+        CHECK(table.is_inline());
+        CHECK(table.num_nodes() == inline_capacity);
+    }
+
+    SECTION("constructor with a large number of nodes") {
+        constexpr std::size_t min_num_nodes = 100;
+        table_type table{min_num_nodes};
+        CHECK(table.empty());
+        CHECK_FALSE(table.is_inline());
+        CHECK(table.num_nodes() >= min_num_nodes);
+    }
+
+    SECTION("insert values within the inline capacity") {
+        table_type table;
+        for (std::size_t i = 0; i < inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        CHECK_FALSE(table.insert(create_value(0)));
+        CHECK(table.size() == inline_capacity);
+        CHECK(table.is_inline());
+        for (std::size_t i = 0; i < inline_capacity; ++i) {
+            const auto value = create_value(i);
+            CHECK(table.at(key_of(value)) == value);
+            CHECK(table.has(key_of(value)));
+        }
+        CHECK_FALSE(table.has('~'));
+        CHECK(table.try_get('~') == nullptr);
+        CHECK_THROWS_AS((void)table.at('~'), hash_tables::key_not_found);
+    }
+
+    SECTION("insert values over the inline capacity") {
+        table_type table;
+        constexpr std::size_t size = inline_capacity + 3U;
+        for (std::size_t i = 0; i < size; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        CHECK(table.size() == size);
+        CHECK_FALSE(table.is_inline());
+        CHECK(table.num_nodes() > size);
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto value = create_value(i);
+            CHECK(table.at(key_of(value)) == value);
+        }
+
+        SECTION("shrink_to_fit with many values") {
+            table.shrink_to_fit();
+            CHECK(table.size() == size);
+            CHECK_FALSE(table.is_inline());
+        }
+
+        SECTION("shrink_to_fit with a small number of values") {
+            for (std::size_t i = 0; i < size - 1U; ++i) {
+                CHECK(table.erase(key_of(create_value(i))));
+            }
+            table.shrink_to_fit();
+            CHECK(table.size() == 1);
+            CHECK(table.is_inline());
+            const auto value = create_value(size - 1U);
+            CHECK(table.at(key_of(value)) == value);
+        }
+
+        SECTION("clear") {
+            table.clear();
+            CHECK(table.empty());
+            CHECK(table.is_inline());
+            CHECK(table.insert(create_value(0)));
+            CHECK(table.size() == 1);
+        }
+    }
+
+    SECTION("erase values stored inline") {
+        table_type table;
+        for (std::size_t i = 0; i < inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        const auto value = create_value(inline_capacity - 1U);
+        CHECK(table.erase(key_of(value)));
+        CHECK_FALSE(table.erase(key_of(value)));
+        CHECK(table.size() == inline_capacity - 1U);
+        CHECK_FALSE(table.has(key_of(value)));
+
+        CHECK(table.insert(value));
+        CHECK(table.size() == inline_capacity);
+        CHECK(table.is_inline());
+    }
+
+    SECTION("try_emplace, emplace_or_assign, and upsert") {
+        table_type table;
+        const auto value = create_value(0);
+        const auto key = key_of(value);
+
+        auto [inserted_value, inserted] = table.try_emplace(key, value);
+        CHECK(inserted);
+        CHECK(inserted_value == value);
+        const auto result = table.try_emplace(key, "other");
+        CHECK_FALSE(result.second);
+        CHECK(result.first == value);
+
+        const auto new_value = value + "2";
+        CHECK_FALSE(table.emplace_or_assign(key, new_value));
+        CHECK(table.at(key) == new_value);
+        CHECK(table.assign(key, value));
+        CHECK(table.at(key) == value);
+
+        CHECK_FALSE(table.upsert(
+            key, [] { return std::string(); },
+            [](std::string& current) { current += "3"; }));
+        CHECK(table.at(key) == value + "3");
+        CHECK(table.update(
+            key, [](std::string& current) { current.pop_back(); }));
+        CHECK(table.at(key) == value);
+    }
+
+    SECTION("iterate over values") {
+        table_type table;
+        for (const std::size_t size :
+            {std::size_t{0}, inline_capacity, inline_capacity + 5U}) {
+            table.clear();
+            std::unordered_set<std::string> expected;
+            for (std::size_t i = 0; i < size; ++i) {
+                CHECK(table.insert(create_value(i)));
+                expected.insert(create_value(i));
+            }
+            // Erase a value to make a hole.
+            if (size > 1U) {
+                CHECK(table.erase(key_of(create_value(0))));
+                expected.erase(create_value(0));
+            }
+
+            std::unordered_set<std::string> iterated;
+            for (const auto& value : table) {
+                CHECK(iterated.insert(value).second);
+            }
+            CHECK(iterated == expected);
+
+            std::unordered_set<std::string> scanned;
+            std::size_t cursor = 0;
+            do {
+                cursor = table.scan(cursor, 2U, [&scanned](std::string& value) {
+                    CHECK(scanned.insert(value).second);
+                });
+            } while (cursor != 0U);
+            CHECK(scanned == expected);
+
+            std::size_t num_called = 0;
+            table.for_all([&num_called](const std::string& /*value*/) {
+                ++num_called;
+            });
+            CHECK(num_called == expected.size());
+        }
+    }
+
+    SECTION("extract and insert") {
+        table_type table;
+        for (std::size_t i = 0; i < inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        const auto value = create_value(0);
+        auto node = table.extract(key_of(value));
+        REQUIRE_FALSE(node.empty());
+        CHECK(node.value() == value);
+        CHECK(node.hash_number() == hash_type()(key_of(value)));
+        CHECK_FALSE(table.has(key_of(value)));
+        CHECK(table.extract(key_of(value)).empty());
+
+        CHECK(table.insert(std::move(node)));
+        CHECK(node.empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(table.at(key_of(value)) == value);
+    }
+
+    SECTION("merge") {
+        table_type table;
+        CHECK(table.insert(create_value(0)));
+
+        SECTION("from a table with inline values") {
+            table_type other;
+            CHECK(other.insert(create_value(0) + "other"));
+            CHECK(other.insert(create_value(1)));
+            table.merge(other);
+            CHECK(table.size() == 2);
+            CHECK(table.at(key_of(create_value(0))) == create_value(0));
+            CHECK(table.at(key_of(create_value(1))) == create_value(1));
+            CHECK(other.size() == 1);
+        }
+
+        SECTION("from a large table") {
+            table_type other;
+            constexpr std::size_t size = inline_capacity + 3U;
+            for (std::size_t i = 1; i < size; ++i) {
+                CHECK(other.insert(create_value(i)));
+            }
+            table.merge(std::move(other));
+            CHECK(table.size() == size);
+            CHECK_FALSE(table.is_inline());
+            for (std::size_t i = 0; i < size; ++i) {
+                CHECK(table.has(key_of(create_value(i))));
+            }
+        }
+    }
+
+    SECTION("copy and move") {
+        for (const std::size_t size : {inline_capacity, inline_capacity + 1U}) {
+            table_type orig;
+            for (std::size_t i = 0; i < size; ++i) {
+                CHECK(orig.insert(create_value(i)));
+            }
+
+            table_type copy{orig};
+            CHECK(copy.size() == size);
+            CHECK(copy.is_inline() == orig.is_inline());
+            table_type assigned;
+            CHECK(assigned.insert(create_value(size)));
+            assigned = copy;
+            CHECK(assigned.size() == size);
+
+            table_type moved{std::move(copy)};
+            CHECK(moved.size() == size);
+            table_type move_assigned;
+            move_assigned = std::move(moved);
+            CHECK(move_assigned.size() == size);
+            for (std::size_t i = 0; i < size; ++i) {
+                CHECK(move_assigned.at(key_of(create_value(i))) ==
+                    create_value(i));
+                CHECK(assigned.at(key_of(create_value(i))) == create_value(i));
+            }
+        }
+    }
+
+    SECTION("erase_if") {
+        table_type table;
+        for (std::size_t i = 0; i < inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        const std::size_t removed =
+            table.erase_if([&key_of](const std::string& value) {
+                return key_of(value) % 2 == 0;
+            });
+        CHECK(removed == inline_capacity - table.size());
+        CHECK(table.check_all_satisfy([&key_of](const std::string& value) {
+            return key_of(value) % 2 != 0;
+        }));
+    }
+
+    SECTION("reserve") {
+        table_type table;
+        CHECK(table.insert(create_value(0)));
+        table.reserve(inline_capacity);
+        CHECK(table.is_inline());
+        table.reserve(inline_capacity + 1U);
+        CHECK_FALSE(table.is_inline());
+        CHECK(table.num_nodes() > inline_capacity + 1U);
+        CHECK(table.at(key_of(create_value(0))) == create_value(0));
+    }
+
+    SECTION("load factors are forwarded to the large table") {
+        table_type table;
+        CHECK_THROWS((void)table.max_load_factor(1.0F));
+        CHECK_THROWS((void)table.min_load_factor(0.5F));
+        constexpr float max_load_factor = 0.5F;
+        table.max_load_factor(max_load_factor);
+        for (std::size_t i = 0; i <= inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+        REQUIRE_FALSE(table.is_inline());
+        CHECK(table.max_load_factor() == max_load_factor);
+        CHECK(table.load_factor() <= max_load_factor);
+    }
+}
+
+namespace {
+
+/*!
+ * \brief Class of hash functions throwing an exception after a number of
+ * calls.
+ */
+struct throwing_hash {
+    //! Number of calls left before an exception. (Negative for no exception.)
+    std::shared_ptr<int> num_calls_left{std::make_shared<int>(-1)};
+
+    /*!
+     * \brief Calculate a hash number.
+     *
+     * \param[in] key Key.
+     * \return Hash number.
+     */
+    [[nodiscard]] auto operator()(const std::string& key) const
+        -> std::size_t {
+        if (*num_calls_left == 0) {
+            throw std::runtime_error("Test exception in hash.");
+        }
+        if (*num_calls_left > 0) {
+            --(*num_calls_left);
+        }
+        return std::hash<std::string>()(key);
+    }
+};
+
+//! Number of copies left before an exception. (Negative for no exception.)
+int num_copies_left = -1;  // NOLINT
+
+/*!
+ * \brief Class of values whose copy constructor throws an exception after a
+ * number of copies and whose move constructor may throw exceptions.
+ */
+struct throwing_copy_value {
+    //! Key.
+    int key;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] key Key.
+     */
+    explicit throwing_copy_value(int key) : key(key) {}
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \param[in] obj Object to copy from.
+     */
+    throwing_copy_value(const throwing_copy_value& obj) : key(obj.key) {
+        if (num_copies_left == 0) {
+            throw std::runtime_error("Test exception in copy.");
+        }
+        if (num_copies_left > 0) {
+            --num_copies_left;
+        }
+    }
+
+    /*!
+     * \brief Move constructor.
+     *
+     * \param[in] obj Object to move from.
+     */
+    // NOLINTNEXTLINE(performance-noexcept-move-constructor)
+    throwing_copy_value(throwing_copy_value&& obj) : key(obj.key) {}
+
+    auto operator=(const throwing_copy_value&)
+        -> throwing_copy_value& = default;
+    // NOLINTNEXTLINE(performance-noexcept-move-constructor)
+    auto operator=(throwing_copy_value&&) -> throwing_copy_value& = default;
+    ~throwing_copy_value() = default;
+};
+
+/*!
+ * \brief Class to extract keys from throwing_copy_value objects.
+ */
+struct extract_key_from_throwing_copy_value {
+    /*!
+     * \brief Extract the key.
+     *
+     * \param[in] value Value.
+     * \return Key.
+     */
+    [[nodiscard]] auto operator()(const throwing_copy_value& value) const
+        -> const int& {
+        return value.key;
+    }
+};
+
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::tables::small_open_address_table_st (exceptions)") {
+    using hash_tables::tables::small_open_address_table_st;
+
+    SECTION("keep inline values when moving them to a large table fails") {
+        using value_type = std::string;
+        using extract_key_type =
+            hash_tables::extract_key_functions::identity<value_type>;
+        using table_type = small_open_address_table_st<value_type, value_type,
+            extract_key_type, throwing_hash>;
+        constexpr auto inline_capacity =
+            static_cast<int>(table_type::inline_capacity);
+        // Values long enough to be left empty after moved.
+        const auto create_value = [](int i) {
+            return std::to_string(i) + std::string(32, 'x');  // NOLINT
+        };
+
+        throwing_hash hash;
+        table_type table{0U, extract_key_type(), hash};
+        for (int i = 0; i < inline_capacity; ++i) {
+            CHECK(table.insert(create_value(i)));
+        }
+
+        *hash.num_calls_left = inline_capacity / 2;
+        CHECK_THROWS_AS(
+            table.insert(create_value(inline_capacity)), std::runtime_error);
+        *hash.num_calls_left = -1;
+        CHECK(table.is_inline());
+        CHECK(table.size() == table_type::inline_capacity);
+        for (int i = 0; i < inline_capacity; ++i) {
+            INFO("i = " << i);
+            CHECK(table.has(create_value(i)));
+        }
+
+        CHECK(table.insert(create_value(inline_capacity)));
+        CHECK_FALSE(table.is_inline());
+        for (int i = 0; i <= inline_capacity; ++i) {
+            INFO("i = " << i);
+            CHECK(table.has(create_value(i)));
+        }
+    }
+
+    SECTION("keep the large table when moving values back fails") {
+        using table_type = small_open_address_table_st<throwing_copy_value,
+            int, extract_key_from_throwing_copy_value>;
+        constexpr auto inline_capacity =
+            static_cast<int>(table_type::inline_capacity);
+
+        table_type table;
+        for (int i = 0; i <= inline_capacity; ++i) {
+            CHECK(table.emplace(i, i));
+        }
+        CHECK(table.erase(inline_capacity));
+        CHECK_FALSE(table.is_inline());
+
+        num_copies_left = inline_capacity / 2;
+        CHECK_THROWS_AS(table.shrink_to_fit(), std::runtime_error);
+        num_copies_left = -1;
+        CHECK_FALSE(table.is_inline());
+        CHECK(table.size() == table_type::inline_capacity);
+        for (int i = 0; i < inline_capacity; ++i) {
+            INFO("i = " << i);
+            CHECK(table.has(i));
+        }
+
+        table.shrink_to_fit();
+        CHECK(table.is_inline());
+        CHECK(table.size() == table_type::inline_capacity);
+        for (int i = 0; i < inline_capacity; ++i) {
+            INFO("i = " << i);
+            CHECK(table.has(i));
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of adaptive_mutex class.
+ */
+#include "hash_tables/utility/adaptive_mutex.h"
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::adaptive_mutex") {
+    using hash_tables::utility::adaptive_mutex;
+
+    SECTION("copy and move are prohibited") {
+        STATIC_CHECK(!std::is_copy_constructible_v<adaptive_mutex>);
+        STATIC_CHECK(!std::is_copy_assignable_v<adaptive_mutex>);
+        STATIC_CHECK(!std::is_move_constructible_v<adaptive_mutex>);
+        STATIC_CHECK(!std::is_move_assignable_v<adaptive_mutex>);
+    }
+
+    SECTION("lock") {
+        adaptive_mutex mutex;
+
+        {
+            std::unique_lock<adaptive_mutex> lock(mutex);
+            CHECK_FALSE(mutex.try_lock());
+        }
+
+        CHECK(mutex.try_lock());
+        mutex.unlock();
+    }
+
+    SECTION("lock in threads") {
+        constexpr std::size_t num_threads = 4;
+        constexpr std::size_t num_repetitions = 10000;
+
+        adaptive_mutex mutex;
+        std::size_t counter = 0;
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            threads.emplace_back([&mutex, &counter] {
+                for (std::size_t j = 0; j < num_repetitions; ++j) {
+                    std::unique_lock<adaptive_mutex> lock(mutex);
+                    ++counter;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        CHECK(counter == num_threads * num_repetitions);
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of is_transparent class.
+ */
+#include "hash_tables/utility/is_transparent.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "hash_tables/hashes/std_hash.h"
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::is_transparent") {
+    using hash_tables::hashes::std_hash;
+    using hash_tables::utility::is_lookup_enabled;
+    using hash_tables::utility::is_transparent_lookup;
+    using hash_tables::utility::is_transparent_v;
+
+    SECTION("check types") {
+        STATIC_CHECK(is_transparent_v<std::equal_to<>>);
+        STATIC_CHECK_FALSE(is_transparent_v<std::equal_to<std::string>>);
+        STATIC_CHECK(is_transparent_v<std_hash<std::string>>);
+        STATIC_CHECK_FALSE(is_transparent_v<std_hash<int>>);
+    }
+
+    SECTION("check lookup") {
+        STATIC_CHECK(is_transparent_lookup<std_hash<std::string>,
+            std::equal_to<>, std::string, std::string_view>::value);
+        STATIC_CHECK(is_transparent_lookup<std_hash<std::string>,
+            std::equal_to<>, std::string, const char*>::value);
+        STATIC_CHECK_FALSE(is_transparent_lookup<std_hash<std::string>,
+            std::equal_to<std::string>, std::string, std::string_view>::value);
+        STATIC_CHECK_FALSE(is_transparent_lookup<std_hash<std::string>,
+            std::equal_to<>, std::string, int>::value);
+    }
+
+    SECTION("check lookup with any type") {
+        STATIC_CHECK(is_lookup_enabled<std_hash<std::string>,
+            std::equal_to<std::string>, std::string, std::string>::value);
+        STATIC_CHECK(is_lookup_enabled<std_hash<std::string>,
+            std::equal_to<>, std::string, std::string_view>::value);
+        STATIC_CHECK_FALSE(is_lookup_enabled<std_hash<std::string>,
+            std::equal_to<std::string>, std::string, std::string_view>::value);
+        STATIC_CHECK_FALSE(is_lookup_enabled<std_hash<int>, std::equal_to<int>,
+            int, double>::value);
+    }
+}
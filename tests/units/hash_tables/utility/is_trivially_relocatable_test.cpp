@@ -0,0 +1,48 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of is_trivially_relocatable class.
+ */
+#include "hash_tables/utility/is_trivially_relocatable.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::is_trivially_relocatable") {
+    using hash_tables::utility::is_bytewise_copyable_v;
+    using hash_tables::utility::is_trivially_relocatable_v;
+
+    SECTION("check relocation") {
+        STATIC_CHECK(is_trivially_relocatable_v<int>);
+        STATIC_CHECK(is_trivially_relocatable_v<
+            std::pair<const std::uint64_t, std::uint64_t>>);
+        STATIC_CHECK_FALSE(is_trivially_relocatable_v<std::string>);
+        STATIC_CHECK_FALSE(is_trivially_relocatable_v<std::unique_ptr<int>>);
+    }
+
+    SECTION("check copy") {
+        STATIC_CHECK(is_bytewise_copyable_v<int>);
+        STATIC_CHECK(is_bytewise_copyable_v<
+            std::pair<const std::uint64_t, std::uint64_t>>);
+        STATIC_CHECK_FALSE(is_bytewise_copyable_v<std::string>);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of multiply_high function.
+ */
+#include "hash_tables/utility/multiply_high.h"
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::multiply_high") {
+    using hash_tables::utility::multiply_high;
+
+    SECTION("calculate for 32 bit integers") {
+        CHECK(multiply_high(static_cast<std::uint32_t>(0),
+                  static_cast<std::uint32_t>(0xFFFFFFFFU)) == 0U);
+        CHECK(multiply_high(static_cast<std::uint32_t>(0x80000000U),
+                  static_cast<std::uint32_t>(6)) == 3U);
+        CHECK(multiply_high(static_cast<std::uint32_t>(0xFFFFFFFFU),
+                  static_cast<std::uint32_t>(0xFFFFFFFFU)) == 0xFFFFFFFEU);
+    }
+
+    SECTION("calculate for 64 bit integers") {
+        CHECK(multiply_high(static_cast<std::uint64_t>(0),
+                  static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFU)) == 0U);
+        CHECK(multiply_high(static_cast<std::uint64_t>(0x8000000000000000U),
+                  static_cast<std::uint64_t>(6)) == 3U);
+        CHECK(multiply_high(static_cast<std::uint64_t>(0x100000000U),
+                  static_cast<std::uint64_t>(0x100000000U)) == 1U);
+        CHECK(multiply_high(static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFU),
+                  static_cast<std::uint64_t>(0xFFFFFFFFFFFFFFFFU)) ==
+            0xFFFFFFFFFFFFFFFEU);
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of sequence_mutex class.
+ */
+#include "hash_tables/utility/sequence_mutex.h"
+
+#include <mutex>
+#include <shared_mutex>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::sequence_mutex") {
+    using hash_tables::utility::sequence_mutex;
+
+    SECTION("read without modification") {
+        sequence_mutex mutex;
+
+        const auto sequence = mutex.begin_read();
+        CHECK(mutex.validate_read(sequence));
+    }
+
+    SECTION("read during modification") {
+        sequence_mutex mutex;
+
+        std::unique_lock<sequence_mutex> lock(mutex);
+        const auto sequence = mutex.begin_read();
+        CHECK_FALSE(mutex.validate_read(sequence));
+    }
+
+    SECTION("read before modification") {
+        sequence_mutex mutex;
+
+        const auto sequence = mutex.begin_read();
+        {
+            std::unique_lock<sequence_mutex> lock(mutex);
+            CHECK_FALSE(mutex.try_lock_shared());
+        }
+        CHECK_FALSE(mutex.validate_read(sequence));
+        CHECK(mutex.validate_read(mutex.begin_read()));
+    }
+
+    SECTION("read with shared locks") {
+        sequence_mutex mutex;
+
+        const auto sequence = mutex.begin_read();
+        {
+            std::shared_lock<sequence_mutex> lock(mutex);
+            CHECK_FALSE(mutex.try_lock());
+        }
+        CHECK(mutex.validate_read(sequence));
+        CHECK(mutex.try_lock());
+        mutex.unlock();
+        CHECK_FALSE(mutex.validate_read(sequence));
+    }
+
+    SECTION("acquire multiple shared locks") {
+        sequence_mutex mutex;
+
+        const auto sequence = mutex.begin_read();
+        std::shared_lock<sequence_mutex> lock(mutex);
+        CHECK(mutex.try_lock_shared());
+        mutex.unlock_shared();
+        CHECK(mutex.validate_read(sequence));
+    }
+}
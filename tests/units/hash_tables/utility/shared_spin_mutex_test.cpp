@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of shared_spin_mutex class.
+ */
+#include "hash_tables/utility/shared_spin_mutex.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTNEXTLINE
+TEST_CASE("hash_tables::utility::shared_spin_mutex") {
+    using hash_tables::utility::shared_spin_mutex;
+
+    SECTION("copy and move are prohibited") {
+        STATIC_CHECK(!std::is_copy_constructible_v<shared_spin_mutex>);
+        STATIC_CHECK(!std::is_copy_assignable_v<shared_spin_mutex>);
+        STATIC_CHECK(!std::is_move_constructible_v<shared_spin_mutex>);
+        STATIC_CHECK(!std::is_move_assignable_v<shared_spin_mutex>);
+    }
+
+    SECTION("exclusive lock") {
+        shared_spin_mutex mutex;
+
+        {
+            std::unique_lock<shared_spin_mutex> lock(mutex);
+            CHECK_FALSE(mutex.try_lock());
+            CHECK_FALSE(mutex.try_lock_shared());
+        }
+
+        CHECK(mutex.try_lock());
+        mutex.unlock();
+        CHECK(mutex.try_lock_shared());
+        mutex.unlock_shared();
+    }
+
+    SECTION("shared locks") {
+        shared_spin_mutex mutex;
+
+        {
+            std::shared_lock<shared_spin_mutex> lock1(mutex);
+            std::shared_lock<shared_spin_mutex> lock2(mutex);
+            CHECK(mutex.try_lock_shared());
+            mutex.unlock_shared();
+            CHECK_FALSE(mutex.try_lock());
+        }
+
+        CHECK(mutex.try_lock());
+        mutex.unlock();
+    }
+}
@@ -47,6 +47,18 @@ TEST_CASE("hash_tables::utility::value_storage") {
         REQUIRE_NOTHROW(storage.clear());
     }
 
+    SECTION("relocate an int value") {
+        constexpr int val = 123;
+        value_storage<int> storage;
+        value_storage<int> other;
+        storage.emplace(val);
+
+        REQUIRE_NOTHROW(other.relocate_from(storage));
+        REQUIRE(other.get() == val);
+
+        REQUIRE_NOTHROW(other.clear());
+    }
+
     SECTION("construct a string") {
         const auto str = std::string("abc");
         value_storage<std::string> storage;
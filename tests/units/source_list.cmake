@@ -4,18 +4,32 @@ set(SOURCE_FILES
     hash_tables/hashes/hash_cache_test.cpp
     hash_tables/hashes/mix_hash_numbers_test.cpp
     hash_tables/hashes/std_hash_test.cpp
+    hash_tables/maps/dense_open_address_map_st_test.cpp
     hash_tables/maps/multi_open_address_map_mt_test.cpp
     hash_tables/maps/multi_open_address_map_st_test.cpp
     hash_tables/maps/open_address_map_st_test.cpp
     hash_tables/maps/separate_shared_chain_map_mt_test.cpp
     hash_tables/sets/open_address_set_st_test.cpp
+    hash_tables/tables/group_probing_table_st_test.cpp
+    hash_tables/tables/internal/control_byte_group_test.cpp
     hash_tables/tables/internal/hashed_key_view_test.cpp
+    hash_tables/tables/internal/retaining_allocator_test.cpp
     hash_tables/tables/multi_open_address_table_mt_test.cpp
     hash_tables/tables/multi_open_address_table_st_test.cpp
+    hash_tables/tables/node_handle_test.cpp
+    hash_tables/tables/open_address_policies_test.cpp
     hash_tables/tables/open_address_table_st_test.cpp
     hash_tables/tables/separate_shared_chain_table_mt_test.cpp
+    hash_tables/tables/small_open_address_table_st_test.cpp
+    hash_tables/utility/adaptive_mutex_test.cpp
     hash_tables/utility/count_right_zero_bits_test.cpp
+    hash_tables/utility/is_transparent_test.cpp
+    hash_tables/utility/is_trivially_relocatable_test.cpp
     hash_tables/utility/move_if_nothrow_move_constructible_test.cpp
+    hash_tables/utility/multiply_high_test.cpp
     hash_tables/utility/round_up_to_power_of_two_test.cpp
+    hash_tables/utility/sequence_mutex_test.cpp
+    hash_tables/utility/shared_spin_mutex_test.cpp
+    hash_tables/utility/spin_mutex_test.cpp
     hash_tables/utility/value_storage_test.cpp
 )